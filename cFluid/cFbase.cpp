@@ -70,6 +70,8 @@ void G_CARTESIAN::readBaseStates(
 	int comp;
 	EOS_PARAMS *eos = eqn_params->eos;
 	static boolean first = YES;
+	const char *line;
+	boolean compressed;
 
 	base_front->extra1 = (POINTER)eqn_params;
         readFrontStates(base_front,restart_name);
@@ -85,7 +87,8 @@ void G_CARTESIAN::readBaseStates(
 	base_comp = T->components;
         base_gmax = base_grid->gmax;
         FT_ScalarMemoryAlloc((POINTER*)&base_field,sizeof(FIELD));
-        next_output_line_containing_string(infile,"Interior gas states:");
+        line = next_output_line_containing_string(infile,
+				"Interior gas states:");
 	if (first)
 	{
             switch (dim)
@@ -126,6 +129,21 @@ void G_CARTESIAN::readBaseStates(
 	    	break;
 	    }
 	}
+	compressed = (line != NULL && strstr(line,"compressed") != NULL) ?
+				YES : NO;
+	if (compressed)
+	{
+	    base_size = 1;
+	    for (i = 0; i < dim; ++i)
+		base_size *= base_gmax[i] + 1;
+	    fread_compressed_array(infile,base_field->dens,sizeof(double),
+				base_size);
+	    fread_compressed_array(infile,base_field->engy,sizeof(double),
+				base_size);
+	    for (l = 0; l < dim; ++l)
+		fread_compressed_array(infile,base_field->momn[l],
+				sizeof(double),base_size);
+	}
 
         switch (dim)
         {
@@ -136,13 +154,17 @@ void G_CARTESIAN::readBaseStates(
 		comp = base_comp[index];
                 st_tmp.eos = &(eos[comp]);
 
-                fscanf(infile,"%lf",&base_field->dens[index]);
-                fscanf(infile,"%lf",&base_field->engy[index]);
+		if (!compressed)
+		{
+                    fscanf(infile,"%lf",&base_field->dens[index]);
+                    fscanf(infile,"%lf",&base_field->engy[index]);
+		}
                 st_tmp.dens = base_field->dens[index];
                 st_tmp.engy = base_field->engy[index];
                 for (l = 0; l < dim; ++l)
                 {
-                    fscanf(infile,"%lf",&base_field->momn[l][index]);
+		    if (!compressed)
+                        fscanf(infile,"%lf",&base_field->momn[l][index]);
                     st_tmp.momn[l] = base_field->momn[l][index];
                 }
                 base_field->pres[index] = EosPressure(&st_tmp);
@@ -156,13 +178,17 @@ void G_CARTESIAN::readBaseStates(
 		comp = base_comp[index];
                 st_tmp.eos = &(eos[comp]);
 
-                fscanf(infile,"%lf",&base_field->dens[index]);
-                fscanf(infile,"%lf",&base_field->engy[index]);
+		if (!compressed)
+		{
+                    fscanf(infile,"%lf",&base_field->dens[index]);
+                    fscanf(infile,"%lf",&base_field->engy[index]);
+		}
                 st_tmp.dens = base_field->dens[index];
                 st_tmp.engy = base_field->engy[index];
                 for (l = 0; l < dim; ++l)
                 {
-                    fscanf(infile,"%lf",&base_field->momn[l][index]);
+		    if (!compressed)
+                        fscanf(infile,"%lf",&base_field->momn[l][index]);
                     st_tmp.momn[l] = base_field->momn[l][index];
                 }
                 base_field->pres[index] = EosPressure(&st_tmp);
@@ -177,13 +203,17 @@ void G_CARTESIAN::readBaseStates(
 		comp = base_comp[index];
                 st_tmp.eos = &(eos[comp]);
 
-                fscanf(infile,"%lf",&base_field->dens[index]);
-                fscanf(infile,"%lf",&base_field->engy[index]);
+		if (!compressed)
+		{
+                    fscanf(infile,"%lf",&base_field->dens[index]);
+                    fscanf(infile,"%lf",&base_field->engy[index]);
+		}
                 st_tmp.dens = base_field->dens[index];
                 st_tmp.engy = base_field->engy[index];
                 for (l = 0; l < dim; ++l)
                 {
-                    fscanf(infile,"%lf",&base_field->momn[l][index]);
+		    if (!compressed)
+                        fscanf(infile,"%lf",&base_field->momn[l][index]);
                     st_tmp.momn[l] = base_field->momn[l][index];
                 }
                 base_field->pres[index] = EosPressure(&st_tmp);
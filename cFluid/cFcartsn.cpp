@@ -80,22 +80,31 @@ G_CARTESIAN::~G_CARTESIAN()
 
 void G_CARTESIAN::initMesh()
 {
-	int index;
-	double coords[2];
-
-	L_RECTANGLE rectangle;
-
 	if (debugging("trace"))
 	    (void) printf("Entering g_cartesian.initMesh()\n");
 
 	FT_MakeGridIntfc(front);
     initComputationalData();
-	
+	setCellCenters();
+	setComponent();
+	FT_FreeGridIntfc(front);
+
+	if (debugging("trace"))
+	    (void) printf("Leaving g_cartesian.initMesh()\n");
+}
+
+void G_CARTESIAN::setCellCenters()
+{
+	int index;
+	double coords[MAXD];
+
+	L_RECTANGLE rectangle;
+
     int num_cells = 1;
 	for (int i = 0; i < dim; ++i)
         num_cells *= (top_gmax[i] + 1);
 	
-    cell_center.insert(cell_center.end(),num_cells,rectangle);
+    cell_center.assign(num_cells,rectangle);
 	
 	switch (dim)
 	{
@@ -135,12 +144,6 @@ void G_CARTESIAN::initMesh()
 	    	cell_center[index].icoords[2] = k;
 	    }
 	}
-	
-	setComponent();
-	FT_FreeGridIntfc(front);
-
-	if (debugging("trace"))
-	    (void) printf("Leaving g_cartesian.initMesh()\n");
 }
 
 void G_CARTESIAN::initComputationalData()
@@ -248,6 +251,18 @@ void G_CARTESIAN::initRungeKutta()
             clean_up(ERROR);
     }
 
+    switch (eqn_params->rk_scheme)
+    {
+        case SSP_RK3_LS:
+            setLowStorageSSPRK3();
+            break;
+        case SSP_RK4_LS:
+            setLowStorageSSPRK4();
+            break;
+        default:
+            break;
+    }
+
     allocRungeKuttaVstFlux();
 }
 
@@ -277,16 +292,66 @@ void G_CARTESIAN::setFourthOrderRK()
     weightsRK[2] = 1.0/3.0;  weightsRK[3] = 1.0/6.0;
 }
 
+// Shu-Osher SSP-RK(3,3) in two registers, q0 holds the old state.
+void G_CARTESIAN::setLowStorageSSPRK3()
+{
+    LS_RK_STAGE stage = {0.0, 1.0, 1.0, false, {0.0, 0.0}, {0.0, 0.0}};
+
+    orderRK = 3;
+    lsStagesRK.assign(3,stage);
+    lsStagesRK[1].a = 0.75;     lsStagesRK[1].b = 0.25;
+    lsStagesRK[1].c = 0.25;
+    lsStagesRK[2].a = 1.0/3.0;  lsStagesRK[2].b = 2.0/3.0;
+    lsStagesRK[2].c = 2.0/3.0;
+}
+
+// Ketcheson's SSP-RK(10,4) in two registers, SSP coefficient 6.
+void G_CARTESIAN::setLowStorageSSPRK4()
+{
+    LS_RK_STAGE stage = {0.0, 1.0, 1.0/6.0, false, {0.0, 0.0}, {0.0, 0.0}};
+
+    orderRK = 4;
+    lsStagesRK.assign(10,stage);
+    lsStagesRK[4].mix = true;
+    lsStagesRK[4].mix_q0[0] = 1.0/25.0; lsStagesRK[4].mix_q0[1] = 9.0/25.0;
+    lsStagesRK[4].mix_q1[0] = 15.0;     lsStagesRK[4].mix_q1[1] = -5.0;
+    lsStagesRK[9].a = 1.0;  lsStagesRK[9].b = 0.6;  lsStagesRK[9].c = 0.1;
+}
+
 void G_CARTESIAN::allocRungeKuttaVstFlux()
 {
-    FT_VectorMemoryAlloc((POINTER*)&st_field,orderRK,sizeof(SWEEP));
-    FT_VectorMemoryAlloc((POINTER*)&st_flux,orderRK,sizeof(FSWEEP));
-	
-    for (int i = 0; i < orderRK; ++i)
+    int num_vst = orderRK;
+    int num_flux = orderRK;
+
+    if (!lsStagesRK.empty())
     {
+        num_vst = 2;
+        num_flux = 1;
+    }
+    FT_VectorMemoryAlloc((POINTER*)&st_field,num_vst,sizeof(SWEEP));
+    FT_VectorMemoryAlloc((POINTER*)&st_flux,num_flux,sizeof(FSWEEP));
+	
+    for (int i = 0; i < num_vst; ++i)
         allocMeshVst(&st_field[i]);
+    for (int i = 0; i < num_flux; ++i)
         allocMeshFlux(&st_flux[i]);
+}
+
+void G_CARTESIAN::freeRungeKuttaVstFlux()
+{
+    int num_vst = orderRK;
+    int num_flux = orderRK;
+
+    if (!lsStagesRK.empty())
+    {
+        num_vst = 2;
+        num_flux = 1;
     }
+    for (int i = 0; i < num_vst; ++i)
+        freeVst(&st_field[i]);
+    for (int i = 0; i < num_flux; ++i)
+        freeFlux(&st_flux[i]);
+    FT_FreeThese(2,st_field,st_flux);
 }
 
 
@@ -423,7 +488,10 @@ void G_CARTESIAN::setInitialStates()
 void G_CARTESIAN::computeAdvection()
 {
     //potential to modify the method adaptively here
-    solveRungeKutta();
+    if (lsStagesRK.empty())
+        solveRungeKutta();
+    else
+        solveLowStorageRK();
 }
 
 void G_CARTESIAN::solveRungeKutta()
@@ -443,6 +511,7 @@ void G_CARTESIAN::solveRungeKutta()
             if (coeffsRK[i][j] != 0.0)
                 addMeshFluxToVst(&st_field[i+1],st_flux[j],coeffsRK[i][j]);
 	    }
+        recoverPrimitives(&st_field[i+1]);
 
         computeMeshFlux(st_field[i+1],&st_flux[i+1],delta_t);
 	}
@@ -452,12 +521,34 @@ void G_CARTESIAN::solveRungeKutta()
 	    if (weightsRK[i] != 0.0)
             addMeshFluxToVst(&st_field[0],st_flux[i],weightsRK[i]);
 	}
+    recoverPrimitives(&st_field[0]);
 
 	copyFromMeshVst(st_field[0]);
 	
     stop_clock("solveRungeKutta");
 }
 
+void G_CARTESIAN::solveLowStorageRK()
+{
+    start_clock("solveLowStorageRK");
+
+    copyToMeshVst(&st_field[0]);
+    copyMeshVst(st_field[0],&st_field[1]);
+
+	double delta_t = front->dt;
+    for (int i = 0; i < (int)lsStagesRK.size(); ++i)
+    {
+        computeMeshFlux(st_field[0],&st_flux[0],delta_t);
+        updateMeshVstLowStorage(&st_field[0],&st_field[1],st_flux[0],
+                                lsStagesRK[i]);
+        recoverPrimitives(&st_field[0]);
+    }
+
+	copyFromMeshVst(st_field[0]);
+
+    stop_clock("solveLowStorageRK");
+}
+
 
 void G_CARTESIAN::computeMeshFlux(
         SWEEP m_vst, FSWEEP *m_flux,
@@ -810,7 +901,6 @@ void G_CARTESIAN::solve()
 	copyMeshStates(); //MPI; static variables inside
 	stop_clock("copyMeshStates");
 
-	setAdvectionDt();
 	stop_clock("solve");
 	
     if (debugging("trace"))
@@ -822,6 +912,7 @@ void G_CARTESIAN::setupSolver()
 {
 	max_speed = 0.0;
     setDomain();
+    clearGhostStateCache();
     setGhostFluidStatesToZero();
 }
 
@@ -981,6 +1072,8 @@ void G_CARTESIAN::allocMeshVst(
 	FT_VectorMemoryAlloc((POINTER*)&vst->engy,sizeEqnVst,sizeof(double));
 	FT_VectorMemoryAlloc((POINTER*)&vst->pres,sizeEqnVst,sizeof(double));
 	FT_MatrixMemoryAlloc((POINTER*)&vst->momn,MAXD,sizeEqnVst,sizeof(double));
+	FT_MatrixMemoryAlloc((POINTER*)&vst->vel,MAXD,sizeEqnVst,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&vst->csnd,sizeEqnVst,sizeof(double));
 }
 
 void G_CARTESIAN::allocMeshFlux(
@@ -1006,6 +1099,8 @@ void G_CARTESIAN::allocDirVstFlux(
 	FT_VectorMemoryAlloc((POINTER*)&vst->engy,size,sizeof(double));
 	FT_VectorMemoryAlloc((POINTER*)&vst->pres,size,sizeof(double));
 	FT_MatrixMemoryAlloc((POINTER*)&vst->momn,MAXD,size,sizeof(double));
+	FT_MatrixMemoryAlloc((POINTER*)&vst->vel,MAXD,size,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&vst->csnd,size,sizeof(double));
 
 	FT_VectorMemoryAlloc((POINTER*)&flux->dens_flux,size,sizeof(double));
 	FT_VectorMemoryAlloc((POINTER*)&flux->engy_flux,size,sizeof(double));
@@ -1016,7 +1111,8 @@ void G_CARTESIAN::freeDirVstFlux(
         SWEEP* vst,
         FSWEEP* flux)
 {
-        FT_FreeThese(4,vst->dens,vst->engy,vst->pres,vst->momn);
+        FT_FreeThese(6,vst->dens,vst->engy,vst->pres,vst->momn,vst->vel,
+                        vst->csnd);
         FT_FreeThese(3,flux->dens_flux,flux->engy_flux,flux->momn_flux);
 }	/* end allocDirMeshVstFlux */
 
@@ -1068,6 +1164,48 @@ void G_CARTESIAN::printFrontInteriorStates(char *out_name)
 	sprintf(filename,"%s-gas",filename);
 	outfile = fopen(filename,"w");
 
+	if (is_compressed_output())
+	{
+	    /* Same sections, each one compressed block of binary doubles;
+	       the interior fields are stored one after another in the
+	       order of the mesh index */
+	    double *buf;
+	    int n,size;
+
+	    n = 0;
+	    next_point(intfc,NULL,NULL,NULL);
+	    while (next_point(intfc,&p,&hse,&hs))
+		++n;
+	    FT_VectorMemoryAlloc((POINTER*)&buf,2*(2+dim)*n + 1,FLOAT);
+	    n = 0;
+	    next_point(intfc,NULL,NULL,NULL);
+	    while (next_point(intfc,&p,&hse,&hs))
+	    {
+		FT_GetStatesAtPoint(p,hse,hs,(POINTER*)&sl,(POINTER*)&sr);
+		buf[n++] = getStateDens(sl);	buf[n++] = getStateDens(sr);
+		buf[n++] = getStateEngy(sl);	buf[n++] = getStateEngy(sr);
+		for (i = 0; i < dim; ++i)
+		{
+		    buf[n++] = getStateMom[i](sl);
+		    buf[n++] = getStateMom[i](sr);
+		}
+	    }
+	    fprintf(outfile,"Interface gas states: compressed\n");
+	    fwrite_compressed_array(outfile,buf,sizeof(double),n);
+	    FT_FreeThese(1,buf);
+
+	    size = 1;
+	    for (i = 0; i < dim; ++i)
+		size *= top_gmax[i] + 1;
+	    fprintf(outfile,"\nInterior gas states: compressed\n");
+	    fwrite_compressed_array(outfile,dens,sizeof(double),size);
+	    fwrite_compressed_array(outfile,engy,sizeof(double),size);
+	    for (l = 0; l < dim; ++l)
+		fwrite_compressed_array(outfile,momn[l],sizeof(double),size);
+	    fclose(outfile);
+	    return;
+	}
+
         /* Initialize states at the interface */
         fprintf(outfile,"Interface gas states:\n");
         next_point(intfc,NULL,NULL,NULL);
@@ -1134,6 +1272,9 @@ void G_CARTESIAN::readInteriorStates(char *restart_name)
 	double *engy = field.engy;
 	double *pres = field.pres;
 	double **momn = field.momn;
+	const char *line;
+	boolean compressed;
+	int size;
 
 	setDomain();
 
@@ -1153,10 +1294,33 @@ void G_CARTESIAN::readInteriorStates(char *restart_name)
 	
 	st_tmp.dim = eqn_params->dim;
 
-	sprintf(fname,"%s-gas",restart_name);
-	infile = fopen(fname,"r");
+	if (front->f_basic->RepartitionRun)
+	{
+	    // The states are in place, skip the file reads below
+	    readRepartitionedStates(restart_name);
+	    infile = NULL;
+	    compressed = YES;
+	}
+	else
+	{
+	    sprintf(fname,"%s-gas",restart_name);
+	    infile = fopen(fname,"r");
 	
-	next_output_line_containing_string(infile,"Interior gas states:");
+	    line = next_output_line_containing_string(infile,
+				"Interior gas states:");
+	    compressed = (line != NULL && strstr(line,"compressed") != NULL) ?
+				YES : NO;
+	}
+	if (compressed && infile != NULL)
+	{
+	    size = 1;
+	    for (i = 0; i < dim; ++i)
+		size *= top_gmax[i] + 1;
+	    fread_compressed_array(infile,dens,sizeof(double),size);
+	    fread_compressed_array(infile,engy,sizeof(double),size);
+	    for (l = 0; l < dim; ++l)
+		fread_compressed_array(infile,momn[l],sizeof(double),size);
+	}
 
 	switch (dim)
 	{
@@ -1168,13 +1332,17 @@ void G_CARTESIAN::readInteriorStates(char *restart_name)
 		comp = top_comp[index];
 		st_tmp.eos = &(eos[comp]);
 	    	
-		fscanf(infile,"%lf",&dens[index]);
-	    	fscanf(infile,"%lf",&engy[index]);
+		if (!compressed)
+		{
+		    fscanf(infile,"%lf",&dens[index]);
+	    	    fscanf(infile,"%lf",&engy[index]);
+		}
 		st_tmp.dens = dens[index];
 		st_tmp.engy = engy[index];
 		for (l = 0; l < dim; ++l)
 		{
-	    	    fscanf(infile,"%lf",&momn[l][index]);
+	    	    if (!compressed)
+	    	        fscanf(infile,"%lf",&momn[l][index]);
 		    st_tmp.momn[l] = momn[l][index];
 		}
 		pres[index] = EosPressure(&st_tmp);
@@ -1189,28 +1357,153 @@ void G_CARTESIAN::readInteriorStates(char *restart_name)
 		comp = top_comp[index];
 		st_tmp.eos = &(eos[comp]);
 
-	    	fscanf(infile,"%lf",&dens[index]);
-	    	fscanf(infile,"%lf",&engy[index]);
+		if (!compressed)
+		{
+	    	    fscanf(infile,"%lf",&dens[index]);
+	    	    fscanf(infile,"%lf",&engy[index]);
+		}
 		st_tmp.dens = dens[index];
 		st_tmp.engy = engy[index];
 		for (l = 0; l < dim; ++l)
 		{
-	    	    fscanf(infile,"%lf",&momn[l][index]);
+	    	    if (!compressed)
+	    	        fscanf(infile,"%lf",&momn[l][index]);
 		    st_tmp.momn[l] = momn[l][index];
 		}
 		pres[index] = EosPressure(&st_tmp);
 	    }
 	}
-	fclose(infile);
+	if (infile != NULL)
+	    fclose(infile);
 	scatMeshStates();
 	copyMeshStates();
 }
 
+// Fills the interior states of a restart on a different partition from
+// the restart files read by FT_StartUp().  Each mesh point is taken from
+// the file whose interior holds it, points outside of the global domain
+// from the file at that edge.  The buffers are filled by scatMeshStates().
+void G_CARTESIAN::readRepartitionedStates(char *restart_name)
+{
+	F_BASIC_DATA *f_basic = front->f_basic;
+	RECT_GRID *gr = front->rect_grid;
+	RECT_GRID *pgr,dual_gr,ptop_gr;
+	FILE *infile;
+	const char *line;
+	char fname[256];
+	int pmin[3],pmax[3],off[3],pgmax[3],gmax[3];
+	int i,j,k,l,n,id,index,pindex,size,first,last;
+	int num_old_files = 1;
+	double xlo,xhi;
+	double *pdens,*pengy,*pmomn[MAXD];
+
+	for (i = 0; i < dim; ++i)
+	    num_old_files *= f_basic->restart_subdomains[i];
+	for (n = 0; n < f_basic->num_restart_pieces; ++n)
+	{
+	    pgr = &f_basic->restart_piece_grids[n];
+	    set_dual_grid(&dual_gr,pgr);
+	    set_expanded_grid(&dual_gr,&ptop_gr);
+
+	    // Mesh points of this subdomain owned by the piece
+	    size = 1;
+	    for (i = 0; i < 3; ++i)
+	    {
+		pmin[i] = pmax[i] = off[i] = pgmax[i] = gmax[i] = 0;
+		if (i >= dim) continue;
+		xlo = (pgr->L[i] < gr->GL[i] + 0.5*top_h[i]) ?
+			ptop_gr.L[i] : pgr->L[i] + 0.5*top_h[i];
+		xhi = (pgr->U[i] > gr->GU[i] - 0.5*top_h[i]) ?
+			ptop_gr.U[i] : pgr->U[i] - 0.5*top_h[i];
+		off[i] = irint((top_L[i] - ptop_gr.L[i])/top_h[i]);
+		pgmax[i] = ptop_gr.gmax[i];
+		gmax[i] = top_gmax[i];
+		pmin[i] = std::max(irint((xlo - top_L[i])/top_h[i]),0);
+		pmax[i] = std::min(irint((xhi - top_L[i])/top_h[i]),
+				top_gmax[i]);
+		size *= pgmax[i] + 1;
+	    }
+	    if (pmin[0] > pmax[0] || pmin[1] > pmax[1] || pmin[2] > pmax[2])
+		continue;
+
+	    id = f_basic->restart_pieces[n];
+	    if (num_old_files > 1)
+		sprintf(fname,"%s-nd%s-gas",restart_name,right_flush(id,4));
+	    else
+		sprintf(fname,"%s-gas",restart_name);
+	    infile = fopen(fname,"r");
+	    if (infile == NULL)
+	    {
+		screen("ERROR in readRepartitionedStates(), "
+		       "cannot open %s\n",fname);
+		clean_up(ERROR);
+	    }
+	    FT_VectorMemoryAlloc((POINTER*)&pdens,size,sizeof(double));
+	    FT_VectorMemoryAlloc((POINTER*)&pengy,size,sizeof(double));
+	    for (l = 0; l < dim; ++l)
+		FT_VectorMemoryAlloc((POINTER*)&pmomn[l],size,sizeof(double));
+
+	    line = next_output_line_containing_string(infile,
+				"Interior gas states:");
+	    if (line != NULL && strstr(line,"compressed") != NULL)
+	    {
+		// Only the span of planes holding the owned points
+		first = d_index3d(0,pmin[1]+off[1],pmin[2]+off[2],pgmax);
+		last = d_index3d(pgmax[0],pmax[1]+off[1],pmax[2]+off[2],pgmax);
+		fread_compressed_array_range(infile,pdens+first,sizeof(double),
+				first,last-first+1);
+		fread_compressed_array_range(infile,pengy+first,sizeof(double),
+				first,last-first+1);
+		for (l = 0; l < dim; ++l)
+		    fread_compressed_array_range(infile,pmomn[l]+first,
+				sizeof(double),first,last-first+1);
+	    }
+	    else
+	    {
+		for (i = 0; i <= pgmax[0]; ++i)
+		for (j = 0; j <= pgmax[1]; ++j)
+		for (k = 0; k <= pgmax[2]; ++k)
+		{
+		    pindex = d_index3d(i,j,k,pgmax);
+		    fscanf(infile,"%lf",&pdens[pindex]);
+		    fscanf(infile,"%lf",&pengy[pindex]);
+		    for (l = 0; l < dim; ++l)
+			fscanf(infile,"%lf",&pmomn[l][pindex]);
+		}
+	    }
+	    fclose(infile);
+
+	    for (i = pmin[0]; i <= pmax[0]; ++i)
+	    for (j = pmin[1]; j <= pmax[1]; ++j)
+	    for (k = pmin[2]; k <= pmax[2]; ++k)
+	    {
+		index = d_index3d(i,j,k,gmax);
+		pindex = d_index3d(i+off[0],j+off[1],k+off[2],pgmax);
+		field.dens[index] = pdens[pindex];
+		field.engy[index] = pengy[pindex];
+		for (l = 0; l < dim; ++l)
+		    field.momn[l][index] = pmomn[l][pindex];
+	    }
+	    FT_FreeThese(2,pdens,pengy);
+	    for (l = 0; l < dim; ++l)
+		FT_FreeThese(1,pmomn[l]);
+	}
+}
+
 
+// Replaces FT_SetTimeStep() after solve(): the local fluid max_speed
+// left by the stage updates is reduced together with the front time step
+// in a single vector reduction, then max_dt is set from the global speed.
+void G_CARTESIAN::setTimeStep()
+{
+	FT_SetTimeStepWithMaxSpeeds(front,1,&max_speed);
+	setAdvectionDt();
+}	/* end setTimeStep */
+
+// max_speed must already be the global maximum, see setTimeStep()
 void G_CARTESIAN::setAdvectionDt()
 {
 	double d = (double)dim;
-	pp_global_max(&max_speed,1);
 	if (max_speed != 0.0)
 	    max_dt = hmin/max_speed/d;
 	else
@@ -1219,6 +1512,110 @@ void G_CARTESIAN::setAdvectionDt()
 	    printf("In setAdvectionDt: max_dt = %24.18g\n",max_dt);
 }	/* end setAdvectionDt */
 
+// Load balancing by interface density: when the cost of cells and
+// interface elements is out of balance, the subdomain boundaries are
+// moved to the recursive bisection of the cost, a buffer width per pass.
+void G_CARTESIAN::balanceLoad(
+	double front_time,
+	double field_time)
+{
+	int lexpand[MAXD],uexpand[MAXD];
+	double weight = eqn_params->balance_weight;
+
+	if (pp_numnodes() == 1) return;
+	if (weight <= 0.0)
+	    weight = FT_IntfcElementWeight(front,front_time,field_time);
+	if (!FT_BalancePartition(front,weight,eqn_params->balance_tol,
+				balance_cuts))
+	    return;
+
+	start_clock("balanceLoad");
+	while (FT_ShiftSubdomain(front,balance_cuts,lexpand,uexpand))
+	    remapSubdomain(lexpand);
+	stop_clock("balanceLoad");
+}	/* end balanceLoad */
+
+// Moves the mesh storage to the shifted subdomain, whose lower corner
+// moved out by lexpand cells.  The new interior lies in the old interior
+// and buffer zones; the new buffer zones are exchanged.
+void G_CARTESIAN::remapSubdomain(int *lexpand)
+{
+	double *dens = eqn_params->dens;
+	double *engy = eqn_params->engy;
+	double *pres = eqn_params->pres;
+	double *vort = eqn_params->vort;
+	double **mom = eqn_params->mom;
+	double **vel = eqn_params->vel;
+	int ogmax[3] = {0,0,0},gmax[3] = {0,0,0},shift[3] = {0,0,0};
+	int oc[3],i,j,k,l,index,oindex;
+	HDF_MOVIE_VAR *hdf_movie_var = front->hdf_movie_var;
+	boolean make_grid_intfc = (front->grid_intfc == NULL) ? YES : NO;
+
+	if (make_grid_intfc)
+	    FT_MakeGridIntfc(front);
+	for (l = 0; l < dim; ++l)
+	{
+	    ogmax[l] = top_gmax[l];
+	    shift[l] = lexpand[l];
+	}
+	FT_FreeThese(4,eqn_params->gnor,eqn_params->Gdens,
+			eqn_params->Gpres,eqn_params->Gvel);
+	freeRungeKuttaVstFlux();
+	FT_FreeThese(1,array);
+	initComputationalData();
+	for (l = 0; l < dim; ++l)
+	    gmax[l] = top_gmax[l];
+
+	for (k = 0; k <= gmax[2]; ++k)
+	for (j = 0; j <= gmax[1]; ++j)
+	for (i = 0; i <= gmax[0]; ++i)
+	{
+	    oc[0] = i - shift[0];
+	    oc[1] = j - shift[1];
+	    oc[2] = k - shift[2];
+	    for (l = 0; l < 3; ++l)
+		if (oc[l] < 0 || oc[l] > ogmax[l]) break;
+	    if (l < 3) continue;
+	    index = d_index3d(i,j,k,gmax);
+	    oindex = d_index3d(oc[0],oc[1],oc[2],ogmax);
+	    eqn_params->dens[index] = dens[oindex];
+	    eqn_params->engy[index] = engy[oindex];
+	    eqn_params->pres[index] = pres[oindex];
+	    for (l = 0; l < dim; ++l)
+	    {
+		eqn_params->mom[l][index] = mom[l][oindex];
+		eqn_params->vel[l][index] = vel[l][oindex];
+	    }
+	    if (dim == 2)
+		eqn_params->vort[index] = vort[oindex];
+	}
+
+	// Movie variables point into the field arrays
+	for (i = 0; hdf_movie_var != NULL && i < hdf_movie_var->num_var; ++i)
+	{
+	    double *var = hdf_movie_var->top_var[i];
+	    if (var == dens) var = eqn_params->dens;
+	    else if (var == pres) var = eqn_params->pres;
+	    else if (var == engy) var = eqn_params->engy;
+	    else if (dim == 2 && var == vort) var = eqn_params->vort;
+	    for (l = 0; l < dim; ++l)
+	    {
+		if (var == vel[l]) var = eqn_params->vel[l];
+		else if (var == mom[l]) var = eqn_params->mom[l];
+	    }
+	    hdf_movie_var->top_var[i] = var;
+	}
+	FT_FreeThese(5,vel,mom,engy,pres,dens);
+	if (dim == 2)
+	    FT_FreeThese(1,vort);
+
+	setCellCenters();
+	setComponent();
+	copyMeshStates();
+	if (make_grid_intfc)
+	    FT_FreeGridIntfc(front);
+}	/* end remapSubdomain */
+
 
 void G_CARTESIAN::augmentMovieVariables()
 {
@@ -2824,8 +3221,12 @@ void G_CARTESIAN::copyMeshVst(
 		m_vst->dens[index] = m_vst_orig.dens[index];
 		m_vst->engy[index] = m_vst_orig.engy[index];
 		m_vst->pres[index] = m_vst_orig.pres[index];
+		m_vst->csnd[index] = m_vst_orig.csnd[index];
 		for (l = 0; l < dim; ++l)
+		{
 		    m_vst->momn[l][index] = m_vst_orig.momn[l][index];
+		    m_vst->vel[l][index] = m_vst_orig.vel[l][index];
+		}
 	    }
 	    break;
 	case 2:
@@ -2836,8 +3237,12 @@ void G_CARTESIAN::copyMeshVst(
 		m_vst->dens[index] = m_vst_orig.dens[index];
 		m_vst->engy[index] = m_vst_orig.engy[index];
 		m_vst->pres[index] = m_vst_orig.pres[index];
+		m_vst->csnd[index] = m_vst_orig.csnd[index];
 		for (l = 0; l < dim; ++l)
+		{
 		    m_vst->momn[l][index] = m_vst_orig.momn[l][index];
+		    m_vst->vel[l][index] = m_vst_orig.vel[l][index];
+		}
 	    }
 	    break;
 	case 3:
@@ -2849,8 +3254,12 @@ void G_CARTESIAN::copyMeshVst(
 		m_vst->dens[index] = m_vst_orig.dens[index];
 		m_vst->engy[index] = m_vst_orig.engy[index];
 		m_vst->pres[index] = m_vst_orig.pres[index];
+		m_vst->csnd[index] = m_vst_orig.csnd[index];
 		for (l = 0; l < dim; ++l)
+		{
 		    m_vst->momn[l][index] = m_vst_orig.momn[l][index];
+		    m_vst->vel[l][index] = m_vst_orig.vel[l][index];
+		}
 	    }
 	}
 }	/* end copyMeshVst */
@@ -2875,6 +3284,7 @@ void G_CARTESIAN::copyToMeshVst(
 		m_vst->pres[index] = pres[index];
 		for (l = 0; l < dim; ++l)
 		    m_vst->momn[l][index] = momn[l][index];
+		setCellPrimitives(m_vst,index);
 	    }
 	    break;
 	case 2:
@@ -2887,6 +3297,7 @@ void G_CARTESIAN::copyToMeshVst(
 		m_vst->pres[index] = pres[index];
 		for (l = 0; l < dim; ++l)
 		    m_vst->momn[l][index] = momn[l][index];
+		setCellPrimitives(m_vst,index);
 	    }
 	    break;
 	case 3:
@@ -2900,6 +3311,7 @@ void G_CARTESIAN::copyToMeshVst(
 		m_vst->pres[index] = pres[index];
 		for (l = 0; l < dim; ++l)
 		    m_vst->momn[l][index] = momn[l][index];
+		setCellPrimitives(m_vst,index);
 	    }
 	}
 }	/* end copyToMeshVst */
@@ -3454,7 +3866,8 @@ void G_CARTESIAN::scatMeshStates()
 void G_CARTESIAN::freeVst(
 	SWEEP *vst)
 {
-	FT_FreeThese(4,vst->dens,vst->engy,vst->pres,vst->momn);
+	FT_FreeThese(6,vst->dens,vst->engy,vst->pres,vst->momn,vst->vel,
+			vst->csnd);
 }
 
 void G_CARTESIAN::freeFlux(
@@ -3463,17 +3876,15 @@ void G_CARTESIAN::freeFlux(
 	FT_FreeThese(3,flux->dens_flux,flux->engy_flux,flux->momn_flux);
 }
 
+// Add chi times the flux to the conservative variables; the primitive
+// variables are recovered once per stage by recoverPrimitives().
 void G_CARTESIAN::addMeshFluxToVst(
 	SWEEP *m_vst,
 	FSWEEP m_flux,
 	double chi)
 {
 	int 		i,j,k,l,index;
-	double		ke,c,u;
-	EOS_PARAMS	*eos;
-	STATE		st;
 	int		comp;
-	double		temp;
 
 	switch (dim)
 	{
@@ -3490,31 +3901,12 @@ void G_CARTESIAN::addMeshFluxToVst(
 		    	m_vst->momn[l][index] = 0.0; 
 		    continue;
 		}
-		eos = &(eqn_params->eos[comp]);
-
 		m_vst->dens[index] += chi*m_flux.dens_flux[index];
 		m_vst->engy[index] += chi*m_flux.engy_flux[index];
-		ke = u = 0.0;
 		for (l = 0; l < dim; ++l)
-		{
 		    m_vst->momn[l][index] += 
 			chi*m_flux.momn_flux[l][index];
-		    ke += sqr(m_vst->momn[l][index]);
-		    u += sqr(m_vst->momn[l][index]);
-		}
-		
-		CovertVstToState(&st, m_vst, eos, index, dim);
-		checkCorrectForTolerance(&st);
-		m_vst->dens[index] = st.dens;
-		m_vst->pres[index] = st.pres;
-		m_vst->engy[index] = st.engy;
-		u = sqrt(u)/m_vst->dens[index];
-		c = EosSoundSpeed(&st);
-		temp = std::max((std::max(u,fabs(u-c))),(fabs(u+c)));
-                if (max_speed < temp)
-                    max_speed = temp;
-	    }
-	    scatMeshVst(m_vst);
+	    }
 	    break;
 	case 2:
 	    for (j = imin[1]; j <= imax[1]; ++j)
@@ -3530,31 +3922,12 @@ void G_CARTESIAN::addMeshFluxToVst(
 		    	m_vst->momn[l][index] = 0.0; 
 		    continue;
 		}
-		eos = &(eqn_params->eos[comp]);
-
 		m_vst->dens[index] += chi*m_flux.dens_flux[index];
 		m_vst->engy[index] += chi*m_flux.engy_flux[index];
-		ke = u = 0.0;
 		for (l = 0; l < dim; ++l)
-		{
 		    m_vst->momn[l][index] += 
 			chi*m_flux.momn_flux[l][index];
-		    ke += sqr(m_vst->momn[l][index]);
-		    u += sqr(m_vst->momn[l][index]);
-		}
-		
-		CovertVstToState(&st, m_vst, eos, index, dim);
-		checkCorrectForTolerance(&st);
-		m_vst->dens[index] = st.dens;
-		m_vst->pres[index] = st.pres;
-		m_vst->engy[index] = st.engy;
-		u = sqrt(u)/m_vst->dens[index];
-		c = EosSoundSpeed(&st);
-		temp = std::max((std::max(u,fabs(u-c))),(fabs(u+c)));
-                if (max_speed < temp)
-                    max_speed = temp;
-	    }
-	    scatMeshVst(m_vst);
+	    }
 	    break;
 	case 3:
 	    for (k = imin[2]; k <= imax[2]; ++k)
@@ -3562,35 +3935,214 @@ void G_CARTESIAN::addMeshFluxToVst(
 	    for (i = imin[0]; i <= imax[0]; ++i)
 	    {
 		index = d_index3d(i,j,k,top_gmax);
-		comp = top_comp[index];
-		eos = &(eqn_params->eos[comp]);
-
 		m_vst->dens[index] += chi*m_flux.dens_flux[index];
 		m_vst->engy[index] += chi*m_flux.engy_flux[index];
-		ke = u = 0.0;
 		for (l = 0; l < dim; ++l)
-		{
 		    m_vst->momn[l][index] += 
 				chi*m_flux.momn_flux[l][index];
-		    ke += sqr(m_vst->momn[l][index]);
-		    u += sqr(m_vst->momn[l][index]);
-		}
-		
-		CovertVstToState(&st, m_vst, eos, index, dim);
-		checkCorrectForTolerance(&st);
-		m_vst->dens[index] = st.dens;
-		m_vst->pres[index] = st.pres;
-		m_vst->engy[index] = st.engy;
-		u = sqrt(u)/m_vst->dens[index];
-		c = EosSoundSpeed(&st);
-		temp = std::max((std::max(u,fabs(u-c))),(fabs(u+c)));
-                if (max_speed < temp)
-                    max_speed = temp;
-	    }
-	    scatMeshVst(m_vst);
+	    }
 	}
 }	/* end addMeshFluxToVst */
 
+// Fused primitive recovery of a Runge-Kutta stage: pressure (corrected
+// for tolerance), velocity and sound speed of the interior cells in a
+// single pass, together with the maximum wave speed of setAdvectionDt().
+// The line sweeps read these instead of recomputing them per stencil.
+void G_CARTESIAN::recoverPrimitives(
+	SWEEP *m_vst)
+{
+	int 		i,j,k,l,index,comp;
+	int		lo[MAXD],hi[MAXD];
+	double		c,u,temp;
+	EOS_PARAMS	*eos;
+	STATE		st;
+
+	for (l = 0; l < MAXD; ++l)
+	{
+	    lo[l] = (l < dim) ? imin[l] : 0;
+	    hi[l] = (l < dim) ? imax[l] : 0;
+	}
+	for (k = lo[2]; k <= hi[2]; ++k)
+	for (j = lo[1]; j <= hi[1]; ++j)
+	for (i = lo[0]; i <= hi[0]; ++i)
+	{
+	    int ic[MAXD] = {i,j,k};
+
+	    index = d_index(ic,top_gmax,dim);
+	    comp = top_comp[index];
+	    /* As in addMeshFluxToVst(), the 3D solver keeps non-gas cells */
+	    if (dim < 3 && !gas_comp(comp))
+	    {
+		m_vst->csnd[index] = 0.0;
+		for (l = 0; l < dim; ++l)
+		    m_vst->vel[l][index] = 0.0;
+		continue;
+	    }
+	    eos = &(eqn_params->eos[comp]);
+
+	    CovertVstToState(&st, m_vst, eos, index, dim);
+	    checkCorrectForTolerance(&st);
+	    m_vst->dens[index] = st.dens;
+	    m_vst->pres[index] = st.pres;
+	    m_vst->engy[index] = st.engy;
+	    u = 0.0;
+	    for (l = 0; l < dim; ++l)
+	    {
+		u += sqr(m_vst->momn[l][index]);
+		m_vst->vel[l][index] = m_vst->momn[l][index]/st.dens;
+	    }
+	    u = sqrt(u)/m_vst->dens[index];
+	    c = m_vst->csnd[index] = EosSoundSpeed(&st);
+	    temp = std::max((std::max(u,fabs(u-c))),(fabs(u+c)));
+	    if (max_speed < temp)
+		max_speed = temp;
+	}
+	scatMeshVst(m_vst);
+}	/* end recoverPrimitives */
+
+// Velocity and sound speed of a cell from its current pressure
+void G_CARTESIAN::setCellPrimitives(
+	SWEEP *m_vst,
+	int index)
+{
+	COMPONENT comp = top_comp[index];
+	double dens = m_vst->dens[index];
+	STATE st;
+	int l;
+
+	if (!gas_comp(comp) || dens <= 0.0)
+	{
+	    m_vst->csnd[index] = 0.0;
+	    for (l = 0; l < dim; ++l)
+		m_vst->vel[l][index] = 0.0;
+	    return;
+	}
+	st.dens = dens;
+	st.pres = m_vst->pres[index];
+	st.eos = &(eqn_params->eos[comp]);
+	m_vst->csnd[index] = EosSoundSpeed(&st);
+	for (l = 0; l < dim; ++l)
+	    m_vst->vel[l][index] = m_vst->momn[l][index]/dens;
+}	/* end setCellPrimitives */
+
+static inline void lowStorageStageUpdate(
+	double &q1,
+	double &q0,
+	double flux,
+	const LS_RK_STAGE &stage)
+{
+	q1 = stage.a*q0 + stage.b*q1 + stage.c*flux;
+	if (stage.mix)
+	{
+	    q0 = stage.mix_q0[0]*q0 + stage.mix_q0[1]*q1;
+	    q1 = stage.mix_q1[0]*q0 + stage.mix_q1[1]*q1;
+	}
+}
+
+// Stage update of the low storage schemes: combines the registers with
+// the stage flux, the primitives are recovered by recoverPrimitives().
+void G_CARTESIAN::updateMeshVstLowStorage(
+	SWEEP *q1,
+	SWEEP *q0,
+	FSWEEP m_flux,
+	const LS_RK_STAGE &stage)
+{
+	int 		i,j,k,l,index,comp;
+	int		lo[MAXD],hi[MAXD];
+
+	for (l = 0; l < MAXD; ++l)
+	{
+	    lo[l] = (l < dim) ? imin[l] : 0;
+	    hi[l] = (l < dim) ? imax[l] : 0;
+	}
+	for (k = lo[2]; k <= hi[2]; ++k)
+	for (j = lo[1]; j <= hi[1]; ++j)
+	for (i = lo[0]; i <= hi[0]; ++i)
+	{
+	    int ic[MAXD] = {i,j,k};
+
+	    index = d_index(ic,top_gmax,dim);
+	    comp = top_comp[index];
+	    /* As in addMeshFluxToVst(), the 3D solver keeps non-gas cells */
+	    if (dim < 3 && !gas_comp(comp))
+	    {
+		q1->dens[index] = 0.0;
+		q1->engy[index] = 0.0;
+		for (l = 0; l < dim; ++l)
+		    q1->momn[l][index] = 0.0;
+		continue;
+	    }
+	    lowStorageStageUpdate(q1->dens[index],q0->dens[index],
+				m_flux.dens_flux[index],stage);
+	    lowStorageStageUpdate(q1->engy[index],q0->engy[index],
+				m_flux.engy_flux[index],stage);
+	    for (l = 0; l < dim; ++l)
+		lowStorageStageUpdate(q1->momn[l][index],q0->momn[l][index],
+				m_flux.momn_flux[l][index],stage);
+	}
+}	/* end updateMeshVstLowStorage */
+
+void G_CARTESIAN::clearGhostStateCache()
+{
+	ghost_crx_cache.clear();
+	ghost_crx_intfc = front->grid_intfc;
+}	/* end clearGhostStateCache */
+
+// FT_StateStructAtGridCrossing() memoized for appendGhostBuffer(): the
+// same crossings are requested on every Runge-Kutta stage and from both
+// sweeps through a cell.  Lookups off the topological grid bypass the
+// cache, and the cache is dropped whenever the grid interface changes.
+boolean G_CARTESIAN::ghostStateAtGridCrossing(
+	int *icoords,
+	GRID_DIRECTION dir,
+	COMPONENT comp,
+	STATE **state,
+	HYPER_SURF **hs,
+	double *crx_coords)
+{
+	INTERFACE *grid_intfc = front->grid_intfc;
+	int i,side;
+	long key;
+
+	switch (dir)
+	{
+	case EAST:	side = 0;	break;
+	case WEST:	side = 1;	break;
+	case NORTH:	side = 2;	break;
+	case SOUTH:	side = 3;	break;
+	case UPPER:	side = 4;	break;
+	case LOWER:	side = 5;	break;
+	default:	side = -1;
+	}
+	for (i = 0; i < dim; ++i)
+	    if (icoords[i] < 0 || icoords[i] > top_gmax[i])
+		side = -1;
+	if (side == -1 || comp < 0 || comp >= MAX_COMP)
+	    return FT_StateStructAtGridCrossing(front,grid_intfc,icoords,
+				dir,comp,(POINTER*)state,hs,crx_coords);
+
+	if (grid_intfc != ghost_crx_intfc)
+	    clearGhostStateCache();
+
+	key = ((long)d_index(icoords,top_gmax,dim)*6 + side)*MAX_COMP + comp;
+	auto it = ghost_crx_cache.find(key);
+	if (it == ghost_crx_cache.end())
+	{
+	    GHOST_CRX crx;
+	    crx.status = FT_StateStructAtGridCrossing(front,grid_intfc,
+				icoords,dir,comp,(POINTER*)&crx.state,&crx.hs,
+				crx.crx_coords);
+	    it = ghost_crx_cache.emplace(key,crx).first;
+	}
+	if (!it->second.status)
+	    return NO;
+	*state = it->second.state;
+	*hs = it->second.hs;
+	for (i = 0; i < dim; ++i)
+	    crx_coords[i] = it->second.crx_coords[i];
+	return YES;
+}	/* end ghostStateAtGridCrossing */
+
 void G_CARTESIAN::appendGhostBuffer(
 	SWEEP *vst,
 	SWEEP *m_vst,
@@ -3609,7 +4161,6 @@ void G_CARTESIAN::appendGhostBuffer(
 	int		ind2[2][2] = {{0,1},{1,0}};
 	int		ind3[3][3] = {{0,1,2},{1,2,0},{2,0,1}};
 	int 		ic_next[MAXD];
-	INTERFACE	*grid_intfc = front->grid_intfc;
 	static int count = 0;
 	count++;
 	boolean Debug = NO;
@@ -3657,8 +4208,8 @@ void G_CARTESIAN::appendGhostBuffer(
                 ic_next[k] = ic[k];
 
             ic_next[idir]++;
-		    status = FT_StateStructAtGridCrossing(front,grid_intfc,
-				ic_next,ldir[idir],comp,(POINTER*)&state,&hs,crx_coords);
+		    status = ghostStateAtGridCrossing(ic_next,ldir[idir],comp,
+				&state,&hs,crx_coords);
 		    
             //extreme cases
             if (!status)
@@ -3671,8 +4222,7 @@ void G_CARTESIAN::appendGhostBuffer(
                 for (k = 0; k < dim; ++k)
                                 ic_tmp[k] = ic[k];
                             ic_tmp[idir]--;
-                status = FT_StateStructAtGridCrossing(front,grid_intfc,
-                        ic_tmp,rdir[idir],comp,(POINTER*)&state,
+                status = ghostStateAtGridCrossing(ic_tmp,rdir[idir],comp,&state,
                         &hs,crx_coords);
 
                 if(!status)
@@ -3682,8 +4232,8 @@ void G_CARTESIAN::appendGhostBuffer(
                         ic_tmp[k] = ic[k];
 
                     ic_tmp[idir] += 2;
-                    status = FT_StateStructAtGridCrossing(front,grid_intfc,
-                            ic_tmp,ldir[idir],comp,(POINTER*)&state,&hs,crx_coords);
+                    status = ghostStateAtGridCrossing(ic_tmp,ldir[idir],
+                            comp,&state,&hs,crx_coords);
 
                     if (!status)
                     {
@@ -3815,8 +4365,7 @@ void G_CARTESIAN::appendGhostBuffer(
 		    for (k = 0; k < dim; ++k)
 			ic_next[k] = ic[k];
 		    ic_next[idir]--;
-		    status = FT_StateStructAtGridCrossing(front,grid_intfc,
-				ic_next,rdir[idir],comp,(POINTER*)&state,
+		    status = ghostStateAtGridCrossing(ic_next,rdir[idir],comp,&state,
 				&hs,crx_coords);
 		    if (!status) /* extreme cases */
 		    {
@@ -3828,8 +4377,7 @@ void G_CARTESIAN::appendGhostBuffer(
 			for (k = 0; k < dim; ++k)
                             ic_tmp[k] = ic[k];
                         ic_tmp[idir]++;
-			status = FT_StateStructAtGridCrossing(front,grid_intfc,
-					ic_tmp,ldir[idir],comp,(POINTER*)&state,
+			status = ghostStateAtGridCrossing(ic_tmp,ldir[idir],comp,&state,
 					&hs,crx_coords);
 			if(!status)
 			{
@@ -3837,9 +4385,8 @@ void G_CARTESIAN::appendGhostBuffer(
 			    for (k = 0; k < dim; ++k)
                                 ic_tmp[k] = ic[k];
                             ic_tmp[idir] -= 2;
-                            status = FT_StateStructAtGridCrossing(front,
-                                        grid_intfc,ic_tmp,rdir[idir],comp,
-                                        (POINTER*)&state,&hs,crx_coords);
+                            status = ghostStateAtGridCrossing(ic_tmp,
+                                        rdir[idir],comp,&state,&hs,crx_coords);
 			    if (!status)
 			    {
 				/* must be something wrong */
@@ -4286,13 +4833,25 @@ void G_CARTESIAN::get_normal_from_front()
 	boolean			found;
 	double			**gnor = eqn_params->gnor;
 	static	int		***norset;
+	static	int		norset_size[3];
 	int ict[3];
 	double ptt[3];
 	boolean status;
 
+	/* Subdomain may be resized by load balancing */
+	if (norset != NULL && (top_gmax[0] >= norset_size[0] ||
+		top_gmax[1] >= norset_size[1] || top_gmax[2] >= norset_size[2]))
+	{
+	    FT_FreeThese(1,norset);
+	    norset = NULL;
+	}
 	if (norset == NULL)
+	{
+	    for (i = 0; i < 3; ++i)
+		norset_size[i] = top_gmax[i]+1;
 	    FT_TriArrayMemoryAlloc((POINTER*)&norset,top_gmax[0]+1,
 				top_gmax[1]+1,top_gmax[2]+1,INT);
+	}
 
 	tol = hmin*1.0e-6;
 
@@ -4841,18 +5400,26 @@ void G_CARTESIAN::get_ghost_state(
 	double			**Gdens = eqn_params->Gdens;
 	double			**Gpres = eqn_params->Gpres;
 	static	int		***norset;
+	static	int		norset_size = 0;
 	static 	int 		loop_count = 0;
 	std::list<ToFill> resetThese;
 	std::list<ToFill> fillThese;
+	int ft_vec_size = 0;
 
+	for (i = 0; i < dim; ++i)
+	{
+	    if (top_gmax[i]+8 > ft_vec_size)
+		ft_vec_size = top_gmax[i]+8;
+	}
+	/* Subdomain may be resized by load balancing */
+	if (norset != NULL && ft_vec_size > norset_size)
+	{
+	    FT_FreeThese(1,norset);
+	    norset = NULL;
+	}
 	if (norset == NULL)
 	{
-	    int ft_vec_size = 0;
-	    for (i = 0; i < dim; ++i)
-	    {
-		if (top_gmax[i]+8 > ft_vec_size)
-		    ft_vec_size = top_gmax[i]+8;
-	    }
+	    norset_size = ft_vec_size;
 	    if(dim == 1)
 	    	FT_TriArrayMemoryAlloc((POINTER*)&norset,ft_vec_size,
 				   1,1,INT);
@@ -5451,10 +6018,14 @@ void G_CARTESIAN::addFluxAlongGridLine(
 	    	vst.dens[i] = 0.0; 
 	    	vst.pres[i] = 0.0; 
 	    	vst.engy[i] = 0.0; 
+	    	vst.csnd[i] = 0.0; 
 	    
             vst.momn[0][i] = 0.0;
             vst.momn[1][i] = 0.0;
             vst.momn[2][i] = 0.0;
+            vst.vel[0][i] = 0.0;
+            vst.vel[1][i] = 0.0;
+            vst.vel[2][i] = 0.0;
 	    }
 
 	    icoords[idir] = seg_min;
@@ -5464,12 +6035,19 @@ void G_CARTESIAN::addFluxAlongGridLine(
         vst.dens[nrad] = m_vst->dens[index];
         vst.engy[nrad] = m_vst->engy[index];
         vst.pres[nrad] = m_vst->pres[index];
+        vst.csnd[nrad] = m_vst->csnd[index];
 
 	    for (int l = 0; l < dim; ++l)
+        {
             	vst.momn[l][nrad] = m_vst->momn[(l+idir)%dim][index];
+            	vst.vel[l][nrad] = m_vst->vel[(l+idir)%dim][index];
+        }
 	
         for (int l = dim; l < 3; ++l)
+        {
             	vst.momn[l][nrad] = 0.0;
+            	vst.vel[l][nrad] = 0.0;
+        }
 
         
         int n = 1;
@@ -5487,12 +6065,19 @@ void G_CARTESIAN::addFluxAlongGridLine(
                 vst.dens[n+nrad] = m_vst->dens[index];
                 vst.engy[n+nrad] = m_vst->engy[index];
                 vst.pres[n+nrad] = m_vst->pres[index];
+                vst.csnd[n+nrad] = m_vst->csnd[index];
     
                 for (int l = 0; l < dim; ++l)
+                {
                         vst.momn[l][n+nrad] = m_vst->momn[(l+idir)%dim][index];
+                        vst.vel[l][n+nrad] = m_vst->vel[(l+idir)%dim][index];
+                }
 
                 for (int l = dim; l < 3; ++l)
+                {
                         vst.momn[l][n+nrad] = 0.0;
+                        vst.vel[l][n+nrad] = 0.0;
+                }
                 n++;
             }
 	
@@ -5516,6 +6101,19 @@ void G_CARTESIAN::addFluxAlongGridLine(
 	    eos = &(eqn_params->eos[comp]);
 	    EosSetTVDParams(&scheme_params, eos);
 
+        // Ghost entries come from the boundary or the interface, their
+        // velocity and sound speed are not stored on the mesh
+        for (int i = 0; i < nrad; ++i)
+        {
+            int ig[2] = {i,n+nrad+i};
+            for (int m = 0; m < 2; ++m)
+            for (int l = 0; l < 3; ++l)
+                vst.vel[l][ig[m]] = vst.momn[l][ig[m]]/vst.dens[ig[m]];
+        }
+        EosBatchSoundSpeed(eos,nrad,vst.dens,vst.pres,vst.csnd);
+        EosBatchSoundSpeed(eos,nrad,vst.dens+n+nrad,vst.pres+n+nrad,
+                        vst.csnd+n+nrad);
+
 	    numericalFlux((POINTER)&scheme_params,&vst,&vflux,n);
         
 
@@ -23,17 +23,44 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 
 #include <cFluid.h>
 
+#include "cFeos.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define	EOS_TABLE_MAGIC		"FTEOSTB1"
+#define	MAX_EOS_TABLES		MAX_COMP
+
+static EOS_TABLE *eos_tables[MAX_EOS_TABLES];
+static int num_eos_tables = 0;
+
+/*
+*	Choose the model of the component: its table if one was loaded,
+*	otherwise the cheapest model that reproduces the stiffened gas
+*	parameters.  Called once after the parameters have been read.
+*/
+
+extern void EosSetType(
+	EOS_PARAMS	*eos)
+{
+	if (eos->table != NULL)
+	    eos->type = TABULATED_EOS;
+	else if (eos->pinf == 0.0 && eos->einf == 0.0)
+	    eos->type = IDEAL_GAS_EOS;
+	else
+	    eos->type = STIFFENED_GAS_EOS;
+}	/* end EosSetType */
+
 extern double EosPressure(
 	STATE *state)
 {
 	double 		dens = state->dens;
-	double 		engy = state->engy;
 	double 		*momn = state->momn;
 	double 		ke,pres;
 	int		i;
 	int		dim = state->dim;
 	EOS_PARAMS	*eos = state->eos;
-	double		gamma = eos->gamma;
 
 	if (dens <= 0.0)
 	    return 0.0;
@@ -41,7 +68,18 @@ extern double EosPressure(
 	for (i = 0; i < dim; ++i)
 	    ke += sqr(momn[i]);
 	ke *= 0.5/dens;
-	pres = (gamma - 1.0)*(engy - ke + dens*eos->einf) - gamma*eos->pinf;
+	switch (eos->type)
+	{
+	case IDEAL_GAS_EOS:
+	    pres = IDEAL_GAS_EOS_MODEL::pressure(eos,dens,state->engy,ke);
+	    break;
+	case TABULATED_EOS:
+	    pres = TABULATED_EOS_MODEL::pressure(eos,dens,state->engy,ke);
+	    break;
+	case STIFFENED_GAS_EOS:
+	default:
+	    pres = STIFFENED_GAS_EOS_MODEL::pressure(eos,dens,state->engy,ke);
+	}
 	
 	return pres;
 }	/* end EosPressure */
@@ -49,11 +87,24 @@ extern double EosPressure(
 extern double EosSoundSpeedSqr(
 	STATE *state)
 {
-	double		pres = state->pres;
 	double		dens = state->dens;
+	double		pres = state->pres;
 	EOS_PARAMS	*eos = state->eos;
-	
-	return eos->gamma*(pres + eos->pinf)/dens;
+	double		c2;
+
+	switch (eos->type)
+	{
+	case IDEAL_GAS_EOS:
+	    c2 = IDEAL_GAS_EOS_MODEL::soundSpeedSqr(eos,dens,pres);
+	    break;
+	case TABULATED_EOS:
+	    c2 = TABULATED_EOS_MODEL::soundSpeedSqr(eos,dens,pres);
+	    break;
+	case STIFFENED_GAS_EOS:
+	default:
+	    c2 = STIFFENED_GAS_EOS_MODEL::soundSpeedSqr(eos,dens,pres);
+	}
+	return c2;
 }
 
 extern double EosSoundSpeed(
@@ -65,12 +116,24 @@ extern double EosSoundSpeed(
 extern double EosInternalEnergy(
 	STATE *state)
 {
-	double		pres = state->pres;
 	double		dens = state->dens;
+	double		pres = state->pres;
 	EOS_PARAMS	*eos = state->eos;
-	double		gamma = eos->gamma;
+	double		e;
 
-	return (pres+gamma*eos->pinf)/(gamma-1) - dens*eos->einf;
+	switch (eos->type)
+	{
+	case IDEAL_GAS_EOS:
+	    e = IDEAL_GAS_EOS_MODEL::internalEnergy(eos,dens,pres);
+	    break;
+	case TABULATED_EOS:
+	    e = TABULATED_EOS_MODEL::internalEnergy(eos,dens,pres);
+	    break;
+	case STIFFENED_GAS_EOS:
+	default:
+	    e = STIFFENED_GAS_EOS_MODEL::internalEnergy(eos,dens,pres);
+	}
+	return e;
 }
 
 extern double EosEnergy(
@@ -130,5 +193,199 @@ extern void EosSetTVDParams(
 {
 	scheme_params->gamma = eos->gamma;
 	scheme_params->einf = eos->einf;
+	scheme_params->eos = eos;
 }
 
+/*
+*	Batch entry points: one model selection per call, the loops over
+*	the n cells are those of EOS_BATCH<MODEL> in cFeos.h.
+*/
+
+extern void EosBatchPressure(
+	EOS_PARAMS	*eos,
+	int		n,
+	int		dim,
+	const double	*dens,
+	const double	*engy,
+	double		*const *momn,
+	double		*pres)
+{
+	switch (eos->type)
+	{
+	case IDEAL_GAS_EOS:
+	    EOS_BATCH<IDEAL_GAS_EOS_MODEL>::pressure(eos,n,dim,dens,engy,momn,pres);
+	    break;
+	case TABULATED_EOS:
+	    EOS_BATCH<TABULATED_EOS_MODEL>::pressure(eos,n,dim,dens,engy,
+				momn,pres);
+	    break;
+	case STIFFENED_GAS_EOS:
+	default:
+	    EOS_BATCH<STIFFENED_GAS_EOS_MODEL>::pressure(eos,n,dim,dens,engy,
+				momn,pres);
+	}
+}	/* end EosBatchPressure */
+
+extern void EosBatchSoundSpeed(
+	EOS_PARAMS	*eos,
+	int		n,
+	const double	*dens,
+	const double	*pres,
+	double		*c)
+{
+	switch (eos->type)
+	{
+	case IDEAL_GAS_EOS:
+	    EOS_BATCH<IDEAL_GAS_EOS_MODEL>::soundSpeed(eos,n,dens,pres,c);
+	    break;
+	case TABULATED_EOS:
+	    EOS_BATCH<TABULATED_EOS_MODEL>::soundSpeed(eos,n,dens,pres,c);
+	    break;
+	case STIFFENED_GAS_EOS:
+	default:
+	    EOS_BATCH<STIFFENED_GAS_EOS_MODEL>::soundSpeed(eos,n,dens,pres,c);
+	}
+}	/* end EosBatchSoundSpeed */
+
+extern void EosBatchEnergy(
+	EOS_PARAMS	*eos,
+	int		n,
+	int		dim,
+	const double	*dens,
+	const double	*pres,
+	double		*const *momn,
+	double		*engy)
+{
+	switch (eos->type)
+	{
+	case IDEAL_GAS_EOS:
+	    EOS_BATCH<IDEAL_GAS_EOS_MODEL>::energy(eos,n,dim,dens,pres,momn,engy);
+	    break;
+	case TABULATED_EOS:
+	    EOS_BATCH<TABULATED_EOS_MODEL>::energy(eos,n,dim,dens,pres,
+				momn,engy);
+	    break;
+	case STIFFENED_GAS_EOS:
+	default:
+	    EOS_BATCH<STIFFENED_GAS_EOS_MODEL>::energy(eos,n,dim,dens,pres,
+				momn,engy);
+	}
+}	/* end EosBatchEnergy */
+
+/*
+*	Map the EOS table file fname, see cFeos.h for its layout.  A file
+*	already loaded by this process is not mapped again.  The mapping
+*	is read only and shared, so the processes of a node share the
+*	pages of the table instead of each holding a copy.
+*/
+
+extern EOS_TABLE *EosLoadTable(
+	const char	*fname,
+	int		interp)
+{
+	EOS_TABLE	*table;
+	struct stat	st;
+	const char	*base;
+	int		i,fd,nrho,ne;
+	size_t		size;
+	boolean		increasing;
+
+	for (i = 0; i < num_eos_tables; ++i)
+	{
+	    if (strcmp(eos_tables[i]->fname,fname) == 0 &&
+		eos_tables[i]->interp == interp)
+		return eos_tables[i];
+	}
+	if (num_eos_tables == MAX_EOS_TABLES ||
+	    strlen(fname) >= sizeof(table->fname))
+	{
+	    screen("ERROR in EosLoadTable(), cannot load table %s\n",fname);
+	    clean_up(ERROR);
+	}
+
+	fd = open(fname,O_RDONLY);
+	if (fd < 0 || fstat(fd,&st) != 0)
+	{
+	    screen("ERROR in EosLoadTable(), cannot open %s\n",fname);
+	    clean_up(ERROR);
+	}
+	size = (size_t)st.st_size;
+	base = (const char*)mmap(NULL,size,PROT_READ,MAP_SHARED,fd,0);
+	close(fd);
+	if (base == (const char*)MAP_FAILED)
+	{
+	    screen("ERROR in EosLoadTable(), cannot map %s\n",fname);
+	    clean_up(ERROR);
+	}
+	if (size < 16 || strncmp(base,EOS_TABLE_MAGIC,8) != 0)
+	{
+	    screen("ERROR in EosLoadTable(), %s is not an EOS table\n",fname);
+	    clean_up(ERROR);
+	}
+	memcpy(&nrho,base+8,sizeof(int));
+	memcpy(&ne,base+12,sizeof(int));
+	if (nrho < 2 || ne < 2 || size != 16 + sizeof(double)*
+			((size_t)nrho + ne + 2*(size_t)nrho*ne))
+	{
+	    screen("ERROR in EosLoadTable(), inconsistent size of %s\n",fname);
+	    clean_up(ERROR);
+	}
+
+	FT_ScalarMemoryAlloc((POINTER*)&table,sizeof(EOS_TABLE));
+	strcpy(table->fname,fname);
+	table->interp = interp;
+	table->nrho = nrho;
+	table->ne = ne;
+	table->rho = (const double*)(base + 16);
+	table->e = table->rho + nrho;
+	table->p = table->e + ne;
+	table->c2 = table->p + nrho*ne;
+	table->map = (void*)base;
+	table->map_size = size;
+	increasing = YES;
+	for (i = 0; i < nrho-1; ++i)
+	    if (!(table->rho[i] < table->rho[i+1]))
+		increasing = NO;
+	for (i = 0; i < ne-1; ++i)
+	    if (!(table->e[i] < table->e[i+1]))
+		increasing = NO;
+	if (!increasing)
+	{
+	    screen("ERROR in EosLoadTable(), axes of %s not increasing\n",
+				fname);
+	    clean_up(ERROR);
+	}
+	eos_tables[num_eos_tables++] = table;
+	return table;
+}	/* end EosLoadTable */
+
+extern void EosWriteTable(
+	const char	*fname,
+	int		nrho,
+	int		ne,
+	const double	*rho,
+	const double	*e,
+	const double	*p,
+	const double	*c2)
+{
+	FILE	*file;
+	size_t	n = (size_t)nrho*ne;
+
+	if ((file = fopen(fname,"wb")) == NULL)
+	{
+	    screen("ERROR in EosWriteTable(), cannot open %s\n",fname);
+	    clean_up(ERROR);
+	}
+	if (fwrite(EOS_TABLE_MAGIC,1,8,file) != 8 ||
+	    fwrite(&nrho,sizeof(int),1,file) != 1 ||
+	    fwrite(&ne,sizeof(int),1,file) != 1 ||
+	    fwrite(rho,sizeof(double),nrho,file) != (size_t)nrho ||
+	    fwrite(e,sizeof(double),ne,file) != (size_t)ne ||
+	    fwrite(p,sizeof(double),n,file) != n ||
+	    fwrite(c2,sizeof(double),n,file) != n)
+	{
+	    screen("ERROR in EosWriteTable(), cannot write %s\n",fname);
+	    clean_up(ERROR);
+	}
+	fclose(file);
+}	/* end EosWriteTable */
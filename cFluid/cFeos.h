@@ -0,0 +1,406 @@
+/***************************************************************
+FronTier is a set of libraries that implements different types of
+Front Traking algorithms. Front Tracking is a numerical method for
+the solution of partial differential equations whose solutions have
+discontinuities.
+
+Copyright (C) 1999 by The University at Stony Brook.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+****************************************************************/
+
+/*
+*				cFeos.h:
+*
+*	Equation of state models of the compressible solver.
+*
+*	Each model is a struct of static inline functions of a single
+*	cell.  EOS_BATCH<MODEL> evaluates a model over arrays of cells
+*	and is specialized at compile time, so its loops carry no
+*	per-cell dispatch.  The extern EosBatch*() functions of cFeos.cpp
+*	select the model from EOS_PARAMS::type once per batch.
+*
+*	A new material needs an EOS_TYPE, a model struct with the
+*	members below and a case in the dispatch of cFeos.cpp.
+*
+*	TABULATED_EOS_MODEL interpolates p(rho,e) and c^2(rho,e) from a
+*	table on a rectilinear (rho,e) grid, e being the specific internal
+*	energy.  The binary file, written by EosWriteTable(), is
+*
+*		char	magic[8]		"FTEOSTB1"
+*		int	nrho, ne
+*		double	rho[nrho], e[ne]	strictly increasing axes
+*		double	p[ne][nrho], c2[ne][nrho]
+*
+*	EosLoadTable() maps it read only and shared, so all processes of
+*	a node use the same pages, and loads each file only once.
+*/
+
+#if !defined(_CFEOS_H)
+#define _CFEOS_H
+
+/* Stiffened gas: p = (gamma-1)*(rho*e + rho*einf) - gamma*pinf */
+struct STIFFENED_GAS_EOS_MODEL
+{
+    /* ke is the kinetic energy per unit volume */
+    static inline double pressure(
+	const EOS_PARAMS *eos,
+	double dens,
+	double engy,
+	double ke)
+    {
+	return (eos->gamma - 1.0)*(engy - ke + dens*eos->einf) -
+			eos->gamma*eos->pinf;
+    }
+
+    static inline double soundSpeedSqr(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres)
+    {
+	return eos->gamma*(pres + eos->pinf)/dens;
+    }
+
+    static inline double internalEnergy(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres)
+    {
+	return (pres + eos->gamma*eos->pinf)/(eos->gamma - 1) -
+			dens*eos->einf;
+    }
+
+    /* Specific total enthalpy (E + p)/rho, q2 is the velocity squared */
+    static inline double enthalpy(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres,
+	double q2)
+    {
+	return 0.5*q2 + eos->gamma*(pres + eos->pinf)/(eos->gamma - 1.0)/dens
+			- eos->einf;
+    }
+};
+
+/* Polytropic ideal gas, the stiffened gas with pinf = einf = 0 */
+struct IDEAL_GAS_EOS_MODEL
+{
+    static inline double pressure(
+	const EOS_PARAMS *eos,
+	double dens,
+	double engy,
+	double ke)
+    {
+	return (eos->gamma - 1.0)*(engy - ke);
+    }
+
+    static inline double soundSpeedSqr(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres)
+    {
+	return eos->gamma*pres/dens;
+    }
+
+    static inline double internalEnergy(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres)
+    {
+	return pres/(eos->gamma - 1);
+    }
+
+    static inline double enthalpy(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres,
+	double q2)
+    {
+	return 0.5*q2 + eos->gamma*pres/(eos->gamma - 1.0)/dens;
+    }
+};
+
+struct EOS_TABLE
+{
+    char	   fname[256];
+    int		   interp;		/* EOS_TABLE_INTERP */
+    int		   nrho, ne;
+    const double   *rho, *e;		/* axes */
+    const double   *p, *c2;		/* values, rho index fastest */
+    void	   *map;		/* mapped file */
+    size_t	   map_size;
+};
+
+/*
+*	Cell of the last lookup of the calling thread.  Consecutive
+*	lookups of a sweep mostly fall in the same or a neighboring cell,
+*	so the hint avoids the binary search of the axes.
+*/
+
+struct EOS_TABLE_HINT
+{
+    const EOS_TABLE *table;
+    int i, j;
+};
+
+inline EOS_TABLE_HINT *eos_table_hint(
+	const EOS_TABLE *table)
+{
+	static thread_local EOS_TABLE_HINT hint = {NULL, 0, 0};
+
+	if (hint.table != table)
+	{
+	    hint.table = table;
+	    hint.i = hint.j = 0;
+	}
+	return &hint;
+}
+
+/* k with x[k] <= v < x[k+1], clamped to [0,n-2], tried first at hint */
+inline int eos_table_locate(
+	const double *x,
+	int n,
+	double v,
+	int hint)
+{
+	int lo,hi,mid;
+
+	if (x[hint] <= v && v < x[hint+1])
+	    return hint;
+	if (hint+2 < n && x[hint+1] <= v && v < x[hint+2])
+	    return hint+1;
+	if (hint > 0 && x[hint-1] <= v && v < x[hint])
+	    return hint-1;
+	if (v < x[1])
+	    return 0;
+	if (v >= x[n-2])
+	    return n-2;
+	lo = 1;		hi = n-2;
+	while (hi - lo > 1)
+	{
+	    mid = (lo + hi)/2;
+	    if (x[mid] <= v)
+		lo = mid;
+	    else
+		hi = mid;
+	}
+	return lo;
+}
+
+/* Catmull-Rom weights of the points k-1, k, k+1, k+2 at t in [0,1) */
+inline void eos_table_cubic_weights(
+	double t,
+	double *w)
+{
+	double t2 = t*t, t3 = t2*t;
+
+	w[0] = 0.5*(-t + 2.0*t2 - t3);
+	w[1] = 0.5*(2.0 - 5.0*t2 + 3.0*t3);
+	w[2] = 0.5*(t + 4.0*t2 - 3.0*t3);
+	w[3] = 0.5*(-t2 + t3);
+}
+
+/* Interpolate f of table at (rho,e); outside the table f is extrapolated */
+inline double eos_table_value(
+	const EOS_TABLE *table,
+	const double *f,
+	double rho,
+	double e)
+{
+	EOS_TABLE_HINT *hint = eos_table_hint(table);
+	int nrho = table->nrho, ne = table->ne;
+	int i,j,k,l,ik,jl;
+	double t,u,v;
+
+	i = hint->i = eos_table_locate(table->rho,nrho,rho,hint->i);
+	j = hint->j = eos_table_locate(table->e,ne,e,hint->j);
+	t = (rho - table->rho[i])/(table->rho[i+1] - table->rho[i]);
+	u = (e - table->e[j])/(table->e[j+1] - table->e[j]);
+
+	if (table->interp != EOS_TABLE_BICUBIC)
+	    return (1.0 - u)*((1.0 - t)*f[j*nrho+i] + t*f[j*nrho+i+1]) +
+			u*((1.0 - t)*f[(j+1)*nrho+i] + t*f[(j+1)*nrho+i+1]);
+
+	double wt[4],wu[4];
+	eos_table_cubic_weights(t,wt);
+	eos_table_cubic_weights(u,wu);
+	v = 0.0;
+	if (i > 0 && i < nrho-2 && j > 0 && j < ne-2)
+	{
+	    const double *fr = f + (j-1)*nrho + i-1;
+	    for (l = 0; l < 4; ++l, fr += nrho)
+		v += wu[l]*(wt[0]*fr[0] + wt[1]*fr[1] + wt[2]*fr[2] +
+				wt[3]*fr[3]);
+	    return v;
+	}
+	for (l = 0; l < 4; ++l)
+	{
+	    double row = 0.0;
+	    jl = std::min(std::max(j+l-1,0),ne-1);
+	    for (k = 0; k < 4; ++k)
+	    {
+		ik = std::min(std::max(i+k-1,0),nrho-1);
+		row += wt[k]*f[jl*nrho+ik];
+	    }
+	    v += wu[l]*row;
+	}
+	return v;
+}
+
+/*
+*	Specific internal energy with p(rho,e) = pres.  The pressure must
+*	increase with e.  Along the bilinear interpolant in rho the
+*	inversion is exact; bicubic tables add a Newton step with the
+*	slope of the bracketing cell.
+*/
+
+inline double eos_table_energy(
+	const EOS_TABLE *table,
+	double rho,
+	double pres)
+{
+	EOS_TABLE_HINT *hint = eos_table_hint(table);
+	int nrho = table->nrho, ne = table->ne;
+	const double *p = table->p;
+	const double *E = table->e;
+	int i,j,lo,hi,mid;
+	double t,p0,p1,e,slope;
+
+	i = hint->i = eos_table_locate(table->rho,nrho,rho,hint->i);
+	t = (rho - table->rho[i])/(table->rho[i+1] - table->rho[i]);
+#define	p_at(jj)	((1.0 - t)*p[(jj)*nrho+i] + t*p[(jj)*nrho+i+1])
+	j = hint->j;
+	p0 = p_at(j);	p1 = p_at(j+1);
+	if (!(p0 <= pres && pres < p1))
+	{
+	    lo = 0;	hi = ne-1;
+	    if (pres < p_at(1))
+		hi = 1;
+	    else if (pres >= p_at(ne-2))
+		lo = ne-2;
+	    while (hi - lo > 1)
+	    {
+		mid = (lo + hi)/2;
+		if (p_at(mid) <= pres)
+		    lo = mid;
+		else
+		    hi = mid;
+	    }
+	    j = lo;
+	    p0 = p_at(j);	p1 = p_at(j+1);
+	}
+#undef	p_at
+	hint->j = j;
+	slope = (p1 - p0)/(E[j+1] - E[j]);
+	e = E[j] + (pres - p0)/slope;
+	if (table->interp == EOS_TABLE_BICUBIC)
+	    e -= (eos_table_value(table,p,rho,e) - pres)/slope;
+	return e;
+}
+
+/* Tabulated p(rho,e), c^2(rho,e); gamma is only used by the flux solvers */
+struct TABULATED_EOS_MODEL
+{
+    static inline double pressure(
+	const EOS_PARAMS *eos,
+	double dens,
+	double engy,
+	double ke)
+    {
+	return eos_table_value(eos->table,eos->table->p,dens,(engy - ke)/dens);
+    }
+
+    static inline double soundSpeedSqr(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres)
+    {
+	return eos_table_value(eos->table,eos->table->c2,dens,
+			eos_table_energy(eos->table,dens,pres));
+    }
+
+    static inline double internalEnergy(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres)
+    {
+	return dens*eos_table_energy(eos->table,dens,pres);
+    }
+
+    static inline double enthalpy(
+	const EOS_PARAMS *eos,
+	double dens,
+	double pres,
+	double q2)
+    {
+	return 0.5*q2 + eos_table_energy(eos->table,dens,pres) + pres/dens;
+    }
+};
+
+template <class MODEL>
+struct EOS_BATCH
+{
+    /* pres[i] from dens[i], engy[i] and momn[0..dim-1][i] */
+    static void pressure(
+	const EOS_PARAMS *eos,
+	int n,
+	int dim,
+	const double *dens,
+	const double *engy,
+	double *const *momn,
+	double *pres)
+    {
+	for (int i = 0; i < n; ++i)
+	{
+	    double ke = 0.0;
+	    for (int l = 0; l < dim; ++l)
+		ke += momn[l][i]*momn[l][i];
+	    pres[i] = (dens[i] <= 0.0) ? 0.0 :
+			MODEL::pressure(eos,dens[i],engy[i],ke*(0.5/dens[i]));
+	}
+    }
+
+    static void soundSpeed(
+	const EOS_PARAMS *eos,
+	int n,
+	const double *dens,
+	const double *pres,
+	double *c)
+    {
+	for (int i = 0; i < n; ++i)
+	    c[i] = sqrt(MODEL::soundSpeedSqr(eos,dens[i],pres[i]));
+    }
+
+    /* engy[i] from dens[i], pres[i] and momn[0..dim-1][i] */
+    static void energy(
+	const EOS_PARAMS *eos,
+	int n,
+	int dim,
+	const double *dens,
+	const double *pres,
+	double *const *momn,
+	double *engy)
+    {
+	for (int i = 0; i < n; ++i)
+	{
+	    double e = 0.0;
+	    for (int l = 0; l < dim; ++l)
+		e += 0.5*(momn[l][i]*momn[l][i])/dens[i];
+	    engy[i] = e + MODEL::internalEnergy(eos,dens[i],pres[i]);
+	}
+    }
+};
+
+#endif /* !defined(_CFEOS_H) */
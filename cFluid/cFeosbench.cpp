@@ -0,0 +1,201 @@
+/***************************************************************
+FronTier is a set of libraries that implements different types of
+Front Traking algorithms. Front Tracking is a numerical method for
+the solution of partial differential equations whose solutions have
+discontinuities.
+
+Copyright (C) 1999 by The University at Stony Brook.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+****************************************************************/
+
+/*
+*				cFeosbench.cpp:
+*
+*	Cost and accuracy of the tabulated EOS against the analytic
+*	stiffened gas it is built from.  The table is written to the file
+*	given on the command line (default eos_table.bin), then pressure
+*	and sound speed are evaluated through the batch entry points for
+*	cells along a smooth line, as in a sweep, and for cells in random
+*	order, which defeats the cell hint.
+*
+*	usage: cFeosbench [table_file [num_cells [num_repeats]]]
+*/
+
+#include "cFluid.h"
+#include "cFeos.h"
+#include <chrono>
+#include <random>
+
+static double bench_pressure(EOS_PARAMS*,int,int,double*,double*,double**,
+			double*);
+static double bench_sound_speed(EOS_PARAMS*,int,int,double*,double*,
+			double*);
+static double max_rel_error(int,double*,double*);
+static void make_stiffened_gas_table(const char*,EOS_PARAMS*,int,int);
+
+int main(int argc, char **argv)
+{
+	const char *fname = (argc > 1) ? argv[1] : "eos_table.bin";
+	int n = (argc > 2) ? atoi(argv[2]) : 1 << 20;
+	int repeat = (argc > 3) ? atoi(argv[3]) : 20;
+	EOS_PARAMS analytic,table[2];
+	const char *name[2] = {"bilinear","bicubic"};
+	double *dens,*engy,*momn[MAXD],*pres,*pres_ref,*c,*c_ref;
+	double t_ref,t,tc_ref,tc;
+	int i,k,order;
+
+	analytic.gamma = 1.4;
+	analytic.pinf = 0.1;
+	analytic.einf = 0.0;
+	analytic.table = NULL;
+	EosSetType(&analytic);
+	make_stiffened_gas_table(fname,&analytic,256,256);
+
+	FT_VectorMemoryAlloc((POINTER*)&dens,n,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&engy,n,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&pres,n,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&pres_ref,n,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&c,n,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&c_ref,n,sizeof(double));
+	for (k = 0; k < MAXD; ++k)
+	    FT_VectorMemoryAlloc((POINTER*)&momn[k],n,sizeof(double));
+
+	for (k = 0; k < 2; ++k)
+	{
+	    table[k] = analytic;
+	    table[k].table = EosLoadTable(fname,(k == 0) ?
+				EOS_TABLE_BILINEAR : EOS_TABLE_BICUBIC);
+	    EosSetType(&table[k]);
+	}
+
+	(void) printf("%d cells, %d repeats, ns per cell\n",n,repeat);
+	(void) printf("%-8s %-9s %10s %10s %6s %10s %10s %6s %10s %10s\n",
+			"order","table","p_analyt","p_table","ratio",
+			"c_analyt","c_table","ratio","p_error","c_error");
+	for (order = 0; order < 2; ++order)
+	{
+	    std::mt19937 gen(12345);
+	    std::uniform_real_distribution<double> uni(0.0,1.0);
+	    for (i = 0; i < n; ++i)
+	    {
+		double s = (order == 0) ? (double)i/n : uni(gen);
+		dens[i] = 1.0 + 0.8*sin(2.0*PI*s);
+		engy[i] = dens[i]*(5.0 + 4.0*cos(6.0*PI*s));
+		for (k = 0; k < MAXD; ++k)
+		    momn[k][i] = 0.1*dens[i]*(k + 1)*sin(4.0*PI*s);
+		for (k = 0; k < MAXD; ++k)
+		    engy[i] += 0.5*sqr(momn[k][i])/dens[i];
+	    }
+	    t_ref = bench_pressure(&analytic,n,repeat,dens,engy,momn,
+				pres_ref);
+	    tc_ref = bench_sound_speed(&analytic,n,repeat,dens,pres_ref,c_ref);
+	    for (k = 0; k < 2; ++k)
+	    {
+		t = bench_pressure(&table[k],n,repeat,dens,engy,momn,pres);
+		tc = bench_sound_speed(&table[k],n,repeat,dens,pres_ref,c);
+		(void) printf("%-8s %-9s %10.3f %10.3f %6.2f %10.3f %10.3f "
+			"%6.2f %10.2e %10.2e\n",
+			(order == 0) ? "sweep" : "random",name[k],
+			t_ref,t,t/t_ref,tc_ref,tc,tc/tc_ref,
+			max_rel_error(n,pres,pres_ref),
+			max_rel_error(n,c,c_ref));
+	    }
+	}
+
+	FT_FreeThese(6,dens,engy,pres,pres_ref,c,c_ref);
+	for (k = 0; k < MAXD; ++k)
+	    FT_FreeThese(1,momn[k]);
+	return 0;
+}	/* end main */
+
+static double bench_pressure(
+	EOS_PARAMS *eos,
+	int n,
+	int repeat,
+	double *dens,
+	double *engy,
+	double **momn,
+	double *pres)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (int r = 0; r < repeat; ++r)
+	    EosBatchPressure(eos,n,MAXD,dens,engy,momn,pres);
+	std::chrono::duration<double,std::nano> d =
+			std::chrono::steady_clock::now() - start;
+	return d.count()/((double)n*repeat);
+}	/* end bench_pressure */
+
+static double bench_sound_speed(
+	EOS_PARAMS *eos,
+	int n,
+	int repeat,
+	double *dens,
+	double *pres,
+	double *c)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (int r = 0; r < repeat; ++r)
+	    EosBatchSoundSpeed(eos,n,dens,pres,c);
+	std::chrono::duration<double,std::nano> d =
+			std::chrono::steady_clock::now() - start;
+	return d.count()/((double)n*repeat);
+}	/* end bench_sound_speed */
+
+/* Maximum error relative to the largest reference value */
+static double max_rel_error(
+	int n,
+	double *v,
+	double *v_ref)
+{
+	double err = 0.0, scale = 0.0;
+
+	for (int i = 0; i < n; ++i)
+	{
+	    err = std::max(err,fabs(v[i] - v_ref[i]));
+	    scale = std::max(scale,fabs(v_ref[i]));
+	}
+	return err/scale;
+}	/* end max_rel_error */
+
+/* Tabulate the analytic model on log spaced density and energy axes */
+static void make_stiffened_gas_table(
+	const char *fname,
+	EOS_PARAMS *eos,
+	int nrho,
+	int ne)
+{
+	double *rho,*e,*p,*c2;
+	int i,j;
+
+	FT_VectorMemoryAlloc((POINTER*)&rho,nrho,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&e,ne,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&p,nrho*ne,sizeof(double));
+	FT_VectorMemoryAlloc((POINTER*)&c2,nrho*ne,sizeof(double));
+	for (i = 0; i < nrho; ++i)
+	    rho[i] = 0.1*pow(100.0,(double)i/(nrho - 1));
+	for (j = 0; j < ne; ++j)
+	    e[j] = 0.5*pow(100.0,(double)j/(ne - 1));
+	for (j = 0; j < ne; ++j)
+	for (i = 0; i < nrho; ++i)
+	{
+	    p[j*nrho+i] = STIFFENED_GAS_EOS_MODEL::pressure(eos,rho[i],
+				rho[i]*e[j],0.0);
+	    c2[j*nrho+i] = STIFFENED_GAS_EOS_MODEL::soundSpeedSqr(eos,rho[i],
+				p[j*nrho+i]);
+	}
+	EosWriteTable(fname,nrho,ne,rho,e,p,c2);
+	FT_FreeThese(4,rho,e,p,c2);
+}	/* end make_stiffened_gas_table */
@@ -63,6 +63,7 @@ static void initRiemannProb(Front*,LEVEL_FUNC_PACK*);
 static void initObliqueIntfc(Front*,LEVEL_FUNC_PACK*);
 
 static void cFluid_setProbParams(char*,EQN_PARAMS*);
+static void cFluid_readEosTables(char*,EQN_PARAMS*);
 
 
 
@@ -198,6 +199,59 @@ void read_cFluid_params(char *inname, EQN_PARAMS *eqn_params)
 	    clean_up(ERROR);
 	}
 
+	eqn_params->rk_scheme = CLASSIC_RK;
+	if (CursorAfterStringOpt(infile,
+		"Enter low storage Runge-Kutta scheme (SSP3, SSP4 or no):"))
+	{
+	    fscanf(infile,"%s",string);
+	    (void) printf("%s\n",string);
+	    if (string[0] == 'S' || string[0] == 's')
+	    {
+	    	switch (string[3])
+	    	{
+	    	case '3':
+		    eqn_params->rk_scheme = SSP_RK3_LS;
+		    break;
+	    	case '4':
+		    eqn_params->rk_scheme = SSP_RK4_LS;
+		    break;
+	    	default:
+		    printf("Runge-Kutta scheme %s not implemented!\n",string);
+		    clean_up(ERROR);
+	    	}
+	    }
+	}
+
+	eqn_params->balance_freq = 0;
+	eqn_params->balance_tol = 1.1;
+	eqn_params->balance_weight = 0.0;
+	if (CursorAfterStringOpt(infile,"Enter load balancing frequency:"))
+	{
+	    fscanf(infile,"%d",&eqn_params->balance_freq);
+	    (void) printf("%d\n",eqn_params->balance_freq);
+	    if (CursorAfterStringOpt(infile,
+			"Enter load imbalance tolerance:"))
+	    {
+		fscanf(infile,"%lf",&eqn_params->balance_tol);
+		(void) printf("%f\n",eqn_params->balance_tol);
+	    }
+	    if (CursorAfterStringOpt(infile,
+			"Enter interface element weight:"))
+	    {
+		fscanf(infile,"%lf",&eqn_params->balance_weight);
+		(void) printf("%f\n",eqn_params->balance_weight);
+	    }
+	}
+
+	if (CursorAfterStringOpt(infile,
+		"Enter yes for compressed checkpoints:"))
+	{
+	    fscanf(infile,"%s",string);
+	    (void) printf("%s\n",string);
+	    if (string[0] == 'y' || string[0] == 'Y')
+		set_compressed_output(YES);
+	}
+
 	eqn_params->use_base_soln = NO;
 	if (CursorAfterStringOpt(infile,
 		"Enter yes for comparison with base data:"))
@@ -238,10 +292,48 @@ void read_cFluid_params(char *inname, EQN_PARAMS *eqn_params)
 
 
     cFluid_setProbParams(inname, eqn_params);
+	cFluid_readEosTables(inname, eqn_params);
+
+	for (int i = 0; i < MAX_COMP; ++i)
+	    EosSetType(&eqn_params->eos[i]);
 
 }	/* end read_cFluid_params */
 
 
+// Optional tabulated equations of state of the gas components; gamma
+// entered with the component is still used by the flux solvers.
+static void cFluid_readEosTables(
+	char *inname,
+	EQN_PARAMS *eqn_params)
+{
+	FILE *infile = fopen(inname,"r");
+	char string[256],fname[256];
+	int interp = EOS_TABLE_BILINEAR;
+	int comp[2] = {GAS_COMP1,GAS_COMP2};
+
+	if (CursorAfterStringOpt(infile,
+		"Enter EOS table interpolation (bilinear or bicubic):"))
+	{
+	    fscanf(infile,"%s",string);
+	    (void) printf("%s\n",string);
+	    if (string[2] == 'c' || string[2] == 'C')
+		interp = EOS_TABLE_BICUBIC;
+	}
+	for (int i = 0; i < 2; ++i)
+	{
+	    rewind(infile);
+	    sprintf(string,"Enter EOS table file of the fluid with comp %d:",
+				comp[i]);
+	    if (CursorAfterStringOpt(infile,string))
+	    {
+		fscanf(infile,"%s",fname);
+		(void) printf("%s\n",fname);
+		eqn_params->eos[comp[i]].table = EosLoadTable(fname,interp);
+	    }
+	}
+	fclose(infile);
+}	/* end cFluid_readEosTables */
+
 static void cFluid_setProbParams(char* inname,
         EQN_PARAMS* eqn_params)
 {
@@ -68,7 +68,8 @@ int main(int argc, char **argv)
     sprintf(restart_name,"%s/intfc-ts%s",restart_name,
         right_flush(RestartStep,7));
 
-    if (pp_numnodes() > 1)
+    // A repartitioned restart reads every file it overlaps
+    if (pp_numnodes() > 1 && !f_basic.RepartitionRun)
 	{
         sprintf(restart_name,"%s-nd%s",restart_name,
                 right_flush(pp_mynode(),4));
@@ -77,6 +78,7 @@ int main(int argc, char **argv)
 	}
 
 	FT_ReadSpaceDomain(in_name,&f_basic);
+	f_basic.read_restart_intfc_states = readFrontPieceStates;
 	FT_StartUp(&front,&f_basic);
 	FT_InitDebug(in_name);
 
@@ -189,6 +191,8 @@ void gas_driver(Front *front,
         G_CARTESIAN* g_cartesian)
 {
     double CFL;
+    double front_time = 0.0,field_time = 0.0,t0;
+    EQN_PARAMS *eqn_params = (EQN_PARAMS*)front->extra1;
 
 	Curve_redistribution_function(front) = full_redistribute;
 
@@ -215,7 +219,7 @@ void gas_driver(Front *front,
 
         FT_Draw(front);
 
-	    FT_SetTimeStep(front);
+	    g_cartesian->setTimeStep();
 	    front->dt = std::min(front->dt,CFL*g_cartesian->max_dt);
 	    FT_SetOutputCounter(front);
         
@@ -248,16 +252,20 @@ void gas_driver(Front *front,
         if (debugging("trace"))
             printf("Begin a time step\n");
         
+        t0 = cpu_seconds();
         FrontPreAdvance(front);
         FT_Propagate(front);
+        front_time += cpu_seconds() - t0;
 
+        t0 = cpu_seconds();
         g_cartesian->solve();
+        field_time += cpu_seconds() - t0;
         
         if (debugging("trace")) 
             print_storage("Storage after time step","trace");
         
         FT_AddTimeStepToCounter(front);
-        FT_SetTimeStep(front);
+        g_cartesian->setTimeStep();
 
         if (debugging("step_size"))
         {
@@ -308,6 +316,14 @@ void gas_driver(Front *front,
             break;
         }
 
+        /* Move subdomain boundaries to even out the load */
+        if (eqn_params->balance_freq > 0 &&
+            front->step % eqn_params->balance_freq == 0)
+        {
+            g_cartesian->balanceLoad(front_time,field_time);
+            front_time = field_time = 0.0;
+        }
+
         FT_TimeControlFilter(front);
         FT_PrintTimeStamp(front);
         stop_clock("time_loop");
@@ -1,6 +1,7 @@
 #include <FronTier.h>
 #include <vector>
 #include <list>
+#include <unordered_map>
 #include <assert.h>
 
 #define EXT_COMP 0
@@ -38,11 +39,28 @@ enum PROB_TYPE
     OBLIQUE_SHOCK_REFLECT
 };
 
+enum EOS_TYPE
+{
+    STIFFENED_GAS_EOS = 0,
+    IDEAL_GAS_EOS,
+    TABULATED_EOS
+};
+
+enum EOS_TABLE_INTERP
+{
+    EOS_TABLE_BILINEAR = 1,
+    EOS_TABLE_BICUBIC = 3
+};
+
+struct EOS_TABLE;	/* cFeos.h */
+
 struct EOS_PARAMS 
 {
     double  gamma;
     double  pinf;
     double  einf;
+    EOS_TYPE type;	/* model of cFeos.h used for this component */
+    EOS_TABLE *table;	/* (rho,e) table of TABULATED_EOS */
 };
 
 struct STATE
@@ -67,6 +85,42 @@ enum NUM_SCHEME
     WENO_FOURTH_ORDER
 };
 
+enum RK_SCHEME
+{
+    CLASSIC_RK = 0,	/* Butcher tableau in coeffsRK/weightsRK */
+    SSP_RK3_LS,		/* Low storage SSP-RK(3,3) */
+    SSP_RK4_LS		/* Low storage SSP-RK(10,4) */
+};
+
+/*
+ * One stage of a two-register low storage Runge-Kutta scheme:
+ *	q1 = a*q0 + b*q1 + c*dt*L(q1)
+ * followed, if mix is true, by the register exchange
+ *	q0 = mix_q0[0]*q0 + mix_q0[1]*q1,  q1 = mix_q1[0]*q0 + mix_q1[1]*q1
+ * where q0 is the saved register and the new q0 is used for q1.
+ */
+struct LS_RK_STAGE
+{
+    double a;
+    double b;
+    double c;
+    bool mix;
+    double mix_q0[2];
+    double mix_q1[2];
+};
+
+/*
+ * Result of one FT_StateStructAtGridCrossing() lookup, cached by
+ * G_CARTESIAN::ghostStateAtGridCrossing().
+ */
+struct GHOST_CRX
+{
+    boolean status;
+    STATE *state;
+    HYPER_SURF *hs;
+    double crx_coords[MAXD];
+};
+
 enum POINT_PROP_SCHEME
 {
     FIRST_ORDER	= 1,
@@ -98,6 +152,8 @@ struct SWEEP
     double **momn;
     double *engy;
     double *pres;
+    double **vel;	/* velocity and sound speed, recovered */
+    double *csnd;	/* together with pres */
 };
 
 struct FSWEEP
@@ -121,6 +177,10 @@ struct EQN_PARAMS
     PROB_TYPE prob_type;
     POINTER level_func_params;
 	NUM_SCHEME num_scheme;
+    RK_SCHEME rk_scheme;
+    int balance_freq;		/* steps between load balancing, 0: off */
+    double balance_tol;		/* max to average subdomain cost */
+    double balance_weight;	/* interface element cost, 0: from clocks */
     POINT_PROP_SCHEME point_prop_scheme;
 	EOS_PARAMS      eos[MAX_COMP];
 	boolean tracked;
@@ -191,6 +251,7 @@ struct SCHEME_PARAMS
     double beta;
 	double gamma;
     double einf;
+    EOS_PARAMS *eos;
 };
 
 struct FLOW_THROUGH_PARAMS
@@ -335,6 +396,8 @@ public:
 	void freeBaseFront();
 	void errFunction();
 	void solve(); // main step function
+	void setTimeStep(); // front and fluid dt, one global reduction
+	void balanceLoad(double,double); // front and field times
 
 private:
 
@@ -353,6 +416,7 @@ private:
 	int lbuf[MAXD],ubuf[MAXD];
 	double top_L[MAXD],top_U[MAXD],top_h[MAXD];
     void getDomainBounds();
+	void readRepartitionedStates(char*);	// restart on new partition
 
 	int **ij_to_I,**I_to_ij;	// Index mapping for 2D
 	int ***ijk_to_I,**I_to_ijk;	// Index mapping for 3D
@@ -362,6 +426,11 @@ private:
 
 	// mesh storage
 	std::vector<L_RECTANGLE> cell_center;
+	void setCellCenters();
+
+	/* Load balancing, cuts of the subdomains in cells */
+	int *balance_cuts[MAXD] {};
+	void remapSubdomain(int*);
 
     //NOTE: Can only support 2-component flows
 	int m_comp[2];
@@ -436,10 +505,21 @@ private:
 	void setSecondOrderRK();
 	void setFourthOrderRK();
     void allocRungeKuttaVstFlux();
+    void freeRungeKuttaVstFlux();
 	void solveRungeKutta();
 
+    /* Low storage SSP Runge Kutta: st_field[0] is the stage register,
+     * st_field[1] the saved register and st_flux[0] the stage flux. */
+    std::vector<LS_RK_STAGE> lsStagesRK;
+	void setLowStorageSSPRK3();
+	void setLowStorageSSPRK4();
+	void solveLowStorageRK();
+	void updateMeshVstLowStorage(SWEEP*,SWEEP*,FSWEEP,const LS_RK_STAGE&);
+
 	/* Mesh operations */
 	void addMeshFluxToVst(SWEEP*,FSWEEP,double);
+	void recoverPrimitives(SWEEP*);
+	void setCellPrimitives(SWEEP*,int);
 	void computeMeshFlux(SWEEP,FSWEEP*,double);
 	void copyMeshVst(SWEEP,SWEEP*);
 	void copyFromMeshVst(SWEEP);
@@ -456,6 +536,14 @@ private:
 	void appendStencilBuffer3d(SWEEP*,SWEEP*,int,int,int);
 	void appendGhostBuffer(SWEEP*,SWEEP*,int,int*,int,int);
 
+    /* Ghost state cache: crossing lookups of appendGhostBuffer() keyed
+     * by (cell, direction, component), valid for one grid interface. */
+    std::unordered_map<long,GHOST_CRX> ghost_crx_cache;
+    INTERFACE *ghost_crx_intfc {nullptr};
+	void clearGhostStateCache();
+	boolean ghostStateAtGridCrossing(int*,GRID_DIRECTION,COMPONENT,
+            STATE**,HYPER_SURF**,double*);
+
     // -------------------------------------------------------
 	// 		initialization functions
 	// -------------------------------------------------------
@@ -573,6 +661,7 @@ extern void cfluid_compute_force_and_torque(Front*,HYPER_SURF*,double,double*,
 			double*);
 extern void record_moving_body_data(char*,Front*);
 extern void readFrontStates(Front*,char*);
+extern void readFrontPieceStates(INTERFACE*,char*);
 extern void reflectVectorThroughPlane(double*,double*,double*,int);
 extern boolean reflectNeumannState(Front*,HYPER_SURF*,double*,COMPONENT,SWEEP*,
 			STATE*);
@@ -584,6 +673,16 @@ extern double EosSoundSpeedSqr(STATE*);
 extern double EosMaxBehindShockPres(double,STATE*);
 extern void   EosSetTVDParams(SCHEME_PARAMS*,EOS_PARAMS*);
 extern void   CovertVstToState(STATE*,SWEEP*,EOS_PARAMS*,int,int);
+extern void   EosSetType(EOS_PARAMS*);
+extern EOS_TABLE *EosLoadTable(const char*,int);
+extern void   EosWriteTable(const char*,int,int,const double*,const double*,
+			const double*,const double*);
+extern void   EosBatchPressure(EOS_PARAMS*,int,int,const double*,const double*,
+			double*const*,double*);
+extern void   EosBatchSoundSpeed(EOS_PARAMS*,int,const double*,const double*,
+			double*);
+extern void   EosBatchEnergy(EOS_PARAMS*,int,int,const double*,const double*,
+			double*const*,double*);
 extern void   findGhostState(STATE,STATE,STATE*);
 
 //cFinit.cpp
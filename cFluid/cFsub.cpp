@@ -37,12 +37,10 @@ static void cfluid_compute_force_and_torque2d(Front*,HYPER_SURF*,double,
                         double*,double*);
 static void cfluid_compute_force_and_torque3d(Front*,HYPER_SURF*,double,
                         double*,double*);
-static boolean force_on_hse(HYPER_SURF_ELEMENT*,HYPER_SURF*,RECT_GRID*,double*,
-                                        double*,double*,boolean);
 static boolean force_on_hse2d(HYPER_SURF_ELEMENT*,HYPER_SURF*,RECT_GRID*,
                                         double*,double*,double*,boolean);
-static boolean force_on_hse3d(HYPER_SURF_ELEMENT*,HYPER_SURF*,RECT_GRID*,
-                                        double*,double*,double*,boolean);
+static boolean force_on_tri3d(TRI*,HS_STATE_POOL*,double*,double*,double*,
+					boolean);
 static double intrp_between(double,double,double,double,double);
 
 static double (*getStateVel[MAXD])(Locstate) =
@@ -880,37 +878,94 @@ extern double linear_flux(
 	    return a*(ur - um);
 }	/* end net_uwind_flux */
 
-extern void readFrontStates(
-	Front		*front,
+// Reads the conserved front states of one restart file, in the point
+// order of the interface read from the matching interface file.
+extern void readFrontPieceStates(
+	INTERFACE	*intfc,
 	char		*restart_name)
 {
 	FILE 		*infile;
-	EQN_PARAMS 	*eqn_params = (EQN_PARAMS*)front->extra1;
-	INTERFACE 	*intfc = front->interf;
         STATE 		*sl,*sr;
         POINT 		*p;
         HYPER_SURF 	*hs;
         HYPER_SURF_ELEMENT *hse;
 	STATE 		*lstate,*rstate;
 	char 		fname[100];
-	int 		i,dim = front->rect_grid->dim;
-	int		comp;
-	EOS_PARAMS	*eos = eqn_params->eos;
+	int 		i,dim = intfc->dim;
+	const char	*line;
+	double		*buf = NULL;
+	int		n;
 
 	sprintf(fname,"%s-gas",restart_name);
 	infile = fopen(fname,"r");
 	
 	/* Initialize states at the interface */
-        next_output_line_containing_string(infile,"Interface gas states:");
+        line = next_output_line_containing_string(infile,
+				"Interface gas states:");
+	if (line != NULL && strstr(line,"compressed") != NULL)
+	{
+	    n = 0;
+	    next_point(intfc,NULL,NULL,NULL);
+	    while (next_point(intfc,&p,&hse,&hs))
+		++n;
+	    FT_VectorMemoryAlloc((POINTER*)&buf,2*(2+dim)*n + 1,FLOAT);
+	    fread_compressed_array(infile,buf,sizeof(double),2*(2+dim)*n);
+	}
+	n = 0;
+        next_point(intfc,NULL,NULL,NULL);
+        while (next_point(intfc,&p,&hse,&hs))
+        {
+            FT_GetStatesAtPoint(p,hse,hs,(POINTER*)&sl,(POINTER*)&sr);
+	    lstate = (STATE*)sl;	rstate = (STATE*)sr;
+	    if (buf != NULL)
+	    {
+		lstate->dens = buf[n++];	rstate->dens = buf[n++];
+		lstate->engy = buf[n++];	rstate->engy = buf[n++];
+		for (i = 0; i < dim; ++i)
+		{
+		    lstate->momn[i] = buf[n++];
+		    rstate->momn[i] = buf[n++];
+		}
+	    }
+	    else
+	    {
+            	fscanf(infile,"%lf %lf",&lstate->dens,&rstate->dens);
+            	fscanf(infile,"%lf %lf",&lstate->engy,&rstate->engy);
+	    	for (i = 0; i < dim; ++i)
+            	    fscanf(infile,"%lf %lf",&lstate->momn[i],
+				&rstate->momn[i]);
+	    }
+	    lstate->dim = rstate->dim = dim;
+        }
+	if (buf != NULL)
+	    FT_FreeThese(1,buf);
+	fclose(infile);
+}
+
+extern void readFrontStates(
+	Front		*front,
+	char		*restart_name)
+{
+	EQN_PARAMS 	*eqn_params = (EQN_PARAMS*)front->extra1;
+	INTERFACE 	*intfc = front->interf;
+        STATE 		*sl,*sr;
+        POINT 		*p;
+        HYPER_SURF 	*hs;
+        HYPER_SURF_ELEMENT *hse;
+	STATE 		*lstate,*rstate;
+	int 		dim = front->rect_grid->dim;
+	int		comp;
+	EOS_PARAMS	*eos = eqn_params->eos;
+
+	// A repartitioned restart has read them in FT_StartUp()
+	if (!front->f_basic->RepartitionRun)
+	    readFrontPieceStates(intfc,restart_name);
+
         next_point(intfc,NULL,NULL,NULL);
         while (next_point(intfc,&p,&hse,&hs))
         {
             FT_GetStatesAtPoint(p,hse,hs,(POINTER*)&sl,(POINTER*)&sr);
 	    lstate = (STATE*)sl;	rstate = (STATE*)sr;
-            fscanf(infile,"%lf %lf",&lstate->dens,&rstate->dens);
-            fscanf(infile,"%lf %lf",&lstate->engy,&rstate->engy);
-	    for (i = 0; i < dim; ++i)
-            	fscanf(infile,"%lf %lf",&lstate->momn[i],&rstate->momn[i]);
 	    
 	    comp = negative_component(hs);
 	    lstate->eos = &eos[comp];
@@ -927,7 +982,6 @@ extern void readFrontStates(
 	    lstate->dim = rstate->dim = dim;
         }
 	FT_MakeGridIntfc(front);
-	fclose(infile);
 }
 
 extern void reflectVectorThroughPlane(
@@ -1117,7 +1171,7 @@ static	void cfluid_compute_force_and_torque2d(
 	*torque = 0.0;
 	for (b = curve->first; b != NULL; b = b->next)
 	{
-	    if (force_on_hse(Hyper_surf_element(b),Hyper_surf(curve),gr,
+	    if (force_on_hse2d(Hyper_surf_element(b),Hyper_surf(curve),gr,
 			&pres,area,posn,pos_side))
 	    {
 	    	for (i = 0; i < dim; ++i)
@@ -1162,6 +1216,8 @@ static	void cfluid_compute_force_and_torque3d(
 	EQN_PARAMS *cFparams = (EQN_PARAMS*)fr->extra1;
 	double *gravity = cFparams->gravity;
 	SURFACE *surface = Surface_of_hs(hs);
+	HS_STATE_POOL *pool;
+	double (*pres_var[1])(Locstate) = {getStatePres};
 
 	if (gas_comp(negative_component(surface)))
 	    pos_side = NO;
@@ -1173,11 +1229,12 @@ static	void cfluid_compute_force_and_torque3d(
 	    force[i] = 0.0;
 	    torque[i] = 0.0;
 	}
+	/* Gather the pressure once instead of per tri vertex */
+	pool = FT_MakeHsStatePool(fr,hs,1,pres_var);
 	for (tri = first_tri(surface); !at_end_of_tri_list(tri,surface); 
 			tri = tri->next)
 	{
-	    if (force_on_hse(Hyper_surf_element(tri),Hyper_surf(surface),gr,
-			&pres,area,posn,pos_side))
+	    if (force_on_tri3d(tri,pool,&pres,area,posn,pos_side))
 	    {
 	    	for (i = 0; i < dim; ++i)
 	    	{
@@ -1194,6 +1251,7 @@ static	void cfluid_compute_force_and_torque3d(
 		}
 	    }
 	}
+	FT_FreeHsStatePool(pool);
 	 /* Add gravity to the total force */
 	if (motion_type(surface) != ROTATION)
 	{
@@ -1209,28 +1267,6 @@ static	void cfluid_compute_force_and_torque3d(
 }	/* end cfluid_compute_force_and_torque3d */
 
 
-static boolean force_on_hse(
-	HYPER_SURF_ELEMENT *hse,	/* Bond (2D) or tri (3D) */
-	HYPER_SURF *hs,			/* Curve (2D) or surface (3D) */
-	RECT_GRID *gr,			/* Rectangular grid */
-	double *pres,		/* Average pressure */
-	double *area,		/* Area as a vector, pointing onto body */
-	double *posn,		/* Position of the pressure */
-	boolean pos_side)	/* Is the body on the positive side of hs? */
-{
-	int dim = gr->dim;
-	switch (dim)
-	{
-	case 2: 
-	    return force_on_hse2d(hse,hs,gr,pres,area,posn,pos_side);
-	case 3: 
-	    return force_on_hse3d(hse,hs,gr,pres,area,posn,pos_side);
-	default: 
-	    return NO; 
-	}
-	
-}	/* end force_on_hse */
-
 static boolean force_on_hse2d(
 	HYPER_SURF_ELEMENT *hse,
 	HYPER_SURF *hs,
@@ -1325,19 +1361,17 @@ static boolean force_on_hse2d(
 	return YES;
 }	/* end force_on_hse2d */
 
-static boolean force_on_hse3d(
-	HYPER_SURF_ELEMENT *hse,
-	HYPER_SURF *hs,
-	RECT_GRID *gr,
+static boolean force_on_tri3d(
+	TRI *t,
+	HS_STATE_POOL *pool,		/* Pressure of the surface points */
 	double *pres,
 	double *area,
 	double *posn,
 	boolean pos_side)
 {
-        TRI *t = Tri_of_hse(hse);
+	double **pvar = pos_side ? pool->right_var : pool->left_var;
 	POINT *point;
-	Locstate sl,sr;
-        int i,j,dim = gr->dim;
+	int i,j;
 
 	*pres = 0.0;
 	for (i = 0; i < 3; ++i)
@@ -1345,23 +1379,19 @@ static boolean force_on_hse3d(
 	for (i = 0; i < 3; ++i)
 	{
 	    point = Point_of_tri(t)[i];
-	    for (j = 0; j < dim; ++j)
+	    for (j = 0; j < 3; ++j)
 		posn[j] += Coords(point)[j];
-	    FT_GetStatesAtPoint(point,hse,hs,&sl,&sr);
-	    if (pos_side)
-		*pres += getStatePres(sr);
-	    else
-		*pres += getStatePres(sl);
+	    *pres += pvar[0][Index_of_point(point)];
 	}
 	*pres /= 3.0;
-	for (i = 0; i < dim; ++i)
+	for (i = 0; i < 3; ++i)
 	{
 	    area[i] = pos_side ? -Tri_normal(t)[i] : Tri_normal(t)[i];
 	    posn[i] /= 3.0;
 	}
 	/* Need to treat subdomain boundary */
 	return YES;
-}	/* end force_on_hse3d */
+}	/* end force_on_tri3d */
 
 static double intrp_between(
 	double x1,
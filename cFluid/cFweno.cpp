@@ -22,6 +22,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 ****************************************************************/
 
 #include <cFluid.h>
+#include "cFeos.h"
 #include <ctime>
 #include <time.h>
 
@@ -32,8 +33,10 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 static double weno5_scal(double *f);
 static void matmvec(double *b, double L[5][5], double *x);
 static void f2is(double *f, double *s);
-static void u2f(double *u, double* f);
-static void weno5_get_flux(POINTER,int,int,double**, std::vector<std::vector<double> >);
+static void u2f(double *u, double v, double* f);
+template <class EOS_MODEL>
+static void weno5_get_flux(POINTER,int,int,double**,const double*,
+		const double*,std::vector<std::vector<double> >);
 static void arti_compression(POINTER,double*,double*,double,double,double*,int,double &c);
 
 extern void WENO_flux(
@@ -72,7 +75,21 @@ extern void WENO_flux(
 				extend_size,ghost_size,u_old,flux);
 	//stopClock("Total_time_flux_gpu");
 #else
-	weno5_get_flux(params,extend_size,ghost_size,u_old,flux);
+	switch (scheme_params->eos->type)
+	{
+	case IDEAL_GAS_EOS:
+	    weno5_get_flux<IDEAL_GAS_EOS_MODEL>(params,extend_size,
+				ghost_size,u_old,vst->vel[0],vst->csnd,flux);
+	    break;
+	case TABULATED_EOS:
+	    weno5_get_flux<TABULATED_EOS_MODEL>(params,extend_size,
+				ghost_size,u_old,vst->vel[0],vst->csnd,flux);
+	    break;
+	case STIFFENED_GAS_EOS:
+	default:
+	    weno5_get_flux<STIFFENED_GAS_EOS_MODEL>(params,extend_size,
+				ghost_size,u_old,vst->vel[0],vst->csnd,flux);
+	}
 #endif
 
 	for (int i = ghost_size; i < n+ghost_size; ++i)
@@ -97,17 +114,23 @@ extern void WENO_flux(
 
 }	/* end weno5_flux */
 
+/* The state relations along the line are those of EOS_MODEL (cFeos.h),
+ * the normal velocity and sound speed of the cells are those recovered
+ * with the pressure in the stage update */
+template <class EOS_MODEL>
 static void weno5_get_flux(
 	POINTER params,
 	int extend_size, 
 	int ghost_size, 
 	double **u_old,
+	const double *vel,
+	const double *a,
     std::vector<std::vector<double> > flux)
 {
 
 	SCHEME_PARAMS *scheme_params = (SCHEME_PARAMS*)params;
-	double gamma = scheme_params->gamma;
-    double gm = gamma - 1.0;
+	EOS_PARAMS *eos = scheme_params->eos;
+    double gm = eos->gamma - 1.0;	// Gruneisen coefficient of the model
 
     double** f;
     FT_MatrixMemoryAlloc((POINTER*)&f,extend_size,5,sizeof(double));
@@ -115,18 +138,17 @@ static void weno5_get_flux(
     double maxeig[5] = {0 ,0 ,0, 0, 0};
     for(int i = 0; i < extend_size; ++i)
     {
-        double a = sqrt(gamma * u_old[5][i]/u_old[0][i]);
-        double v = u_old[1][i]/u_old[0][i];
+        double v = vel[i];
 
-        maxeig[0] = std::max(maxeig[0], fabs(v - a));
+        maxeig[0] = std::max(maxeig[0], fabs(v - a[i]));
         maxeig[1] = std::max(maxeig[1], fabs(v));
-        maxeig[4] = std::max(maxeig[4], fabs(v + a));
+        maxeig[4] = std::max(maxeig[4], fabs(v + a[i]));
         
 	    double u[6];
         for (int j = 0; j < 6; ++j)
             u[j] = u_old[j][i];
 
-        u2f(u,f[i]);
+        u2f(u,v,f[i]);
     }
 
     maxeig[2] = maxeig[1];
@@ -147,13 +169,14 @@ static void weno5_get_flux(
         u_mid[6] = u_mid[2]/u_mid[0];
         u_mid[7] = u_mid[3]/u_mid[0];
         u_mid[9] = sqr(u_mid[5]) + sqr(u_mid[6]) + sqr(u_mid[7]);
-        u_mid[8] = (u_mid[4] - 0.5*u_mid[0]*u_mid[9])*(gamma - 1.0);
-        u_mid[10] = sqrt(gamma*u_mid[8]/u_mid[0]);
+        u_mid[8] = EOS_MODEL::pressure(eos,u_mid[0],u_mid[4],
+                0.5*u_mid[0]*u_mid[9]);
+        u_mid[10] = sqrt(EOS_MODEL::soundSpeedSqr(eos,u_mid[0],u_mid[8]));
 
         /*** R(u_1/2) & R^-1(u_1/2) ***/
 
         //h enthalpy
-        double h = 0.5*u_mid[9] + gamma*u_mid[8]/(gamma - 1.0)/u_mid[0];
+        double h = EOS_MODEL::enthalpy(eos,u_mid[0],u_mid[8],u_mid[9]);
 
         double R[5][5];
  
@@ -398,10 +421,9 @@ static void matmvec(
 
 static void u2f(
 	double* u,
+	double v,
     double* f)
 {
-	double v = u[1]/u[0];
-
     	f[0] = u[1];
     	f[1] = v*u[1] + u[5];
     	f[2] = v*u[2];
@@ -41,6 +41,9 @@ extern "C" {
      -o output-dir-name
      -r restart-dir-name
      -t restart-step
+     -n nx [ny] [nz]  (partition of the restart run, if different)
+     The partition of a load balanced restart run is read from the
+     intfc-ts*-partition file of the restart directory.
     \param argc @b in	The number of arguments passed by command line
     \param argv @b in	The argument vector passed by command line
     \param f_basic @b out	Structure to store options for initializing the program
@@ -118,6 +121,10 @@ extern "C" {
     \brief Initialize front velocity function for front point propagation.
      The velocity function use point and other related structures as input,
      must also supply parameters needed for the velocity function.
+     If velo_func_pack->reentrant is YES, points are propagated concurrently
+     over a precomputed old to new point pairing.
+     If velo_func_pack->batch_func is given, it is used to evaluate the
+     velocity of all points at once with the built-in point propagators.
     \param front @b inout	Pointer to Front.
     \param velo_func_pack @b in	Structure containing velocity function and parameters.
  */
@@ -254,6 +261,21 @@ extern "C" {
  */
    IMPORT  void FT_SetTimeStep(Front *front );
 
+/*! \fn void FT_SetTimeStepWithMaxSpeeds(Front *front, int n, double *max_speed)
+ *  \ingroup TIME
+    \brief Same as FT_SetTimeStep(), but the global reduction of the front
+     time step is packed with the n local maximum speeds (or any other
+     quantities to be maximized over all processors) of the caller into
+     a single vector reduction. On return max_speed holds the global
+     maxima. The reduction is a maximum and its result does not depend
+     on the number or order of the processors.
+     \param front @b inout	Pointer to the Front.
+     \param n @b in	Number of values in max_speed.
+     \param max_speed @b inout	Local maxima on input, global on output.
+ */
+   IMPORT  void FT_SetTimeStepWithMaxSpeeds(Front *front, int n,
+				double *max_speed);
+
 /*! \fn void FT_SetOutputCounter(Front *front)
  *  \ingroup INITIALIZATION
     \brief This function is used in restart to set the printing index and
@@ -1068,6 +1090,59 @@ extern "C" {
 				int *owner,
 				int w_type);
 
+/*! \fn double FT_IntfcElementWeight(Front *front, double front_time, double field_time)
+ *  \ingroup PARALLEL
+    \brief Returns the cost of one interface element (bond in 2D, triangle
+     in 3D) relative to one mesh cell, from the CPU time spent on the front
+     and on the field solver by every processor since the last load
+     balancing. It returns zero if there is no front or no time. This is
+     a synchronous function.
+    \param front @b in	Pointer to Front.
+    \param front_time @b in	Time of this processor in front propagation.
+    \param field_time @b in	Time of this processor in the field solver.
+ */
+   IMPORT  double FT_IntfcElementWeight(Front* front,
+				double front_time,
+				double field_time);
+
+/*! \fn boolean FT_BalancePartition(Front *front, double weight, double tol, int **cuts)
+ *  \ingroup PARALLEL
+    \brief Measures the cost of each subdomain as its mesh cells plus
+     weight times its interface elements. If the largest cost exceeds
+     tol times the average, it divides the slabs of cells in each
+     direction by recursive bisection of their cost. The new boundaries
+     are returned as cell indices in cuts[dir][0..nsub], allocated if
+     NULL. Returns YES if the subdomains should move, see
+     FT_ShiftSubdomain(). This is a synchronous function.
+    \param front @b in	Pointer to Front.
+    \param weight @b in	Cost of one interface element in mesh cells.
+    \param tol @b in	Largest ratio of maximum to average cost accepted.
+    \param cuts @b inout	Array of MAXD cell index arrays of the cuts.
+ */
+   IMPORT  boolean FT_BalancePartition(Front* front,
+				double weight,
+				double tol,
+				int **cuts);
+
+/*! \fn boolean FT_ShiftSubdomain(Front *front, int **cuts, int *lexpand, int *uexpand)
+ *  \ingroup PARALLEL
+    \brief Moves the subdomain boundaries toward the cuts of
+     FT_BalancePartition() by at most the buffer width, scatters the
+     interface and rebuilds the grid interfaces on the new subdomain.
+     lexpand and uexpand return the cells gained on the lower and upper
+     side (negative if lost), the grid arrays are shifted by lexpand.
+     It returns NO once the cuts are reached and is called until then.
+     This is a synchronous function.
+    \param front @b inout	Pointer to Front.
+    \param cuts @b in	Cuts returned by FT_BalancePartition().
+    \param lexpand @b out	Cells gained on the lower side in each direction.
+    \param uexpand @b out	Cells gained on the upper side in each direction.
+ */
+   IMPORT  boolean FT_ShiftSubdomain(Front* front,
+				int **cuts,
+				int *lexpand,
+				int *uexpand);
+
 /*! \fn void FT_GetStatesAtPoint(POINT *p,  HYPER_SURF_ELEMENT *hse, HYPER_SURF *hs,  POINTER *sl, POINTER *sr)
  *  \ingroup FIELD
     \brief This function retrieves the left and right states at a point.
@@ -1086,6 +1161,35 @@ extern "C" {
 				POINTER *sl,
 				POINTER *sr);
 
+/*! \fn HS_STATE_POOL *FT_MakeHsStatePool(Front *front, HYPER_SURF *hs, int num_vars, double (**state_var)(Locstate))
+ *  \ingroup FIELD
+    \brief This function gathers state variables of the points of a
+     curve (2D) or surface (3D) into contiguous arrays, one per variable
+     and side, so that passes over one variable, such as the pressure
+     for a force, stream through memory. Entry i of left_var[v] is
+     (*state_var[v])(sl) of the left state sl of points[i], likewise
+     right_var[v]. In 2D i is the position along the curve, the start
+     and end of a closed curve are separate entries. In 3D the macros
+     pool_left_var(pool,v,p) and pool_right_var(pool,v,p) look up point
+     p, until the next loop that resets the sort status of the points.
+     The pool is a copy, gather again after the states change.
+    \param front @b in Pointer to front.
+    \param hs @b in Pointer to the curve or surface.
+    \param num_vars @b in Number of state variables.
+    \param state_var @b in Functions returning the state variables, as getStateDens().
+ */
+   IMPORT  HS_STATE_POOL *FT_MakeHsStatePool(Front *front,
+				HYPER_SURF *hs,
+				int num_vars,
+				double (**state_var)(Locstate));
+
+/*! \fn void FT_FreeHsStatePool(HS_STATE_POOL *pool)
+ *  \ingroup FIELD
+    \brief This function frees a pool made by FT_MakeHsStatePool().
+    \param pool @b in Pointer to the pool.
+ */
+   IMPORT  void FT_FreeHsStatePool(HS_STATE_POOL *pool);
+
 /*! \fn void FT_ScalarMemoryAlloc(POINTER *a, int size)
  *  \ingroup MEMORY
     \brief This function allocate the memory for a scalar.
@@ -1263,6 +1367,25 @@ IMPORT  boolean FT_StateStructAtGridCrossing2(Front *front ,
 				COMPONENT comp_of_vol,
 				POINTER *grid_vol_frac);
 
+/*! \fn void FT_ComputeSignedDistance(Front *front, COMPONENT comp, double band, double *sdist)
+ *  \ingroup GRIDINTFC
+    \brief This function computes the signed distance to the front on the
+     expanded dual grid of front->grid_intfc, the grid of the solver
+     arrays. It is negative in component comp and positive elsewhere.
+     Nodes next to the front get the exact distance, the others are
+     filled by parallel fast sweeping. Boundary curves and surfaces are
+     not part of the front here.
+    \param front @b pointer to the front.
+    \param comp @b component index of the negative side.
+    \param band @b width of the band in grid spacings, the magnitude is cut at band*h outside of it. Non-positive band computes the distance on the whole grid.
+    \param sdist @b output array of the signed distance, indexed as the other solver arrays.
+ */
+   IMPORT  void FT_ComputeSignedDistance(
+				Front *front,
+				COMPONENT comp,
+				double band,
+				double *sdist);
+
 /*! \fn double FT_CurveSegLengthConstr(CURVE *c, BOND *bs, BOND *be, int nb, double seg_length, REDISTRIBUTION_DIRECTION dir)
  *  \ingroup OPTIMIZATION
     \brief This function set curve to constrained length (seg_length), starting
@@ -226,19 +226,30 @@ struct _F_BASIC_DATA {
 	char 	in_name[200];
 	char 	out_name[200];
 	int 	subdomains[MAXD];
+	int 	restart_subdomains[MAXD];	/* partition of restart run */
+	int	*restart_cuts[MAXD];	/* its cells, if load balanced */
 	boolean ReadFromInput;
 	boolean RestartRun;
+	boolean RepartitionRun;
 	boolean ReSetTime;
 	int 	RestartStep;
         char 	restart_name[200];
 	char	restart_state_name[200];
 
+	/* Optional, reads the front states of one restart file */
+	void	(*read_restart_intfc_states)(INTERFACE*,char*);
+
 	/* The following are needed before FT_StartUp() */
         double 	L[MAXD],U[MAXD];
         int 	gmax[MAXD];
         int 	boundary[MAXD][2];
 	size_t 	size_of_intfc_state;
 	GEOMETRY_REMAP coord_system;
+
+	/* Set by FT_StartUp() on a repartitioned restart */
+	int	num_restart_pieces;
+	int	*restart_pieces;		/* restart files read */
+	RECT_GRID *restart_piece_grids;	/* their computational grids */
 };
 typedef struct _F_BASIC_DATA F_BASIC_DATA;
 
@@ -586,6 +597,9 @@ struct _Front {
 	int  npts_tan_sten;
 	int  movingframe;
 	boolean adaptive_partition;     /* Use adaptive partition if YES */
+	boolean parallel_point_propagate; /* Thread point propagation if YES,
+					   * requires reentrant vfunc and
+					   * _point_propagate */
 	POINTER vparams;	/* parameters for velocity function */
 	POINTER extra1;		/* pointer to extra data structure */
 	POINTER extra2;		/* pointer to extra data structure */
@@ -633,6 +647,9 @@ struct _Front {
 			  boolean,boolean);
 	int  (*vfunc)(POINTER,struct _Front*,POINT*,HYPER_SURF_ELEMENT*,
 				HYPER_SURF*,double*); /* analytical velo func */
+	int  (*batch_vfunc)(POINTER,struct _Front*,int,double**,double**,
+				double*,double**); /* batched analytical velo */
+	int  batch_vfunc_needs;	/* VELO_NEED_NORMAL, VELO_NEED_CURVATURE */
 	void (*_compute_force_and_torque)(struct _Front*,HYPER_SURF*,double,
 				double*,double*);
 	boolean (*_untrack_surface)(SURFACE*,COMPONENT,struct _Front*);
@@ -1395,9 +1412,46 @@ struct _VELO_FUNC_PACK {
 	void (*point_propagate)(struct _Front*,POINTER,POINT*,POINT*,
                         HYPER_SURF_ELEMENT*,HYPER_SURF*,double,double*);
         POINTER func_params;
+	boolean reentrant;	/* func and point_propagate are thread safe */
+	/* Optional batched velocity function, called as
+	 * (*batch_func)(params,front,n,coords,nor,kappa,vel) with arrays
+	 * coords[dim][n], nor[dim][n], kappa[n] as input and vel[dim][n]
+	 * as output. nor and kappa are NULL unless requested in batch_needs.
+	 */
+	int (*batch_func)(POINTER,struct _Front*,int,double**,double**,
+			double*,double**);
+	int batch_needs;
 };
 typedef struct _VELO_FUNC_PACK VELO_FUNC_PACK;
 
+/*
+ * States of the points of a hypersurface gathered into one contiguous
+ * array per state variable, see FT_MakeHsStatePool().  Entry i belongs
+ * to points[i].  In 2D i is the position along the curve, in 3D it is
+ * also Index_of_point(points[i]), valid until the sort status of the
+ * points is reset.
+ */
+struct _HS_STATE_POOL {
+	HYPER_SURF *hs;
+	int num_points;
+	POINT **points;
+	int num_vars;
+	double (**state_var)(Locstate);	/* e.g. getStateDens */
+	double **left_var;		/* left_var[v][i] */
+	double **right_var;		/* right_var[v][i] */
+};
+typedef struct _HS_STATE_POOL HS_STATE_POOL;
+
+#define	pool_left_var(pool,v,p)		\
+	((pool)->left_var[v][Index_of_point(p)])
+#define	pool_right_var(pool,v,p)	\
+	((pool)->right_var[v][Index_of_point(p)])
+
+enum {
+	VELO_NEED_NORMAL	= 0x1,
+	VELO_NEED_CURVATURE	= 0x2
+};
+
 enum {
         TSTEP_FIELD_WIDTH   = 7,         
 	PP_NODE_FIELD_WIDTH = 4
@@ -304,6 +304,7 @@ IMPORT  void    set_default_front(F_INIT_DATA*,Front*);
 	/* fint.c*/
 IMPORT	HYPER_SURF_BDRY	*f_make_hypersurface_boundary(void);
 IMPORT	HYPER_SURF      *f_make_hypersurface(COMPONENT,COMPONENT);
+IMPORT	INTERFACE       *copy_interface_sharing_states(INTERFACE*);
 IMPORT	INTERFACE       *f_copy_interface(INTERFACE*);
 IMPORT	INTERFACE       *f_receive_interface(int);
 IMPORT	POINT	*f_Point(double*);
@@ -521,6 +522,8 @@ IMPORT  void    second_order_point_propagate(Front*,POINTER, POINT*, POINT*,
 		                HYPER_SURF_ELEMENT*,HYPER_SURF*,double,double*);
 IMPORT  void    first_order_point_propagate(Front*,POINTER, POINT*, POINT*,
 		                HYPER_SURF_ELEMENT*,HYPER_SURF*,double,double*);
+IMPORT	boolean	batch_point_propagate(Front*,int,POINT**,POINT**,
+				HYPER_SURF_ELEMENT**,HYPER_SURF**,double);
 IMPORT	void    find_position_along_wall(double*,TN*,double,const Tparams*,
 				Front*);
 IMPORT  void    print_TN(TN*);
@@ -574,6 +577,27 @@ IMPORT  int     vortex_vel(POINTER,Front*,POINT*,HYPER_SURF_ELEMENT*,
 		                        HYPER_SURF*,double*);
 IMPORT  int     double_vortex_vel(POINTER,Front*,POINT*,HYPER_SURF_ELEMENT*,
 		                        HYPER_SURF*,double*);
+/*	Batched functions of velocity field */
+IMPORT	int	translation_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	radial_motion_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	sine_motion_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	circular_rotation_vel_batch(POINTER,Front*,int,double**,
+			double**,double*,double**);
+IMPORT	int	normal_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	curvature_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	burgers_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	bipolar_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	vortex_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
+IMPORT	int	double_vortex_vel_batch(POINTER,Front*,int,double**,double**,
+			double*,double**);
 
 	/*	fredist.c*/
 IMPORT	boolean	f_perform_redistribution(HYPER_SURF*,Front*,boolean);
@@ -693,6 +717,13 @@ IMPORT  void    scatter_top_grid_vec_float_array(GRID_TYPE,double**,Front*);
 IMPORT  void    scatter_cell_index(Front*,int*,int*,GRID_TYPE,POINTER);
 IMPORT  void    scatter_comp_grid_cell_index(Front*,POINTER);
 IMPORT	boolean	cpu_adapt_front(Front*,double,int*,int*);
+IMPORT	void	partition_slice(int,int,int,int*,int*);
+IMPORT	boolean	uniform_front_partition(Front*);
+IMPORT	void	print_front_partition(Front*,const char*);
+IMPORT	boolean	read_front_partition(const char*,int,int*,int**);
+IMPORT	double	intfc_element_weight(Front*,double,double);
+IMPORT	boolean	balance_front_partition(Front*,double,double,int**);
+IMPORT	boolean	shift_front_subdomain(Front*,int**,int*,int*);
 IMPORT	boolean	f_intfc_communication1d(Front*);
 IMPORT  void    pp_clip_rect_grids(Front*,int[3][2]);
 
@@ -703,6 +734,7 @@ IMPORT	void	delete_subdomain_curves(INTERFACE*);
 IMPORT  boolean    merge_interface(Front*,int);
 IMPORT  void    clip_to_interior_region(INTERFACE*,int*,int*);
 IMPORT  void    copy_interface_into(INTERFACE*,INTERFACE*);
+IMPORT	INTERFACE *assemble_intfc_pieces2d(Front*,INTERFACE**,int*);
 
 	/* fscat3d1.c*/
 IMPORT	CURVE	*matching_curve(CURVE*,P_LINK*,int);
@@ -740,6 +772,7 @@ IMPORT  void    average_btris(TRI*,SURFACE*,TRI*,SURFACE*);
 	/* fscat3d3.c*/
 IMPORT	boolean	f_intfc_communication3d3(Front*);
 IMPORT 	INTERFACE *collect_hyper_surface(Front*,int*,int);
+IMPORT	INTERFACE *assemble_intfc_pieces3d(INTERFACE**,int*);
 
 	/* fstate.c*/
 IMPORT	ConstantFlowRegion	*SetConstantFlowRegion(COMPONENT,Locstate,
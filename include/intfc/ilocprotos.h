@@ -48,6 +48,10 @@ IMPORT	POINTER	copy_e_comps(INTERFACE*);
 /*	iblkb.c*/
 IMPORT	int construct_bdry_blk(BLK_CRX*,BLK_TRI*);
 
+/*	ibvh.c*/
+IMPORT	double	bvh_nearest_search(INTFC_BVH*,const double*,
+				   double (*)(BVH_ELEM*,POINTER),POINTER);
+
 /*	igrid.c*/
 
 /*	intfc.c*/
@@ -487,6 +487,21 @@ struct _INTERFACE
 };
 typedef struct _INTERFACE INTERFACE;
 
+	/* Current interface and its table, see set_thread_interface() */
+struct _INTFC_CONTEXT {
+	struct Table	*IT;
+	INTERFACE	*intfc;
+};
+typedef struct _INTFC_CONTEXT INTFC_CONTEXT;
+
+	/* Leaf element of the interface bounding volume hierarchy (ibvh.c) */
+struct _BVH_ELEM {
+	HYPER_SURF_ELEMENT *hse;	/* BOND in 2D, TRI in 3D */
+	HYPER_SURF	   *hs;		/* CURVE or SURFACE of hse */
+};
+typedef struct _BVH_ELEM BVH_ELEM;
+typedef struct _INTFC_BVH INTFC_BVH;
+
 #define interface_reconstructed(intfc) ((intfc)->_interface_reconstructed)
 #define static_mesh(intfc) ((intfc)->_static_mesh)
 #define Dimension(intfc) ((intfc)->dim)
@@ -619,6 +634,10 @@ struct _BLK_CRX {
 };
 typedef struct _BLK_CRX BLK_CRX;
 
+enum {
+	MAX_BLK_REC_TRIS = 8	/* Most triangles of a two component block */
+};
+
 struct _BLK_TRI {
         TRI             *first[12];
         BOND            *bonds[12];
@@ -635,6 +654,11 @@ struct _BLK_TRI {
         BLK_INFO        *blk_info;
 	double		area;
 	double		volume_fraction;
+	/* triangles of a two component block, see record_comp2_blk() */
+	boolean		record_tris;
+	int		num_rec_tris;
+	POINT		*rec_tris[MAX_BLK_REC_TRIS][3];
+	SURFACE		*rec_surfs[MAX_BLK_REC_TRIS];
 };
 typedef struct _BLK_TRI BLK_TRI;
 
@@ -63,6 +63,15 @@ IMPORT  void	fprint_comp_equiv_lists(FILE*,INTERFACE*);
 IMPORT  void	fprint_comp_equiv_lists(FILE*,INTERFACE*);
 IMPORT	void	set_equivalent_comps(COMPONENT,COMPONENT,INTERFACE*);
 
+/*	ibvh.c*/
+IMPORT	INTFC_BVH	*interface_bvh(INTERFACE*);
+IMPORT	boolean	interface_ray_crossing(INTERFACE*,HYPER_SURF*,const double*,
+				const double*,double,double*,
+				HYPER_SURF_ELEMENT**,HYPER_SURF**);
+IMPORT	void	copy_interface_bvh(INTERFACE*,INTERFACE*);
+IMPORT	void	free_interface_bvh(INTERFACE*);
+IMPORT	void	reset_interface_bvh(INTERFACE*);
+
 /*	ifourier.c*/
 IMPORT  FOURIER_POLY    *get_fourier_bubble(double*,double*,int,const char*);
 IMPORT  FOURIER_POLY    *get_fourier_multi_mode(double*,double*,int,const char*);
@@ -92,6 +101,8 @@ IMPORT	CURVE	*i_make_curve(COMPONENT,COMPONENT,NODE*,NODE*);
 IMPORT	CURVE	*join_curves(CURVE*,CURVE*,COMPONENT,COMPONENT,BOND**);
 IMPORT	INTERFACE	*i_copy_interface(INTERFACE*);
 IMPORT	INTERFACE	*current_interface(void);
+IMPORT	INTERFACE	*set_thread_interface(INTERFACE*);
+IMPORT	INTFC_CONTEXT	*enter_interface_context(INTERFACE*,INTFC_CONTEXT*);
 IMPORT	INTERFACE	*make_interface(int);
 IMPORT	INTERFACE	*read_print_interface(INIT_DATA*,const IO_TYPE*,
                                               boolean,int*);
@@ -108,6 +119,7 @@ IMPORT	POINT	*i_make_point(double*,COMPONENT,COMPONENT);
 IMPORT	POINTER	init_table_Store(size_t,INIT_DATA*);
 IMPORT	POINTER	Store(size_t);
 IMPORT	POINTER	store(size_t);
+IMPORT	POINTER	store_in_interface(INTERFACE*,size_t);
 IMPORT	boolean	exists_interface(INTERFACE*);
 IMPORT	boolean	i_delete_end_of_bond(BOND*,CURVE*);
 IMPORT	boolean	i_delete_node(NODE*);
@@ -134,12 +146,14 @@ IMPORT	uint64_t	node_number(NODE*);
 IMPORT	uint64_t	point_number(POINT*);
 IMPORT	uint64_t	table_number(struct Table*);
 IMPORT	int	i_read_boundary_type_from_string(const char*);
+IMPORT	void	compact_interface(INTERFACE*);
 IMPORT	void	delete_from_cross_list(CROSS*);
 IMPORT	void	fprint_hypersurface(FILE*,HYPER_SURF*);
 IMPORT	void	i_fprint_interface(FILE*,INTERFACE*);
 IMPORT	void	print_hypersurface(HYPER_SURF*);
 IMPORT	void	print_hypersurface_boundaries(HYPER_SURF_BDRY**);
 IMPORT	void	set_current_interface(INTERFACE*);
+IMPORT	void	leave_interface_context(INTFC_CONTEXT*);
 IMPORT	POINT *i_average_points(boolean,POINT*,HYPER_SURF_ELEMENT*,HYPER_SURF*,
 	                             POINT*,HYPER_SURF_ELEMENT*,HYPER_SURF*);
 IMPORT	ORIENTATION orientation_of_bond_at_tri(BOND*,TRI*);
@@ -446,6 +460,9 @@ IMPORT	boolean	i_undo_insert_point_in_tri(POINT*,TRI*,SURFACE*);
 IMPORT	boolean	i_undo_insert_point_in_tri_side(POINT*,int,TRI*,SURFACE*);
 IMPORT  boolean    tri_edge_crossing(TRI*,double*,double*,int,int*,int*,double*);
 IMPORT	void	assign_tri_icoords(RECT_GRID*,TRI*);
+IMPORT	void	free_topo_tiles3d(struct Table*);
+IMPORT	void	set_comp_of_block3d(struct Table*,int,int,int,COMPONENT);
+IMPORT	void	topo_block_icoords3d(struct Table*,int,int*);
 IMPORT  boolean    line_tri_crossing(double*,TRI*,double*,double*,double);
 IMPORT  boolean    line_point_projection(double*,int*,double*,double*,double*,double);
 IMPORT  boolean    is_tri_outside(INTERFACE*,TRI*,RECT_GRID*);
@@ -609,9 +626,12 @@ IMPORT  void 	check_global_index(INTERFACE*);
 
 /*	userhooks.c */
 IMPORT	BOND	*Bond(POINT*,POINT*);
+IMPORT	BOND	*Bond_in_interface(INTERFACE*,POINT*,POINT*);
 IMPORT	CURVE	*attach_curve_to_node(CURVE*,POINT*,BOND*,NODE*);
 IMPORT	CURVE	*copy_curve(CURVE*,NODE*,NODE*);
 IMPORT	CURVE	*make_curve(COMPONENT,COMPONENT,NODE*,NODE*);
+IMPORT	CURVE	*make_curve_in_interface(INTERFACE*,COMPONENT,COMPONENT,
+					NODE*,NODE*);
 IMPORT	CURVE	*read_curve(INTERFACE*,int);
 IMPORT	HYPER_SURF *make_hypersurface(COMPONENT,COMPONENT);
 IMPORT	HYPER_SURF_BDRY	*make_hypersurface_boundary(void);
@@ -620,8 +640,10 @@ IMPORT	INTERFACE	*zoom_interface(INTERFACE*,RECT_GRID*,
 					double*,double*,double**);
 IMPORT	NODE	*copy_node(NODE*);
 IMPORT	NODE	*make_node(POINT*);
+IMPORT	NODE	*make_node_in_interface(INTERFACE*,POINT*);
 IMPORT	NODE	*read_node(INTERFACE*,int);
 IMPORT	POINT	*Point(double*);
+IMPORT	POINT	*Point_in_interface(INTERFACE*,double*);
 IMPORT	POINT	*Static_point(INTERFACE*);
 IMPORT	POINT	*average_points(boolean,POINT*,HYPER_SURF_ELEMENT*,HYPER_SURF*,
 	                             POINT*,HYPER_SURF_ELEMENT*,HYPER_SURF*);
@@ -937,6 +959,9 @@ IMPORT	void    compute_point_smooth(SMOOTH_PARA*,SMOOTH_TOL*,INTERFACE*);
 /*      iblkc2.c */
 IMPORT  BLK_CRX *alloc_blk_crx(boolean);
 IMPORT  int     construct_comp2_blk(BLK_CRX*,BLK_TRI*);
+IMPORT  void    init_comp2_blk_cases(void);
+IMPORT  boolean record_comp2_blk(BLK_CRX*,BLK_TRI*,BLK_CRX*);
+IMPORT  void    emit_comp2_blk(BLK_TRI*);
 IMPORT  void    stitch_inside_blk(BLK_TRI*);
 IMPORT  void    stitch_adj_blk(BLK_TRI*,BLK_TRI*);
 IMPORT  void    remove_null_pair(BLK_TRI*,BLK_TRI*,int);
@@ -73,6 +73,30 @@ struct Chunk {
 
 
 
+/*
+*	In 3D the topological grid blocks are grouped into cubic tiles of
+*	TOPO_TILE_SIZE^3 blocks.  A tile that lies entirely in one component
+*	stores only that label,  and tiles with mixed labels carry a page of
+*	per block components.  Tiles crossed by the front are numbered by
+*	a tri page,  and the blocks of the tri pages index a compressed
+*	sparse row table:  the TRIS and SURFACES of block id are stored
+*	contiguously in tristore[] and surfacestore[] from tri_offsets[id]
+*	to tri_offsets[id+1].  Use the Block3d macros below rather than
+*	accessing the tiles directly.
+*/
+
+#define	TOPO_TILE_SHIFT		3
+#define	TOPO_TILE_SIZE		(1 << TOPO_TILE_SHIFT)
+#define	TOPO_TILE_MASK		(TOPO_TILE_SIZE - 1)
+#define	TOPO_TILE_VOLUME	(TOPO_TILE_SIZE*TOPO_TILE_SIZE*TOPO_TILE_SIZE)
+
+struct _TOPO_TILE {
+	COMPONENT	comp;		/* Label of a homogeneous tile */
+	COMPONENT	*comps;		/* Block labels, NULL if homogeneous */
+	int		page;		/* Tri page, -1 if off front */
+};
+typedef struct _TOPO_TILE TOPO_TILE;
+
 struct Table {
 	struct Table 	*next; 		/* Pointer to Next Table */
 	struct Table 	*prev; 		/* Pointer to Previous Table */
@@ -132,10 +156,11 @@ struct Table {
 	CURVE		**curvestore;	/* Storage for CURVE Lists */
 
 	/* THREED */
-	COMPONENT	***compon3d;	/* COMPONENT in each Grid Block */
-	int		***num_of_tris;	/* Number TRIS in each Grid Block */
-	TRI		*****tris;	/* TRI lists in each Grid Block */
-	SURFACE		*****surfaces;	/* SURFACE lists in each Grid Block */
+	struct _TOPO_TILE *topo_tiles;	/* Block-sparse tiles of Grid Blocks */
+	int		topo_tile_gmax[3];	/* Number of tiles in each dir */
+	int		num_tri_pages;	/* Number of tiles crossed by front */
+	int		*tri_page_tiles;/* Tile index of each tri page */
+	int		*tri_offsets;	/* CSR row offsets into tristore */
 	double		***area;	/* Surface area in each Grid Block */
 	double		***vol_frac;	/* Volume frac in each Grid Block */
 	BLOCK		*surf_blocks;	/* bounding boxes for each surface */
@@ -143,8 +168,11 @@ struct Table {
 
 			/* Quantities used by loc_comp_list: */
 	
-	TRI		**tristore;	/* Storage for TRI Lists */
-	SURFACE		**surfacestore;	/* Storage for SURFACE Lists */
+	TRI		**tristore;	/* Packed TRI Lists of all blocks */
+	SURFACE		**surfacestore;	/* Packed SURFACE Lists of all blocks */
+
+			/* Global nearest point and ray queries: */
+	struct _INTFC_BVH *bvh;		/* Hierarchy of BONDS or TRIS */
 
 			/* Quantities used by next_point(): */
 	POINT		**cur_point;
@@ -236,4 +264,35 @@ enum {
 #define	max_pp_index(intfc)	((intfc)->table->max_pp_indx)
 
 #define topological_grid(intfc) ((intfc)->table->rect_grid)  /* NOT A POINTER */
+
+#define	Topo_tile3d(T,ix,iy,iz)						\
+	((T)->topo_tiles[((((iz) >> TOPO_TILE_SHIFT)*(T)->topo_tile_gmax[1] +	\
+	  ((iy) >> TOPO_TILE_SHIFT))*(T)->topo_tile_gmax[0] +		\
+	  ((ix) >> TOPO_TILE_SHIFT))])
+
+#define	Topo_index_in_tile3d(ix,iy,iz)					\
+	(((((iz) & TOPO_TILE_MASK) << TOPO_TILE_SHIFT) |			\
+	  ((iy) & TOPO_TILE_MASK)) << TOPO_TILE_SHIFT | ((ix) & TOPO_TILE_MASK))
+
+#define	Comp_of_block3d(T,ix,iy,iz)					\
+	((Topo_tile3d(T,ix,iy,iz).comps != NULL) ?			\
+	 Topo_tile3d(T,ix,iy,iz).comps[Topo_index_in_tile3d(ix,iy,iz)] :	\
+	 Topo_tile3d(T,ix,iy,iz).comp)
+
+#define	Topo_block_id3d(T,ix,iy,iz)					\
+	(Topo_tile3d(T,ix,iy,iz).page*TOPO_TILE_VOLUME +		\
+	 Topo_index_in_tile3d(ix,iy,iz))
+
+#define	Num_tris_in_block3d(T,ix,iy,iz)					\
+	((Topo_tile3d(T,ix,iy,iz).page < 0) ? 0 :			\
+	 (T)->tri_offsets[Topo_block_id3d(T,ix,iy,iz)+1] -		\
+	 (T)->tri_offsets[Topo_block_id3d(T,ix,iy,iz)])
+
+#define	Tris_in_block3d(T,ix,iy,iz)					\
+	((Topo_tile3d(T,ix,iy,iz).page < 0) ? NULL :			\
+	 (T)->tristore + (T)->tri_offsets[Topo_block_id3d(T,ix,iy,iz)])
+
+#define	Surfs_in_block3d(T,ix,iy,iz)					\
+	((Topo_tile3d(T,ix,iy,iz).page < 0) ? NULL :			\
+	 (T)->surfacestore + (T)->tri_offsets[Topo_block_id3d(T,ix,iy,iz)])
 #endif /* !defined(_TABLE_H) */
@@ -289,6 +289,15 @@ typedef struct _COMPLEX	COMPLEX;
 #define   EXPORT      
 #define   LIB_LOCAL
 
+	/* Storage class of per thread variables (see ppthread.c) */
+#if defined(__GNUC__) || defined(__INTEL_COMPILER)
+#define   FT_THREAD_LOCAL	__thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define   FT_THREAD_LOCAL	_Thread_local
+#else
+#define   FT_THREAD_LOCAL
+#endif
+
 /****
 *******************Proper use of IMPORT,  LOCAL,  and EXPORT ******************
 
@@ -179,6 +179,15 @@ IMPORT	void	u_pp_irecv(int,int,POINTER,size_t,MPI_Request*,const char*,int);
 IMPORT	void	u_pp_isend(int,POINTER,size_t,int,MPI_Request*,const char*,int);
 #endif /* defined(__MPI__) */
 
+/* ppthread.c */
+IMPORT	POINTER	pp_thread_scratch(size_t);
+IMPORT	int	pp_num_threads(void);
+IMPORT	int	pp_thread_num(void);
+IMPORT	void	pp_parallel_for(long,long,void(*)(long,long,POINTER),POINTER);
+IMPORT	void	pp_thread_finalize(void);
+IMPORT	void	pp_thread_init(int);
+IMPORT	void	pp_thread_limit(int);
+
 /* quad.c*/
 IMPORT	double	dqng(double(*)(double,POINTER),POINTER,double,double,double,
 	             double,double*,int*,QUADRATURE_STATUS*);
@@ -306,6 +315,15 @@ IMPORT  int   	endian_int_swap(int);
 IMPORT  boolean	hardware_is_little_endian(void);
 IMPORT  int	count_digits(int);
 
+/* zio.c */
+IMPORT	FILE	*fopen_uncompressed(const char*);
+IMPORT	boolean	is_compressed_output(void);
+IMPORT	size_t	fread_compressed_array(FILE*,void*,size_t,size_t);
+IMPORT	size_t	fread_compressed_array_range(FILE*,void*,size_t,size_t,size_t);
+IMPORT	void	fcompress_and_close(FILE*,const char*);
+IMPORT	void	fwrite_compressed_array(FILE*,const void*,size_t,size_t);
+IMPORT	void	set_compressed_output(boolean);
+
 /* fft.c */
 IMPORT 	boolean 	fft2d(COMPLEX**,int,int,int);
 IMPORT 	boolean 	fft(int,int,double*,double*);
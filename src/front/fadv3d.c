@@ -36,6 +36,7 @@ LOCAL	int	propagate_3d_front(POINTER,Front*,Front*,double,double*,boolean);
 LOCAL   int	propagate_node_points(Front*,Front*,POINTER,double,double*);
 LOCAL	void	propagate_curve_points(Front*,Front*,POINTER,double);
 LOCAL   void    propagate_surface_points(Front*,Front*,POINTER,double,double*);
+LOCAL   void    propagate_surface_point_pairs(Front*,Front*,POINTER,double);
 LOCAL 	int 	propagate_points_tangentially(Front*,Front*,int,double,double*,
 						  int);
 LOCAL	int	simple_advance_front3d(double,double*,Front*,Front**,POINTER);
@@ -1358,6 +1359,15 @@ LOCAL void propagate_surface_points(
 
         start_clock("propagate_surface_points");
 
+	if (front->parallel_point_propagate == YES ||
+	    front->batch_vfunc != NULL)
+	{
+	    propagate_surface_point_pairs(front,newfront,wave,dt);
+            stop_clock("propagate_surface_points");
+            DEBUG_LEAVE(propagate_surface_points)
+	    return;
+	}
+
 	(void) next_point(intfc_old,NULL,NULL,NULL);
         (void) next_point(intfc_new,NULL,NULL,NULL);
         while (next_point(intfc_old,&oldp,&oldhse,&oldhs) &&
@@ -1378,6 +1388,125 @@ LOCAL void propagate_surface_points(
         DEBUG_LEAVE(propagate_surface_points)
 }               /*end propagate_surface_points*/
 
+/*
+*		propagate_surface_point_pairs():
+*
+*	Threaded and batched version of propagate_surface_points(). The
+*	old to new point correspondence is first collected by walking both
+*	interfaces with next_point() in lockstep, the pairs are then
+*	propagated independently, either through batch_point_propagate()
+*	or by point_propagate(). Each call of point_propagate() only reads
+*	the old interface and writes the new point, so threading is valid
+*	whenever front->vfunc and front->_point_propagate are reentrant,
+*	as declared through VELO_FUNC_PACK.reentrant.
+*
+*	next_point() returns a curve point once for each surface next to
+*	it, and the start point of a closed curve twice.  The serial loop
+*	propagates such a point at each visit, so its position is that of
+*	its last propagating visit, and its states those of its last visit.
+*	Only these visits are kept here, so that no point is propagated by
+*	two threads.
+*/
+
+LOCAL void propagate_surface_point_pairs(
+        Front           *front,
+        Front           *newfront,
+        POINTER         wave,
+        double           dt)
+{
+        INTERFACE               *intfc_old = front->interf;
+        INTERFACE               *intfc_new = newfront->interf;
+        HYPER_SURF              *oldhs, *newhs;
+        HYPER_SURF_ELEMENT      *oldhse, *newhse;
+        POINT                   *oldp, *newp;
+	POINT			**oldpts,**newpts;
+	POINT			**cpold,**cpnew;
+	HYPER_SURF_ELEMENT	**oldhses;
+	HYPER_SURF		**oldhss;
+	int			i,m,n,num_pts,num_cps;
+
+	num_pts = 0;
+	(void) next_point(intfc_old,NULL,NULL,NULL);
+        while (next_point(intfc_old,&oldp,&oldhse,&oldhs))
+	    ++num_pts;
+	if (num_pts == 0) return;
+
+	uni_array(&oldpts,num_pts,sizeof(POINT*));
+	uni_array(&newpts,num_pts,sizeof(POINT*));
+	uni_array(&oldhses,num_pts,sizeof(HYPER_SURF_ELEMENT*));
+	uni_array(&oldhss,num_pts,sizeof(HYPER_SURF*));
+	uni_array(&cpold,num_pts,sizeof(POINT*));
+	uni_array(&cpnew,num_pts,sizeof(POINT*));
+
+	n = 0;
+	(void) next_point(intfc_old,NULL,NULL,NULL);
+        (void) next_point(intfc_new,NULL,NULL,NULL);
+        while (next_point(intfc_old,&oldp,&oldhse,&oldhs) &&
+             next_point(intfc_new,&newp,&newhse,&newhs))
+        {
+	    oldpts[n] = oldp;
+	    newpts[n] = newp;
+	    oldhses[n] = oldhse;
+	    oldhss[n] = oldhs;
+	    ++n;
+	}
+
+	/* Points whose last visit copies the old states */
+	num_cps = 0;
+	for (i = 0; i < n; ++i)
+	    sorted(newpts[i]) = NO;
+	for (i = n-1; i >= 0; --i)
+	{
+	    if (sorted(newpts[i]))
+		continue;
+	    sorted(newpts[i]) = YES;
+	    if (Boundary_point(newpts[i]) && wave_type(oldhss[i]) != 
+			FIRST_PHYSICS_WAVE_TYPE)
+	    {
+		cpold[num_cps] = oldpts[i];
+		cpnew[num_cps] = newpts[i];
+		++num_cps;
+	    }
+	}
+
+	/* Last propagating visit of each point, packed into [m,n) */
+	for (i = 0; i < n; ++i)
+	    sorted(newpts[i]) = NO;
+	m = n;
+	for (i = n-1; i >= 0; --i)
+	{
+	    if (sorted(newpts[i]) || (Boundary_point(newpts[i]) &&
+			wave_type(oldhss[i]) != FIRST_PHYSICS_WAVE_TYPE))
+		continue;
+	    sorted(newpts[i]) = YES;
+	    --m;
+	    oldpts[m] = oldpts[i];
+	    newpts[m] = newpts[i];
+	    oldhses[m] = oldhses[i];
+	    oldhss[m] = oldhss[i];
+	}
+
+	if (!batch_point_propagate(front,n-m,oldpts+m,newpts+m,oldhses+m,
+				oldhss+m,dt))
+	{
+#pragma omp parallel for schedule(dynamic,256) \
+		if (front->parallel_point_propagate == YES)
+	    for (i = m; i < n; ++i)
+	    {
+	    	double Vp[MAXD];
+	    	point_propagate(front,wave,oldpts[i],newpts[i],oldhses[i],
+				oldhss[i],dt,Vp);
+	    }
+	}
+	for (i = 0; i < num_cps; ++i)
+	{
+	    ft_assign(left_state(cpnew[i]),left_state(cpold[i]),front->sizest);
+	    ft_assign(right_state(cpnew[i]),right_state(cpold[i]),
+				front->sizest);
+	}
+	free_these(6,oldpts,newpts,oldhses,oldhss,cpold,cpnew);
+}		/*end propagate_surface_point_pairs*/
+
 LOCAL int struct_advance_front3d(
 	double		dt,
 	double		*dt_frac,
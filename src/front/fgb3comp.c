@@ -74,9 +74,9 @@ LOCAL   void  tecplot_tris_in_box(
 	FILE		*fp;
 	char		fname1[100];
 
-	tris = T->tris[ibz][iby][ibx];
-	surfs = T->surfaces[ibz][iby][ibx];
-	num_tris = T->num_of_tris[ibz][iby][ibx];
+	tris = Tris_in_block3d(T,ibx,iby,ibz);
+	surfs = Surfs_in_block3d(T,ibx,iby,ibz);
+	num_tris = Num_tris_in_block3d(T,ibx,iby,ibz);
 
 	if(num_tris == 0)
 	    return;
@@ -651,11 +651,11 @@ static CURVE_CRX_SORT    *c_crx = NULL;
 	    {
 	        for (iz = iz1; iz <= iz2; ++iz)
 	        {
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 	                continue;
-	            t = T->tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
-	            for (k = 0; k < T->num_of_tris[iz][iy][ix]; ++k, ++t, ++s)
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
+	            for (k = 0; k < Num_tris_in_block3d(T,ix,iy,iz); ++k, ++t, ++s)
 	            {
 		        if(is_wall_surface(*s))
 	        	    continue;
@@ -769,11 +769,11 @@ static CURVE_CRX_SORT    *c_crx = NULL;
 	    {
 	        for (iz = iz1; iz <= iz2; ++iz)
 	        {
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 	                continue;
-	            t = T->tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
-	            for (k = 0; k < T->num_of_tris[iz][iy][ix]; ++k, ++t, ++s)
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
+	            for (k = 0; k < Num_tris_in_block3d(T,ix,iy,iz); ++k, ++t, ++s)
 	            {
 		        if(is_wall_surface(*s))
 	        	    continue;
@@ -2183,7 +2183,6 @@ LOCAL boolean intfc_near_point(
 {
 RECT_GRID      *gr = &topological_grid(intfc);
 Table	       *T = table_of_interface(intfc);
-COMPONENT      ***comp = T->compon3d;
 int	       *gmax = gr->gmax;
 int	       ix, iy, iz, i, ip1[3], ip2[3];
 double	       p0[3], tol = 1.0e-5;
@@ -2211,8 +2210,8 @@ double	       p0[3], tol = 1.0e-5;
 		    if(iz < 0 || iz >= gmax[2])
 		        return YES;
 		    
-		    if(comp[iz][iy][ix] == ONFRONT || 
-		       comp[iz][iy][ix] == ON_RECT_BOUNDARY)
+		    if(Comp_of_block3d(T,ix,iy,iz) == ONFRONT || 
+		       Comp_of_block3d(T,ix,iy,iz) == ON_RECT_BOUNDARY)
 		        return YES;
 		}
 	    }
@@ -2221,7 +2220,7 @@ double	       p0[3], tol = 1.0e-5;
 	/*printf("#blk  %d  %d  %d\n",ip2[0]-ip1[0]+1,ip2[1]-ip1[1]+1,  */
 	/*    ip2[2]-ip1[2]+1); */
 
-	*c = comp[ip1[2]][ip1[1]][ip1[0]];
+	*c = Comp_of_block3d(T,ip1[0],ip1[1],ip1[2]);
 	
 	return NO;
 }
@@ -452,9 +452,7 @@ EXPORT	boolean	merge_near_interface(
 	topological_grid(intfc) = gr_save;
         free_crx_storage(intfc);
 	
-	front->interf = copy_interface(intfc);
-	
-	delete_interface(intfc);
+	compact_interface(intfc);
 	
 	DEBUG_LEAVE(merge_near_interface)
 	
@@ -687,10 +685,8 @@ EXPORT	boolean	repair_intfc_at_crossings3d(
 	
 	set_size_of_intfc_state(sizest);
 	set_copy_intfc_states(YES);
-	front->interf = copy_interface(intfc);
-	
-	delete_interface(intfc);
-	print_storage("After copy_interface","crx_store");
+	compact_interface(intfc);
+	print_storage("After compact_interface","crx_store");
 	if (debugging("trace"))
 	    (void) printf("Leaving repair_intfc_at_crossings3d()\n");
 	return YES;
@@ -796,11 +792,10 @@ EXPORT	boolean	rebuild_intfc_at_crossings3d2(
 	reset_intfc_num_points(intfc);
 	topological_grid(intfc) = gr_save;
         free_crx_storage(intfc);
-	front->interf = copy_interface(intfc);
-	delete_interface(intfc);
+	compact_interface(intfc);
 
-	interface_reconstructed(front->interf) = YES;
-	print_storage("After copy_interface","crx_store");
+	interface_reconstructed(intfc) = YES;
+	print_storage("After compact_interface","crx_store");
 	DEBUG_LEAVE(rebuild_intfc_at_crossings3d)
 	return YES;
 }	/*end rebuild_intfc_at_crossings3d*/
@@ -3104,8 +3099,8 @@ LOCAL   boolean boxes_sharing_tris(
 	    {
 	        for (i = box1->bmin[0]; i <= upbound[0]; ++i)
 		{
-		    tris = T->tris[k][j][i];
-		    nt = T->num_of_tris[k][j][i];
+		    tris = Tris_in_block3d(T,i,j,k);
+		    nt = Num_tris_in_block3d(T,i,j,k);
 		    for (l = 0; l < nt; ++l)
 		    {
 		        if (!tri_recorded(tris[l],tri_list1,num_tris1))
@@ -3120,8 +3115,8 @@ LOCAL   boolean boxes_sharing_tris(
 	{
 	    for (i = box1->bmin[0]; i <= upbound[0]; ++i)
 	    {
-	        tris = T->tris[k][j][i];
-		nt = T->num_of_tris[k][j][i];
+	        tris = Tris_in_block3d(T,i,j,k);
+		nt = Num_tris_in_block3d(T,i,j,k);
 		for (l = 0; l < nt; ++l)
 		{
 		    if (!tri_recorded(tris[l],tri_list1,num_tris1))
@@ -3136,8 +3131,8 @@ LOCAL   boolean boxes_sharing_tris(
 	{
 	    for (j = box1->bmin[1]; j <= upbound[1]; ++j)
 	    {
-	        tris = T->tris[k][j][i];
-		nt = T->num_of_tris[k][j][i];
+	        tris = Tris_in_block3d(T,i,j,k);
+		nt = Num_tris_in_block3d(T,i,j,k);
 		for (l = 0; l < nt; ++l)
 		{
 		    if (!tri_recorded(tris[l],tri_list1,num_tris1))
@@ -3160,8 +3155,8 @@ LOCAL   boolean boxes_sharing_tris(
 	    {
 	        for (i = box2->bmin[0]; i <= upbound[0]; ++i)
 		{
-		    tris = T->tris[k][j][i];
-		    nt = T->num_of_tris[k][j][i];
+		    tris = Tris_in_block3d(T,i,j,k);
+		    nt = Num_tris_in_block3d(T,i,j,k);
 		    for (l = 0; l < nt; ++l)
 		    {
 		        if (!tri_recorded(tris[l],tri_list2,num_tris2))
@@ -3176,8 +3171,8 @@ LOCAL   boolean boxes_sharing_tris(
 	{
 	    for (i = box2->bmin[0]; i <= upbound[0]; ++i)
 	    {
-	        tris = T->tris[k][j][i];
-		nt = T->num_of_tris[k][j][i];
+	        tris = Tris_in_block3d(T,i,j,k);
+		nt = Num_tris_in_block3d(T,i,j,k);
 		for (l = 0; l < nt; ++l)
 		{
 		    if (!tri_recorded(tris[l],tri_list2,num_tris2))
@@ -3192,8 +3187,8 @@ LOCAL   boolean boxes_sharing_tris(
 	{
 	    for (j = box2->bmin[1]; j <= upbound[1]; ++j)
 	    {
-	        tris = T->tris[k][j][i];
-		nt = T->num_of_tris[k][j][i];
+	        tris = Tris_in_block3d(T,i,j,k);
+		nt = Num_tris_in_block3d(T,i,j,k);
 		for (l = 0; l < nt; ++l)
 		{
 		    if (!tri_recorded(tris[l],tri_list2,num_tris2))
@@ -6503,9 +6498,7 @@ EXPORT	boolean	rbox_repair_intfc(
 	reset_intfc_num_points(intfc);
         free_crx_storage(intfc);
 	
-	front->interf = copy_interface(intfc);
-	
-	delete_interface(intfc);
+	compact_interface(intfc);
 	DEBUG_LEAVE(rbox_repair_intfc)
 	return YES;
 }
@@ -54,6 +54,18 @@ struct _GRID_PT {
 };
 typedef struct _GRID_PT GRID_PT;
 
+/* Blocks of reconstruct_intfc3d_in_box() for record_comp2_blks() */
+struct _RECON_BLKS {
+	BLK_TRI		*blk_mem_store;
+	int		**blk_ip;	/* indices of the blocks */
+	boolean		*recorded;
+	BLK_CRX		**blk_crx;	/* block and rotation, per thread */
+	BLK_INFO	*blk_info;
+	Table		*T;
+	RECT_GRID	*gr;
+};
+typedef struct _RECON_BLKS RECON_BLKS;
+
 /*set and check components */
 LOCAL	COMPONENT	next_side_comp_at_crx(GRID_PT*,CRXING*);
 LOCAL	COMPONENT	this_side_comp_at_crx(GRID_PT*,CRXING*);
@@ -81,13 +93,17 @@ LOCAL	int	rm_unphy_crx_along_grid_line(INTERFACE*,int*,int*,int*,int*,
 			     	GRID_DIRECTION,CRX_TYPE,int*,int**);
 
 /*insert grid crxings */
+LOCAL	int	block_grid_edges3d(const int*,const int*,int(*)[MAXD],int*);
+LOCAL	void	grid_edge_start3d(RECT_GRID*,const int*,const int*,double*);
 LOCAL   int     count_block_crossings(RECT_GRID*,int*,SURFACE**,TRI**,int,int*);
+LOCAL	void	flag_block_crossings(RECT_GRID*,TRI**,int,int*,unsigned char*);
 LOCAL   int     add_to_edge_list(SURFACE*,TRI*,int,CRX_STORE*,int*,double*,
 				int,int);
 LOCAL   void    add_to_crx_list(int*,int,INTERFACE*,TRI*,SURFACE*,CRXING*,
                                 CRX_STORE*,int*,int*,double*,int,int);
 LOCAL   void    insert_block_crossings(INTERFACE*,RECT_GRID*,CRXING*,int**,
-                                int*,TRI**,SURFACE**,int,int*,int*);
+                                int*,TRI**,SURFACE**,int,int*,int*,
+				const unsigned char*);
 LOCAL   void    linear_interp_coefs_3d_tri(double*,double*,TRI*);
 LOCAL   boolean set_comp_at_vertex(CRXING*,POINT*,TRI*,SURFACE*,int);
 LOCAL 	boolean two_side_vertex(POINT*,TRI*,SURFACE*,int);
@@ -95,8 +111,12 @@ LOCAL 	boolean two_side_vertex(POINT*,TRI*,SURFACE*,int);
 /*grid based reconstruction */
 LOCAL	void	 fill_block_crx(int,int,int,BLK_CRX*,int*,
 			       GRID_DIRECTION,INTERFACE*);
-LOCAL	void	 fill_block_curve_crx(int,int,BLK_CRX*,int*,
-			       GRID_DIRECTION,INTERFACE*);
+LOCAL	boolean	 blk_seg_crx(int,int,int,BLK_CRX*,int*,GRID_DIRECTION,
+			     Table*,int*);
+LOCAL	boolean	 blk_curve_crx(int,int,BLK_CRX*,int*,GRID_DIRECTION,
+			       Table*,int*);
+LOCAL	boolean	 set_blk_crx(BLK_CRX*,int,int,int,Table*,RECT_GRID*);
+LOCAL	void	 record_comp2_blks(long,long,POINTER);
 LOCAL   boolean     is_crx(int*,int*,int,int,int);
 LOCAL   void     install_curve_points_state(INTERFACE *);
 LOCAL   boolean     install_btri_states_from_crx(INTERFACE*,BOND_TRI*,CRXING*,
@@ -155,7 +175,6 @@ EXPORT 	boolean reconstruct_intfc3d_in_box_lgb(
 	int		*gmax = gr.gmax;
 	Table		*T = table_of_interface(intfc);
 	BLK_TRI		****blk_mem, *bm, *blk_mem_store;
-	COMPONENT	***compon;
 	COMPONENT	c;
 	COMPONENT	*comp = T->components;
 	int		ix, iy, iz, ixx, iyy, izz;
@@ -186,11 +205,10 @@ EXPORT 	boolean reconstruct_intfc3d_in_box_lgb(
         for (i = 0, s = intfc->surfaces; s && *s; ++i, ++s)
             ++blk_info.num_surfs;
 
-	compon = (table_of_interface(intfc))->compon3d;
 	for (iz = smin[2]; iz < smax[2]; ++iz)
 	    for (iy = smin[1]; iy < smax[1]; ++iy)
 	        for (ix = smin[0]; ix < smax[0]; ++ix)
-		    if (compon[iz][iy][ix] == ONFRONT)
+		    if (Comp_of_block3d(T,ix,iy,iz) == ONFRONT)
 		    	n_fr_blk++;
 
 
@@ -240,7 +258,7 @@ EXPORT 	boolean reconstruct_intfc3d_in_box_lgb(
 	            ixx = ix - smin[0];
 	            iyy = iy - smin[1];
 	            izz = iz - smin[2];
-	            if (compon[iz][iy][ix] == ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) == ONFRONT)
 	            {
 	                bm = blk_mem[izz][iyy][ixx] = &blk_mem_store[nbc++];
 	                bm->blk_info = blk_crx->blk_info = &blk_info;
@@ -364,7 +382,7 @@ EXPORT 	boolean reconstruct_intfc3d_in_box_lgb(
 		    	if (blk_info.do_volume_frac)
 			{
 			    area[ix][iy][iz] = 0.0;
-		    	    if (compon[iz][iy][ix] == volume_frac->comp_vfrac)
+		    	    if (Comp_of_block3d(T,ix,iy,iz) == volume_frac->comp_vfrac)
 			    	vol_frac[ix][iy][iz] = 1.0;
 		    	    else
 			    	vol_frac[ix][iy][iz] = 0.0;
@@ -382,7 +400,7 @@ EXPORT 	boolean reconstruct_intfc3d_in_box_lgb(
 	            ixx = ix - smin[0];
 	            iyy = iy - smin[1];
 	            izz = iz - smin[2];
-	            if (compon[iz][iy][ix] == ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) == ONFRONT)
 	            {
 	                bm = blk_mem[izz][iyy][ixx];
 	                if (bm->num_null_sides == 0)
@@ -430,21 +448,20 @@ EXPORT 	boolean reconstruct_intfc3d_in_box(
 	int		*gmax = gr.gmax;
 	Table		*T = table_of_interface(intfc);
 	BLK_TRI		****blk_mem, *bm, *blk_mem_store;
-	COMPONENT	***compon;
-	COMPONENT	c;
 	COMPONENT	*comp = T->components;
 	int		ix, iy, iz, ixx, iyy, izz;
-	int             ii, i, j, k, ic, nbc, ip[3];
+	int             i, j, nbc, **blk_ip;
 	SURFACE		**s;
 	static BLK_CRX	*blk_crx = NULL;
+	static BLK_CRX	**thr_crx = NULL;
+	static int	num_thr_crx = 0;
 	BLK_INFO        blk_info;
 	int       	n_fr_blk = 0;
-	boolean		do_volume_frac = YES;
-	double		*L = gr.L;
+	boolean		*recorded;
 	double		*h = gr.h;
 	double		***area,***vol_frac;
 	CURVE		**cc;
-	int             num_c,num_curve_crx;
+	int             num_c;
         int             sgmax[3];
 	char		db_name[40];
 	static CURVE    **new_c=NULL;
@@ -468,11 +485,10 @@ EXPORT 	boolean reconstruct_intfc3d_in_box(
 	}
 	num_c = blk_info.num_curves;
 
-	compon = (table_of_interface(intfc))->compon3d;
 	for (iz = smin[2]; iz < smax[2]; ++iz)
 	    for (iy = smin[1]; iy < smax[1]; ++iy)
 	        for (ix = smin[0]; ix < smax[0]; ++ix)
-		    if (compon[iz][iy][ix] == ONFRONT)
+		    if (Comp_of_block3d(T,ix,iy,iz) == ONFRONT)
 		    	n_fr_blk++;
 	
 	uni_array(&blk_info.surfs,blk_info.num_surfs,sizeof(SURFACE*));
@@ -517,6 +533,75 @@ EXPORT 	boolean reconstruct_intfc3d_in_box(
 	tri_array(&blk_mem,smax[2]-smin[2],smax[1]-smin[1],smax[0]-smin[0],
 	          sizeof(BLK_TRI*));
 	uni_array(&blk_mem_store,n_fr_blk,sizeof(BLK_TRI));
+	bi_array(&blk_ip,n_fr_blk,3,INT);
+	uni_array(&recorded,n_fr_blk,sizeof(boolean));
+
+	nbc = 0;
+	for (iz = smin[2]; iz < smax[2]; ++iz)
+	{
+	    for (iy = smin[1]; iy < smax[1]; ++iy)
+	    {
+	        for (ix = smin[0]; ix < smax[0]; ++ix)
+	        {
+	            ixx = ix - smin[0];
+	            iyy = iy - smin[1];
+	            izz = iz - smin[2];
+	            if (Comp_of_block3d(T,ix,iy,iz) == ONFRONT && is_crx(comp, gmax, ix, iy, iz))
+		    {
+	                blk_mem[izz][iyy][ixx] = &blk_mem_store[nbc];
+			blk_ip[nbc][0] = ix;
+			blk_ip[nbc][1] = iy;
+			blk_ip[nbc][2] = iz;
+			recorded[nbc++] = NO;
+		    }
+		    else
+	                blk_mem[izz][iyy][ixx] = NULL;
+	        }
+	    }
+	}
+
+	/*
+	*	The triangles of the two component blocks are found by the
+	*	threads and made in the block order below, which keeps the
+	*	triangle lists as those of a serial run.  The other blocks
+	*	make bonds and are done in the serial loop.
+	*/
+
+	if (pp_num_threads() > 1 && nbc > 1)
+	{
+	    RECON_BLKS rb;
+
+	    init_comp2_blk_cases();
+	    if (num_thr_crx < 2*pp_num_threads())
+	    {
+	    	BLK_CRX **tmp_crx;
+
+	    	uni_array(&tmp_crx,2*pp_num_threads(),sizeof(BLK_CRX*));
+	    	for (i = 0; i < num_thr_crx; ++i)
+		    tmp_crx[i] = thr_crx[i];
+	    	for (; i < 2*pp_num_threads(); ++i)
+		    tmp_crx[i] = alloc_blk_crx(i%2 == 0);
+		if (thr_crx != NULL)
+		    free(thr_crx);
+		thr_crx = tmp_crx;
+		num_thr_crx = 2*pp_num_threads();
+	    }
+	    for (i = 0; i < num_thr_crx; i += 2)
+	    {
+	    	thr_crx[i]->cell_volume = blk_crx->cell_volume;
+	    	thr_crx[i]->comp_vfrac = blk_crx->comp_vfrac;
+		for (j = 0; j < 3; ++j)
+		    thr_crx[i]->h[j] = blk_crx->h[j];
+	    }
+	    rb.blk_mem_store = blk_mem_store;
+	    rb.blk_ip = blk_ip;
+	    rb.recorded = recorded;
+	    rb.blk_crx = thr_crx;
+	    rb.blk_info = &blk_info;
+	    rb.T = T;
+	    rb.gr = &gr;
+	    pp_parallel_for((long)nbc,0,record_comp2_blks,(POINTER)&rb);
+	}
 
 	nbc = 0;
 	for (iz = smin[2]; iz < smax[2]; ++iz)
@@ -529,227 +614,67 @@ EXPORT 	boolean reconstruct_intfc3d_in_box(
 	            ixx = ix - smin[0];
 	            iyy = iy - smin[1];
 	            izz = iz - smin[2];
-	            if (compon[iz][iy][ix] == ONFRONT && is_crx(comp, gmax, ix, iy, iz))
+	            if (Comp_of_block3d(T,ix,iy,iz) == ONFRONT && is_crx(comp, gmax, ix, iy, iz))
 		    {
-	                bm = blk_mem[izz][iyy][ixx] = &blk_mem_store[nbc++];
-	                bm->blk_info = blk_crx->blk_info = &blk_info;
-			blk_crx->num_comps = 0;
-	                for (i = 0; i < 2; ++i)
-	                {
-	                    for (j = 0; j < 2; ++j)
-	                    {
-	                        for (k = 0; k < 2; ++k)
-	                        {
-	                            c = comp[d_index3d(ix+i,iy+j,iz+k,gmax)];
-				    for (ic = 0; ic < blk_crx->num_comps; ++ic)
-				    {
-				    	if (c == blk_crx->comps[ic])
-		                        {
-				            ++blk_crx->nv[ic];
-				            break;
-				        }
-				    }
-				    if (ic == blk_crx->num_comps)
-				    {
-				    	blk_crx->comps[ic] = c;
-					blk_crx->nv[ic] = 1;
-					++blk_crx->num_comps;
-				    }
-	                            blk_crx->comp[i][j][k] = c;
-	                            blk_crx->ix[i][j][k] = i;
-	                            blk_crx->iy[i][j][k] = j;
-	                            blk_crx->iz[i][j][k] = k;
-				    if (do_volume_frac)
-				    {
-				    	blk_crx->corner_coords[i][j][k][0] =
-						L[0] + (ix + i)*h[0];
-				    	blk_crx->corner_coords[i][j][k][1] =
-						L[1] + (iy + j)*h[1];
-				    	blk_crx->corner_coords[i][j][k][2] =
-						L[2] + (iz + k)*h[2];
-				    }
-	                        }
-	                    }
-	                }
-			/* Put blk_crx->comps[i] in ascending order */
-			for (i = 0; i < blk_crx->num_comps-1; ++i)
-			{
-			    for (j = i+1; j < blk_crx->num_comps; ++j)
-			    {
-			    	if (blk_crx->nv[i] > blk_crx->nv[j])
-				{
-				    int nv_tmp;
-				    COMPONENT c_tmp;
-				    nv_tmp = blk_crx->nv[i];
-				    blk_crx->nv[i] = blk_crx->nv[j];
-				    blk_crx->nv[j] = nv_tmp;
-				    c_tmp = blk_crx->comps[i];
-				    blk_crx->comps[i] = blk_crx->comps[j];
-				    blk_crx->comps[j] = c_tmp;
-				}
-			    }
-			}
-			for (i = 0; i < 2; ++i)
+	                bm = blk_mem[izz][iyy][ixx];
+			if (recorded[nbc++])
+			    emit_comp2_blk(bm);
+			else
 			{
-			    for (j = 0; j < 2; ++j)
-			    {
-				if (blk_crx->comp[0][i][j] !=
-				    blk_crx->comp[1][i][j])
-				{
-				    ip[0] = ix;
-				    ip[1] = iy + i;
-				    ip[2] = iz + j;
-				    fill_block_crx(0,i,j,blk_crx,ip,EAST,intfc);
-				}
-				else
-				{
-				    blk_crx->crx[0][i][j]->p = NULL;
-				    blk_crx->crx[0][i][j]->s = NULL;
-				}
-				if (blk_crx->comp[j][0][i] !=
-				    blk_crx->comp[j][1][i])
-				{
-				    ip[0] = ix + j;
-				    ip[1] = iy;
-				    ip[2] = iz + i;
-				    fill_block_crx(1,i,j,blk_crx,ip,NORTH,intfc);
-				}
-				else
-				{
-				    blk_crx->crx[1][i][j]->p = NULL;
-				    blk_crx->crx[1][i][j]->s = NULL;
-				}
-				if (blk_crx->comp[i][j][0] !=
-				    blk_crx->comp[i][j][1])
-				{
-				    ip[0] = ix + i;
-				    ip[1] = iy + j;
-				    ip[2] = iz;
-				    fill_block_crx(2,i,j,blk_crx,ip,UPPER,intfc);
-				}
-				else
-				{
-				    blk_crx->crx[2][i][j]->p = NULL;
-				    blk_crx->crx[2][i][j]->s = NULL;
-			    	}
-			    }
-			}
-	                
-                        for( i = 0; i < 2; ++i)
-                        {
-                            if(is_curve_crx(blk_crx->comp[i][0][0],
-					    blk_crx->comp[i][1][0],
-                                            blk_crx->comp[i][0][1],
-					    blk_crx->comp[i][1][1]))
-                            {
-                                ip[0] = ix + i;
-                                ip[1] = iy;
-                                ip[2] = iz;
-                                fill_block_curve_crx(0,i,blk_crx,ip,EAST,intfc);   
-                            }       
-                            else
-			    {
-                                blk_crx->curve_crx[0][i]->p = NULL;
-				blk_crx->curve_crx[0][i]->c = NULL;
-			    }
-                            if(is_curve_crx(blk_crx->comp[0][i][0],
-					    blk_crx->comp[0][i][1],
-                                            blk_crx->comp[1][i][0],
-					    blk_crx->comp[1][i][1]))
-                            {
-                                ip[0] = ix;
-                                ip[1] = iy + i;
-                                ip[2] = iz;
-                                fill_block_curve_crx(1,i,blk_crx,ip,NORTH,intfc);
-                            }
-                            else
-			    {
-                                 blk_crx->curve_crx[1][i]->p = NULL;
-				 blk_crx->curve_crx[1][i]->c = NULL;
-			    }
-                            if(is_curve_crx(blk_crx->comp[0][0][i],
-					    blk_crx->comp[1][0][i],
-                                            blk_crx->comp[0][1][i],
-					    blk_crx->comp[1][1][i]))
-                            {
-                                ip[0] = ix;
-                                ip[1] = iy;
-                                ip[2] = iz + i;
-                                fill_block_curve_crx(2,i,blk_crx,ip,UPPER,intfc);
-                            }
-                            else
-			    {
-                                 blk_crx->curve_crx[2][i]->p = NULL; 
-				 blk_crx->curve_crx[2][i]->c = NULL;
-			    }
-                        }
-                        
-                        num_curve_crx = 0;
-                        for (ii = 0; ii < 2; ++ii)
-                        {
-                           if (blk_crx->curve_crx[0][ii]->c != NULL)
-                               ++num_curve_crx;
-                           if (blk_crx->curve_crx[1][ii]->c != NULL)
-                               ++num_curve_crx;
-                           if (blk_crx->curve_crx[2][ii]->c != NULL)
-                               ++num_curve_crx;
-                        }
-                       
-                        if (blk_crx->num_comps == 2)
-                        {
-                           if (num_curve_crx == 0)
-                               blk_crx->blk_type = COMP2_BLOCK;
-                           else if (num_curve_crx != 0)
-                               blk_crx->blk_type = BDRY_BLOCK;
-                        }
-                        else if (blk_crx->num_comps == 3)
-                            blk_crx->blk_type = COMP3_BLOCK;
-                        
-                        switch (blk_crx->blk_type)
-                        {
-                        case COMP2_BLOCK:
-			    if(!construct_comp2_blk(blk_crx,bm))
-                            {
-                                free(blk_mem);
-                                free(blk_mem_store);
-                                DEBUG_LEAVE(reconstruct_crx_intfc3d)
-                                return FUNCTION_FAILED;
-                            }
-                            break;
-                        case COMP3_BLOCK:
-			    if(NO && ix==28 && iy==11  && iz == 6) 
-			    {
-				sprintf(db_name, "blk_chk%d-%d-%d", ix, iy, iz);
-				set_debug_name(db_name);
-			        blk_crx->debug_flag = YES;
-			        add_to_debug("chk_bm");
-			    }
-			    else
+	                    bm->blk_info = blk_crx->blk_info = &blk_info;
+			    if (!set_blk_crx(blk_crx,ix,iy,iz,T,&gr))
 			    {
-			        blk_crx->debug_flag = NO;
+			    	screen("ERROR in reconstruct_intfc3d_in_box(), "
+				       "can not find crx of block %d %d %d\n",
+				       ix,iy,iz);
+			    	clean_up(ERROR);
 			    }
-			    if (!construct_comp3_blk(blk_crx,bm))
+                            switch (blk_crx->blk_type)
                             {
-                                free(blk_mem);
-                                free(blk_mem_store);
-                                DEBUG_LEAVE(reconstruct_crx_intfc3d)
-                                return FUNCTION_FAILED;
-                            }
-			    /*reomve_from_debug("chk_bm"); */
-                            break;
-                        case BDRY_BLOCK:
-                            if (!construct_bdry_blk(blk_crx,bm))
-                            {
-                                free(blk_mem);
-                                free(blk_mem_store);
-                                DEBUG_LEAVE(reconstruct_crx_intfc3d)
-                                return FUNCTION_FAILED;
+                            case COMP2_BLOCK:
+			    	if(!construct_comp2_blk(blk_crx,bm))
+                                {
+                                    free_these(4,blk_mem,blk_mem_store,
+				    	       blk_ip,recorded);
+                                    DEBUG_LEAVE(reconstruct_crx_intfc3d)
+                                    return FUNCTION_FAILED;
+                                }
+                                break;
+                            case COMP3_BLOCK:
+			    	if(NO && ix==28 && iy==11  && iz == 6) 
+			    	{
+				    sprintf(db_name, "blk_chk%d-%d-%d", ix, iy, iz);
+				    set_debug_name(db_name);
+			            blk_crx->debug_flag = YES;
+			            add_to_debug("chk_bm");
+			    	}
+			    	else
+			    	{
+			            blk_crx->debug_flag = NO;
+			    	}
+			    	if (!construct_comp3_blk(blk_crx,bm))
+                                {
+                                    free_these(4,blk_mem,blk_mem_store,
+				    	       blk_ip,recorded);
+                                    DEBUG_LEAVE(reconstruct_crx_intfc3d)
+                                    return FUNCTION_FAILED;
+                                }
+			    	/*reomve_from_debug("chk_bm"); */
+                                break;
+                            case BDRY_BLOCK:
+                                if (!construct_bdry_blk(blk_crx,bm))
+                                {
+                                    free_these(4,blk_mem,blk_mem_store,
+				    	       blk_ip,recorded);
+                                    DEBUG_LEAVE(reconstruct_crx_intfc3d)
+                                    return FUNCTION_FAILED;
+                                }
+                                break;
+                            default:
+                                screen("UNKNOWN BLOCK: code needed!\n");
+                                clean_up(ERROR);
                             }
-                            break;
-                        default:
-                            screen("UNKNOWN BLOCK: code needed!\n");
-                            clean_up(ERROR);
-                        }
+			}
 
 			if (blk_info.do_volume_frac)
 			{
@@ -766,11 +691,10 @@ EXPORT 	boolean reconstruct_intfc3d_in_box(
 		    }
 	            else
 		    {
-	                blk_mem[izz][iyy][ixx] = NULL;
 		    	if (blk_info.do_volume_frac)
 			{
 			    area[ix][iy][iz] = 0.0;
-		    	    if (compon[iz][iy][ix] == volume_frac->comp_vfrac)
+		    	    if (Comp_of_block3d(T,ix,iy,iz) == volume_frac->comp_vfrac)
 			    	vol_frac[ix][iy][iz] = 1.0;
 		    	    else
 			    	vol_frac[ix][iy][iz] = 0.0;
@@ -798,7 +722,7 @@ EXPORT 	boolean reconstruct_intfc3d_in_box(
 	            iyy = iy - smin[1];
 	            izz = iz - smin[2];
 
-		    if (compon[iz][iy][ix] == ONFRONT && is_crx(comp, gmax, ix, iy, iz))
+		    if (Comp_of_block3d(T,ix,iy,iz) == ONFRONT && is_crx(comp, gmax, ix, iy, iz))
 	            {
 	                bm = blk_mem[izz][iyy][ixx];
 	                if (bm->num_null_sides == 0)
@@ -859,7 +783,7 @@ redo_delete_s:
 	    reorder_curve_link_list(*cc);
 	}
 	
-	free_these(5, blk_mem, blk_mem_store,
+	free_these(7, blk_mem, blk_mem_store, blk_ip, recorded,
 	    blk_info.surfs, blk_info.cur_tris, blk_info.curves);
 	
 	if (debugging("trace"))
@@ -1126,21 +1050,8 @@ LOCAL	void fill_block_crx(
 {
 	Table *T = table_of_interface(intfc);
 	RECT_GRID *gr = &topological_grid(intfc);
-	int *gmax = gr->gmax;
 
-	int l,nc,list;
-	CRXING *crx;
-
-	l = seg_index3d(ip[0],ip[1],ip[2],dir,gmax);
-	nc = T->seg_crx_count[l];
-	if (nc != 0)
-	{
-	    list = T->seg_crx_lists[l][0];
-	    crx = &T->crx_store[list];
-	    blk_crx->crx[i][j][k]->s = Surface_of_hs(crx->hs);
-	    blk_crx->crx[i][j][k]->p = crx->pt;
-	}
-	else
+	if (!blk_seg_crx(i,j,k,blk_crx,ip,dir,T,gr->gmax))
 	{
 	    printf("ERROR fill_block_crx, can not find crx %d %d %d\n",i,j,k);
 	    print_int_vector("ip = ",ip,3,"  ");
@@ -1149,86 +1060,316 @@ LOCAL	void fill_block_crx(
 	}
 }	/* end fill_block_crx */
 
-LOCAL   void fill_block_curve_crx(
+LOCAL	boolean blk_seg_crx(
+	int            i,
+	int            j,
+	int            k,
+	BLK_CRX        *blk_crx,
+	int            *ip,
+	GRID_DIRECTION dir,
+	Table          *T,
+	int            *gmax)
+{
+	int l,nc,list;
+	CRXING *crx;
+
+	l = seg_index3d(ip[0],ip[1],ip[2],dir,gmax);
+	nc = T->seg_crx_count[l];
+	if (nc == 0)
+	    return NO;
+	list = T->seg_crx_lists[l][0];
+	crx = &T->crx_store[list];
+	blk_crx->crx[i][j][k]->s = Surface_of_hs(crx->hs);
+	blk_crx->crx[i][j][k]->p = crx->pt;
+	return YES;
+}	/* end blk_seg_crx */
+
+LOCAL   boolean blk_curve_crx(
         int            i,	/*direction = 0,1,2 */
         int            j,	/*first or second = 0,1 */
         BLK_CRX        *blk_crx,
         int            *ip,
         GRID_DIRECTION dir,
-        INTERFACE      *intfc)
+	Table          *T,
+	int            *gmax)
 {
-	Table 		*T = table_of_interface(intfc);
-	RECT_GRID 	*gr = &topological_grid(intfc);
-	int 		*gmax = gr->gmax;
         int 		l,nc,list;
         CRXING 		*crx;
 	
         l = face_index3d(ip[0],ip[1],ip[2],dir,gmax);
         nc = T->curve_crx_count[l];
-        
-	if (nc != 0)
-        {
-            list = T->curve_crx_lists[l][0];
-            crx = &T->curve_crx_store[list];
-	    
-            blk_crx->curve_crx[i][j]->c = Curve_of_hsb(crx->hsb);
-            blk_crx->curve_crx[i][j]->p = crx->pt;
-        }
-	else
-	{
-	    printf("ERROR fill_block_curve_crx, can not find crx %d  %d\n", i, j);
-	    print_int_vector("ip=",ip,3,"  ");
-	    printf("dir = %d\n", dir);
-	    clean_up(ERROR);
-	}
+	if (nc == 0)
+	    return NO;
+        list = T->curve_crx_lists[l][0];
+        crx = &T->curve_crx_store[list];
+        blk_crx->curve_crx[i][j]->c = Curve_of_hsb(crx->hsb);
+        blk_crx->curve_crx[i][j]->p = crx->pt;
+	return YES;
+}       /* end blk_curve_crx */
 
-}       /* end fill_block_curve_crx */
+/*
+*	Sets the corner components and coordinates, the crossings and the
+*	type of block (ix,iy,iz).  Reads the table only, so the threads can
+*	set their own blk_crx.  Returns NO if a crossing is missing.
+*/
 
-EXPORT 	boolean track_comp_through_crxings3d(
-	int 	 *smin,
-	int 	 *smax,
-	int 	 *gmax,
-	INTERFACE *intfc,
-	CRX_TYPE crx_type)
+LOCAL	boolean set_blk_crx(
+	BLK_CRX		*blk_crx,
+	int		ix,
+	int		iy,
+	int		iz,
+	Table		*T,
+	RECT_GRID	*gr)
 {
-	int count = 0;
-	static int **ips = NULL;
-	int num_ip;
-
-	DEBUG_ENTER(track_comp_through_crxings3d)
-
-	if(ips == NULL)
-            stat_matrix(&ips,MAX_NUM_UNPHY_IP,3,INT);
-
-	/* eliminate duplicate crossings */
-	if (debugging("grid_line_comp"))
-            debug_comp_on_grid_line("Before adjust_crossings()",
-                                intfc,smin,smax);
-	adjust_crossings(smin,smax,intfc);
-
-	/* assign components and isolate unphysical clusters */
-	start_clock("fill_physical_comps");
-	fill_physical_comps(smin,smax,gmax,intfc);
-	stop_clock("fill_physical_comps");
-
-	/* annihilate unphysical clusters */
-	start_clock("remove_unphysical_crxings");
+	COMPONENT	c;
+	COMPONENT	*comp = T->components;
+	int		*gmax = gr->gmax;
+	double		*L = gr->L;
+	double		*h = gr->h;
+	int		i, j, k, ic, ip[3];
+	int		num_curve_crx;
 
-	while(unset_comp_exist(smin,smax,intfc))
+	blk_crx->num_comps = 0;
+	for (i = 0; i < 2; ++i)
 	{
-	    remove_unphysical_crxings(smin,smax,gmax,intfc,crx_type,&num_ip,
-					ips);
-	    if (count++ == 4)
+	    for (j = 0; j < 2; ++j)
 	    {
-	    	screen("ERROR: unset component still exist after 4 rounds!\n");
-		clean_up(ERROR);
-	    }
-	}
-	stop_clock("remove_unphysical_crxings");
-	
-	DEBUG_LEAVE(track_comp_through_crxings3d)
-	return FUNCTION_SUCCEEDED;
-
+	        for (k = 0; k < 2; ++k)
+	        {
+	            c = comp[d_index3d(ix+i,iy+j,iz+k,gmax)];
+		    for (ic = 0; ic < blk_crx->num_comps; ++ic)
+		    {
+		    	if (c == blk_crx->comps[ic])
+	                {
+		            ++blk_crx->nv[ic];
+		            break;
+		        }
+		    }
+		    if (ic == blk_crx->num_comps)
+		    {
+		    	blk_crx->comps[ic] = c;
+			blk_crx->nv[ic] = 1;
+			++blk_crx->num_comps;
+		    }
+	            blk_crx->comp[i][j][k] = c;
+	            blk_crx->ix[i][j][k] = i;
+	            blk_crx->iy[i][j][k] = j;
+	            blk_crx->iz[i][j][k] = k;
+		    blk_crx->corner_coords[i][j][k][0] = L[0] + (ix + i)*h[0];
+		    blk_crx->corner_coords[i][j][k][1] = L[1] + (iy + j)*h[1];
+		    blk_crx->corner_coords[i][j][k][2] = L[2] + (iz + k)*h[2];
+	        }
+	    }
+	}
+	/* Put blk_crx->comps[i] in ascending order */
+	for (i = 0; i < blk_crx->num_comps-1; ++i)
+	{
+	    for (j = i+1; j < blk_crx->num_comps; ++j)
+	    {
+	    	if (blk_crx->nv[i] > blk_crx->nv[j])
+		{
+		    int nv_tmp;
+		    COMPONENT c_tmp;
+		    nv_tmp = blk_crx->nv[i];
+		    blk_crx->nv[i] = blk_crx->nv[j];
+		    blk_crx->nv[j] = nv_tmp;
+		    c_tmp = blk_crx->comps[i];
+		    blk_crx->comps[i] = blk_crx->comps[j];
+		    blk_crx->comps[j] = c_tmp;
+		}
+	    }
+	}
+	for (i = 0; i < 2; ++i)
+	{
+	    for (j = 0; j < 2; ++j)
+	    {
+		if (blk_crx->comp[0][i][j] != blk_crx->comp[1][i][j])
+		{
+		    ip[0] = ix;
+		    ip[1] = iy + i;
+		    ip[2] = iz + j;
+		    if (!blk_seg_crx(0,i,j,blk_crx,ip,EAST,T,gmax))
+			return NO;
+		}
+		else
+		{
+		    blk_crx->crx[0][i][j]->p = NULL;
+		    blk_crx->crx[0][i][j]->s = NULL;
+		}
+		if (blk_crx->comp[j][0][i] != blk_crx->comp[j][1][i])
+		{
+		    ip[0] = ix + j;
+		    ip[1] = iy;
+		    ip[2] = iz + i;
+		    if (!blk_seg_crx(1,i,j,blk_crx,ip,NORTH,T,gmax))
+			return NO;
+		}
+		else
+		{
+		    blk_crx->crx[1][i][j]->p = NULL;
+		    blk_crx->crx[1][i][j]->s = NULL;
+		}
+		if (blk_crx->comp[i][j][0] != blk_crx->comp[i][j][1])
+		{
+		    ip[0] = ix + i;
+		    ip[1] = iy + j;
+		    ip[2] = iz;
+		    if (!blk_seg_crx(2,i,j,blk_crx,ip,UPPER,T,gmax))
+			return NO;
+		}
+		else
+		{
+		    blk_crx->crx[2][i][j]->p = NULL;
+		    blk_crx->crx[2][i][j]->s = NULL;
+	    	}
+	    }
+	}
+	
+        for (i = 0; i < 2; ++i)
+        {
+            if (is_curve_crx(blk_crx->comp[i][0][0],blk_crx->comp[i][1][0],
+                             blk_crx->comp[i][0][1],blk_crx->comp[i][1][1]))
+            {
+                ip[0] = ix + i;
+                ip[1] = iy;
+                ip[2] = iz;
+                if (!blk_curve_crx(0,i,blk_crx,ip,EAST,T,gmax))
+		    return NO;
+            }       
+            else
+	    {
+                blk_crx->curve_crx[0][i]->p = NULL;
+		blk_crx->curve_crx[0][i]->c = NULL;
+	    }
+            if (is_curve_crx(blk_crx->comp[0][i][0],blk_crx->comp[0][i][1],
+                             blk_crx->comp[1][i][0],blk_crx->comp[1][i][1]))
+            {
+                ip[0] = ix;
+                ip[1] = iy + i;
+                ip[2] = iz;
+                if (!blk_curve_crx(1,i,blk_crx,ip,NORTH,T,gmax))
+		    return NO;
+            }
+            else
+	    {
+                blk_crx->curve_crx[1][i]->p = NULL;
+		blk_crx->curve_crx[1][i]->c = NULL;
+	    }
+            if (is_curve_crx(blk_crx->comp[0][0][i],blk_crx->comp[1][0][i],
+                             blk_crx->comp[0][1][i],blk_crx->comp[1][1][i]))
+            {
+                ip[0] = ix;
+                ip[1] = iy;
+                ip[2] = iz + i;
+                if (!blk_curve_crx(2,i,blk_crx,ip,UPPER,T,gmax))
+		    return NO;
+            }
+            else
+	    {
+                blk_crx->curve_crx[2][i]->p = NULL; 
+		blk_crx->curve_crx[2][i]->c = NULL;
+	    }
+        }
+        
+        num_curve_crx = 0;
+        for (i = 0; i < 2; ++i)
+        {
+           if (blk_crx->curve_crx[0][i]->c != NULL)
+               ++num_curve_crx;
+           if (blk_crx->curve_crx[1][i]->c != NULL)
+               ++num_curve_crx;
+           if (blk_crx->curve_crx[2][i]->c != NULL)
+               ++num_curve_crx;
+        }
+       
+        if (blk_crx->num_comps == 2)
+        {
+           if (num_curve_crx == 0)
+               blk_crx->blk_type = COMP2_BLOCK;
+           else if (num_curve_crx != 0)
+               blk_crx->blk_type = BDRY_BLOCK;
+        }
+        else if (blk_crx->num_comps == 3)
+            blk_crx->blk_type = COMP3_BLOCK;
+	return YES;
+}	/* end set_blk_crx */
+
+/*
+*	pp_parallel_for() body: records the triangles of the two component
+*	blocks [lo,hi) with the blk_crx of the calling thread.  A block that
+*	is not recorded is done by the serial loop.
+*/
+
+LOCAL	void record_comp2_blks(
+	long	lo,
+	long	hi,
+	POINTER	arg)
+{
+	RECON_BLKS	*rb = (RECON_BLKS*)arg;
+	BLK_CRX		*blk_crx = rb->blk_crx[2*pp_thread_num()];
+	BLK_CRX		*bc_rot = rb->blk_crx[2*pp_thread_num()+1];
+	BLK_TRI		*bm;
+	int		*ip;
+	long		n;
+
+	for (n = lo; n < hi; ++n)
+	{
+	    ip = rb->blk_ip[n];
+	    bm = rb->blk_mem_store + n;
+	    bm->blk_info = blk_crx->blk_info = rb->blk_info;
+	    rb->recorded[n] = (set_blk_crx(blk_crx,ip[0],ip[1],ip[2],
+	    				   rb->T,rb->gr) &&
+			       blk_crx->num_comps == 2 &&
+			       blk_crx->blk_type == COMP2_BLOCK &&
+			       record_comp2_blk(blk_crx,bm,bc_rot)) ? YES : NO;
+	}
+}	/* end record_comp2_blks */
+
+EXPORT 	boolean track_comp_through_crxings3d(
+	int 	 *smin,
+	int 	 *smax,
+	int 	 *gmax,
+	INTERFACE *intfc,
+	CRX_TYPE crx_type)
+{
+	int count = 0;
+	static int **ips = NULL;
+	int num_ip;
+
+	DEBUG_ENTER(track_comp_through_crxings3d)
+
+	if(ips == NULL)
+            stat_matrix(&ips,MAX_NUM_UNPHY_IP,3,INT);
+
+	/* eliminate duplicate crossings */
+	if (debugging("grid_line_comp"))
+            debug_comp_on_grid_line("Before adjust_crossings()",
+                                intfc,smin,smax);
+	adjust_crossings(smin,smax,intfc);
+
+	/* assign components and isolate unphysical clusters */
+	start_clock("fill_physical_comps");
+	fill_physical_comps(smin,smax,gmax,intfc);
+	stop_clock("fill_physical_comps");
+
+	/* annihilate unphysical clusters */
+	start_clock("remove_unphysical_crxings");
+
+	while(unset_comp_exist(smin,smax,intfc))
+	{
+	    remove_unphysical_crxings(smin,smax,gmax,intfc,crx_type,&num_ip,
+					ips);
+	    if (count++ == 4)
+	    {
+	    	screen("ERROR: unset component still exist after 4 rounds!\n");
+		clean_up(ERROR);
+	    }
+	}
+	stop_clock("remove_unphysical_crxings");
+	
+	DEBUG_LEAVE(track_comp_through_crxings3d)
+	return FUNCTION_SUCCEEDED;
+
 }	/* end track_comp_through_crxings3d */
 
 LOCAL	boolean unset_comp_exist(
@@ -2130,7 +2271,6 @@ LOCAL int fill_missing_crx(
 	GRID_DIRECTION  dir,
 	int num_crx_fill)
 {
-	COMPONENT	***comp3d;
 	Table		*T = table_of_interface(intfc);
 	COMPONENT	*comp = T->components;
 	COMPONENT 	lcomp, ucomp;
@@ -2146,7 +2286,6 @@ LOCAL int fill_missing_crx(
 
 	DEBUG_ENTER(fill_missing_crx)
 	
-	comp3d = (table_of_interface(intfc))->compon3d;
 	for (l = 0; l < 3; ++l)
 	{
 	    coords[l] = expanded_dual_grid->L[l] + 
@@ -2214,40 +2353,40 @@ LOCAL int fill_missing_crx(
 			T->n_crx + num_crx_fill]);
 	T->seg_crx_lists[l][0] = T->n_crx + num_crx_fill;
 	
-	/* ip is the edge of the top grid, comp3d is the center of the top grid. */
+	/* ip is the edge of the top grid, the block is the center of the top grid. */
 	/*0 <= ip <= gmax */
 	if (dir == EAST)
 	{
 	    if(ip[2] >= 1 && ip[1] >= 1)
-		comp3d[ip[2]-1][ip[1]-1][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1]-1,ip[2]-1,ONFRONT);
 	    if (ip[2] >= 1 && ip[1] < gmax[1])
-		comp3d[ip[2]-1][ip[1]][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1],ip[2]-1,ONFRONT);
 	    if (ip[2] < gmax[2] && ip[1] >= 1)
-		comp3d[ip[2]][ip[1]-1][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1]-1,ip[2],ONFRONT);
 	    if (ip[1] < gmax[1] && ip[2] < gmax[2])
-		comp3d[ip[2]][ip[1]][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1],ip[2],ONFRONT);
 	}
 	else if (dir == NORTH)
 	{
 	    if(ip[2] >= 1 && ip[0] >= 1)
-		comp3d[ip[2]-1][ip[1]][ip[0]-1] = ONFRONT;
+		set_comp_of_block3d(T,ip[0]-1,ip[1],ip[2]-1,ONFRONT);
 	    if (ip[2] >= 1 && ip[0] < gmax[0])
-		comp3d[ip[2]-1][ip[1]][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1],ip[2]-1,ONFRONT);
 	    if (ip[2] < gmax[2] && ip[0] >= 1)
-		comp3d[ip[2]][ip[1]][ip[0]-1] = ONFRONT;
+		set_comp_of_block3d(T,ip[0]-1,ip[1],ip[2],ONFRONT);
 	    if (ip[0] < gmax[0] && ip[2] < gmax[2])
-		comp3d[ip[2]][ip[1]][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1],ip[2],ONFRONT);
 	}
 	else if (dir == UPPER)
 	{
 	    if(ip[1] >= 1 && ip[0] >= 1)
-		comp3d[ip[2]][ip[1]-1][ip[0]-1] = ONFRONT;
+		set_comp_of_block3d(T,ip[0]-1,ip[1]-1,ip[2],ONFRONT);
 	    if (ip[1] >= 1 && ip[0] < gmax[0])
-		comp3d[ip[2]][ip[1]-1][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1]-1,ip[2],ONFRONT);
 	    if (ip[1] < gmax[1] && ip[0] >= 1)
-		comp3d[ip[2]][ip[1]][ip[0]-1] = ONFRONT;
+		set_comp_of_block3d(T,ip[0]-1,ip[1],ip[2],ONFRONT);
 	    if (ip[1] < gmax[1] && ip[0] < gmax[0])
-		comp3d[ip[2]][ip[1]][ip[0]] = ONFRONT;
+		set_comp_of_block3d(T,ip[0],ip[1],ip[2],ONFRONT);
 	}
 	if (debugging("comp_crx"))
 	{
@@ -3881,18 +4020,30 @@ EXPORT	boolean adjacent_cell(
 }	/* end adjacent_cell */
 
 
+/*
+*			count_grid_intfc_crossings3d():
+*			insert_grid_intfc_crossings3d():
+*
+*	Build the crossings of the grid edges by the tris of grid_intfc.
+*	The crossings of a grid edge are found from the tris of the single
+*	block that owns the edge (see block_grid_edges3d()),  so the blocks
+*	may be processed independently.  The count runs in parallel over the
+*	blocks of the tri list table.  The insertion first flags in parallel
+*	the tris that cross each edge of a block,  then numbers and builds
+*	the crossings serially in the z,y,x order of the blocks so that the
+*	crossing indices and their order on each edge do not depend on the
+*	number of threads.
+*/
+
+enum { MIN_PARALLEL_CRX_BLOCKS = 4096 };
+
 EXPORT	int count_grid_intfc_crossings3d(
 	INTERFACE	*grid_intfc)
 {
 	RECT_GRID	*rgr = &topological_grid(grid_intfc);
 	struct Table	*T = table_of_interface(grid_intfc);
-	TRI		**t;
-	SURFACE		**s;
-	int		i,j,k;
-	int		nt;
-	int		icrds[MAXD];
+	int		id, nblocks;
 	int		n_crx = 0;
-	int             xmax, ymax, zmax;
 	int		*seg_crx_count = T->seg_crx_count;
 	DEBUG_ENTER(count_grid_intfc_crossings3d)
 
@@ -3900,26 +4051,103 @@ EXPORT	int count_grid_intfc_crossings3d(
 	    is_outside_surfaces(grid_intfc, rgr)) 
 		return 0;
 
-	xmax = rgr->gmax[0];
-	ymax = rgr->gmax[1];
-	zmax = rgr->gmax[2];
+	nblocks = T->num_tri_pages*TOPO_TILE_VOLUME;
 
-	for (k = 0; k < zmax; ++k)
-	for (j = 0; j < ymax; ++j)
-	for (i = 0; i < xmax; ++i)
+#pragma omp parallel for schedule(dynamic,TOPO_TILE_VOLUME) \
+		reduction(+:n_crx) if (nblocks > MIN_PARALLEL_CRX_BLOCKS)
+	for (id = 0; id < nblocks; ++id)
 	{
-	    nt = T->num_of_tris[k][j][i];
+	    int nt = T->tri_offsets[id+1] - T->tri_offsets[id];
+	    int icrds[MAXD];
+
 	    if (nt == 0) continue;
-	    t = T->tris[k][j][i];
-	    s = T->surfaces[k][j][i];
-	    icrds[0] = i; icrds[1] = j; icrds[2] = k;
-	    n_crx += count_block_crossings(rgr,seg_crx_count,s,t,nt,icrds);
+	    topo_block_icoords3d(T,id,icrds);
+	    n_crx += count_block_crossings(rgr,seg_crx_count,
+				T->surfacestore + T->tri_offsets[id],
+				T->tristore + T->tri_offsets[id],nt,icrds);
 	}
 	DEBUG_LEAVE(count_grid_crossings3d)
 	return n_crx;
 }		/* end count_grid_intfc_crossings3d */
 
 enum { MAX_EDGE_CRX = 20 }; /*TOLERANCE*/
+enum { MAX_BLOCK_EDGES = 12 };
+
+/*
+*			block_grid_edges3d():
+*
+*	Lists the grid edges whose crossings are built from block ic:  the
+*	EAST, NORTH and UPPER edges at the lower corner of the block and,
+*	for the last blocks in each direction,  the edges on the upper faces
+*	of the grid.  Returns the number of edges with the lower node of
+*	edge n in en[n] and its coordinate direction in edir[n],  in the
+*	order in which the crossings are numbered.
+*/
+
+LOCAL	int block_grid_edges3d(
+	const int	*ic,
+	const int	*gmax,
+	int		(*en)[MAXD],
+	int		*edir)
+{
+	static const int shift[9][MAXD] = {{0,0,0},{0,0,0},{0,0,0},
+					   {1,0,0},{1,0,0},{0,1,0},
+					   {0,1,0},{0,0,1},{0,0,1}};
+	static const int sdir[9] = {0,1,2,1,2,0,2,0,1};
+	boolean		top[MAXD];
+	int		i, n, ne;
+
+	for (i = 0; i < 3; ++i)
+	    top[i] = (ic[i] == gmax[i] - 1) ? YES : NO;
+	ne = 0;
+	for (n = 0; n < 9; ++n)
+	{
+	    if (n >= 3 && !top[(n-3)/2])
+		continue;
+	    for (i = 0; i < 3; ++i)
+		en[ne][i] = ic[i] + shift[n][i];
+	    edir[ne++] = sdir[n];
+	}
+	if (top[0] && top[1])
+	{
+	    en[ne][0] = ic[0] + 1;  en[ne][1] = ic[1] + 1;  en[ne][2] = ic[2];
+	    edir[ne++] = 2;
+	}
+	if (top[0] && top[2])
+	{
+	    en[ne][0] = ic[0] + 1;  en[ne][1] = ic[1];  en[ne][2] = ic[2] + 1;
+	    edir[ne++] = 1;
+	}
+	if (top[1] && top[2])
+	{
+	    en[ne][0] = ic[0];  en[ne][1] = ic[1] + 1;  en[ne][2] = ic[2] + 1;
+	    edir[ne++] = 0;
+	}
+	return ne;
+}		/*end block_grid_edges3d*/
+
+LOCAL	GRID_DIRECTION	grid_edge_dir[3] = {EAST, NORTH, UPPER};
+
+/*
+*	Coordinates of the lower node en of an edge of block ic,  computed
+*	as the block corner plus one mesh spacing in the shifted directions.
+*/
+
+LOCAL	void grid_edge_start3d(
+	RECT_GRID	*rgr,
+	const int	*ic,
+	const int	*en,
+	double		*coords)
+{
+	int		i;
+
+	for (i = 0; i < 3; ++i)
+	{
+	    coords[i] = rgr->L[i] + ic[i]*rgr->h[i];
+	    if (en[i] != ic[i])
+		coords[i] += rgr->h[i];
+	}
+}		/*end grid_edge_start3d*/
 
 LOCAL int count_block_crossings(
 	RECT_GRID	*rgr,
@@ -3931,231 +4159,62 @@ LOCAL int count_block_crossings(
 {
 	int		n_blk_crx;
 	double		coords[MAXD],crds_crx[MAXD];
-	double           *L, *h;
-	int		i,n_ecrx;	/* number of crossings on edge */
+	double           *h;
+	int		i,n,n_ecrx;	/* number of crossings on edge */
 	int		index;
-	int		iv,ie;
-	int             xmax, ymax, zmax;
-	static CRX_STORE	*crx_list;
-	
-	/*DEBUG_ENTER(count_block_crossings) */
+	int		iv,ie,ne;
+	int		en[MAX_BLOCK_EDGES][MAXD], edir[MAX_BLOCK_EDGES];
+	CRX_STORE	crx_list[MAX_EDGE_CRX];
 	int 		*gmax = rgr->gmax;
 
-	xmax = rgr->gmax[0];
-	ymax = rgr->gmax[1];
-	zmax = rgr->gmax[2];
-	L = rgr->L;
 	h = rgr->h;
-	if (crx_list == NULL)
-	    uni_array(&crx_list,MAX_EDGE_CRX,sizeof(CRX_STORE));
-	for (i = 0; i < 3; ++i)
-	    coords[i] = L[i] + ic[i]*h[i];
 	n_blk_crx = 0;
-
-		/* Count EAST face crossings */
-
-	n_ecrx = 0;
-	for (i = 0; i < num_tris; ++i)
+	ne = block_grid_edges3d(ic,gmax,en,edir);
+	for (n = 0; n < ne; ++n)
 	{
-	    if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-	    {
-		n_blk_crx += add_to_edge_list(surfs[i],tris[i],0,crx_list,
-				              &n_ecrx,crds_crx,iv,ie);
-	    }
-	}
-	index = seg_index3d(ic[0],ic[1],ic[2],EAST,gmax);
-	seg_crx_count[index] = n_ecrx;
-
-		/* Count NORTH face crossings */
-
-	n_ecrx = 0;
-	for (i = 0; i < num_tris; ++i)
-	{
-	    if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-	    {
-		n_blk_crx += add_to_edge_list(surfs[i],tris[i],1,crx_list,
-				              &n_ecrx,crds_crx,iv,ie);
-	    }
-	}
-	index = seg_index3d(ic[0],ic[1],ic[2],NORTH,gmax);
-	seg_crx_count[index] = n_ecrx;
-
-		/* Count UPPER face crossings */
-
-	n_ecrx = 0;
-	for (i = 0; i < num_tris; ++i)
-	{
-	    if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-	    {
-		n_blk_crx += add_to_edge_list(surfs[i],tris[i],2,crx_list,
-				              &n_ecrx,crds_crx,iv,ie);
-	    }
-	}
-	index = seg_index3d(ic[0],ic[1],ic[2],UPPER,gmax);
-	seg_crx_count[index] = n_ecrx;
-
-	if (ic[0] != xmax-1 && ic[1] != ymax-1 && ic[2] != zmax-1)
-	{
-	    /*DEBUG_LEAVE(count_block_crossings) */
-	    return n_blk_crx;
-	}
-
-	if (ic[0] == xmax - 1)
-	{
-	    ic[0] += 1;
-	    coords[0] += h[0];
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],1,crx_list,
-				                  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],NORTH,gmax);
-	    seg_crx_count[index] = n_ecrx;
+	    grid_edge_start3d(rgr,ic,en[n],coords);
 	    n_ecrx = 0;
 	    for (i = 0; i < num_tris; ++i)
 	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],2,crx_list,
-				                  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],UPPER,gmax);
-	    seg_crx_count[index] = n_ecrx;
-	    ic[0] -= 1;
-	    coords[0] -= h[0];
-	}
-	if (ic[1] == ymax - 1)
-	{
-	    ic[1] += 1;
-	    coords[1] += h[1];
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],0,crx_list,
-				                  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],EAST,gmax);
-	    seg_crx_count[index] = n_ecrx;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],2,crx_list,
-				                  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],UPPER,gmax);
-	    seg_crx_count[index] = n_ecrx;
-	    coords[1] -= h[1];
-	    ic[1] -= 1;
-	}
-	if (ic[2] == zmax - 1)
-	{
-	    ic[2] += 1;
-	    coords[2] += h[2];
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],0,crx_list,
-						  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],EAST,gmax);
-	    seg_crx_count[index] = n_ecrx;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],1,crx_list,
-						  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],NORTH,gmax);
-	    seg_crx_count[index] = n_ecrx;
-	    coords[2] -= h[2];
-	    ic[2] -= 1;
-	}
-	if (ic[0] == xmax-1 && ic[1] == ymax-1)
-	{
-	    ic[0] += 1;
-	    ic[1] += 1;
-	    coords[0] += h[0];
-	    coords[1] += h[1];
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],2,crx_list,
-				                  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],UPPER,gmax);
-	    seg_crx_count[index] = n_ecrx;
-	    coords[0] -= h[0];
-	    coords[1] -= h[1];
-	    ic[0] -= 1;
-	    ic[1] -= 1;
-	}
-	if (ic[0] == xmax-1 && ic[2] == zmax-1)
-	{
-	    ic[0] += 1;
-	    ic[2] += 1;
-	    coords[0] += h[0];
-	    coords[2] += h[2];
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],1,crx_list,
-				                  &n_ecrx,crds_crx,iv,ie);
-		}
+	    	if (tri_edge_crossing(tris[i],coords,crds_crx,edir[n],&iv,&ie,h))
+	    	{
+		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],edir[n],
+					crx_list,&n_ecrx,crds_crx,iv,ie);
+	    	}
 	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],NORTH,gmax);
+	    index = seg_index3d(en[n][0],en[n][1],en[n][2],
+				grid_edge_dir[edir[n]],gmax);
 	    seg_crx_count[index] = n_ecrx;
-	    coords[0] -= h[0];
-	    coords[2] -= h[2];
-	    ic[0] -= 1;
-	    ic[2] -= 1;
 	}
-	if (ic[1] == ymax-1 && ic[2] == zmax-1)
+	return n_blk_crx;
+}		/*end count_block_crossings*/
+
+/*
+*	Sets flags[n*num_tris+i] to 1 if tris[i] crosses the n-th edge of
+*	block ic and to 0 otherwise.
+*/
+
+LOCAL void flag_block_crossings(
+	RECT_GRID	*rgr,
+	TRI		**tris,
+	int		num_tris,
+	int		*ic,
+	unsigned char	*flags)
+{
+	double		coords[MAXD],crds_crx[MAXD];
+	double		*h = rgr->h;
+	int		en[MAX_BLOCK_EDGES][MAXD], edir[MAX_BLOCK_EDGES];
+	int		i,n,ne,iv,ie;
+
+	ne = block_grid_edges3d(ic,rgr->gmax,en,edir);
+	for (n = 0; n < ne; ++n)
 	{
-	    ic[1] += 1;
-	    ic[2] += 1;
-	    coords[1] += h[1];
-	    coords[2] += h[2];
-	    n_ecrx = 0;
+	    grid_edge_start3d(rgr,ic,en[n],coords);
 	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-		{
-		    n_blk_crx += add_to_edge_list(surfs[i],tris[i],0,crx_list,
-				                  &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    index = seg_index3d(ic[0],ic[1],ic[2],EAST,gmax);
-	    seg_crx_count[index] = n_ecrx;
-	    coords[1] -= h[1];
-	    coords[2] -= h[2];
-	    ic[1] -= 1;
-	    ic[2] -= 1;
+		*(flags++) = (tri_edge_crossing(tris[i],coords,crds_crx,
+					edir[n],&iv,&ie,h)) ? 1 : 0;
 	}
-	/*DEBUG_LEAVE(count_block_crossings) */
-	return n_blk_crx;
-}		/*end count_block_crossings*/
+}		/*end flag_block_crossings*/
 
 LOCAL int add_to_edge_list(
 	SURFACE		*surf,
@@ -4209,7 +4268,12 @@ LOCAL int add_to_edge_list(
 	}
 	if (iv != ERROR)
 	{
-	    if (!two_side_vertex(Point_of_tri(tri)[iv],tri,surf,ic))
+	    boolean two_side;
+
+	    /* set_tri_list_around_point() uses static storage */
+#pragma omp critical (tri_list_around_point)
+	    two_side = two_side_vertex(Point_of_tri(tri)[iv],tri,surf,ic);
+	    if (!two_side)
 		return 0;
 	    crx_list[*nc].vertex = Point_of_tri(tri)[iv];
 	    crx_list[*nc].edge[0] = NULL;
@@ -4244,6 +4308,11 @@ LOCAL int add_to_edge_list(
 	return 1;
 }		/*end add_to_edge_list*/
 
+/*
+*	Inserts the crossings of the edges of block icrds.  If flags is not
+*	NULL,  only the tris flagged by flag_block_crossings() are tested.
+*/
+
 LOCAL void insert_block_crossings(
 	INTERFACE	*intfc,
 	RECT_GRID	*rgr,
@@ -4254,283 +4323,44 @@ LOCAL void insert_block_crossings(
 	SURFACE		**surfs,            /* surfs of tris     */
 	int		num_tris,           /* num tris in block */
 	int		*icrds,             /* block icoords     */
-	int		*index )            /* crossing index    */
+	int		*index,             /* crossing index    */
+	const unsigned char *flags)         /* crossing tris     */
 {
 	double		coords[MAXD],crds_crx[MAXD];
-	double           *L, *h;
-	int		i,k,iv,ie,n_ecrx; /* number of crossings on edge */
+	double           *h;
+	int		i,k,n,iv,ie,ne,n_ecrx; /* number of crossings on edge */
+	int		en[MAX_BLOCK_EDGES][MAXD], edir[MAX_BLOCK_EDGES];
 	CRXING		*crx_list;
 	int		*edge_list;
-	int             xmax, ymax, zmax;
 	static CRX_STORE	*crx_tmp_store;
 	int		*gmax = rgr->gmax;
 
-	xmax = rgr->gmax[0];
-	ymax = rgr->gmax[1];
-	zmax = rgr->gmax[2];
-	L = rgr->L;
 	h = rgr->h;
 	if (crx_tmp_store == NULL)
 	    uni_array(&crx_tmp_store,MAX_EDGE_CRX,sizeof(CRX_STORE));
-	for (i = 0; i < 3; ++i)
-	    coords[i] = L[i] + icrds[i]*h[i];
-
-		/* Count EAST face crossings */
-
-	k = seg_index3d(icrds[0],icrds[1],icrds[2],EAST,gmax);
-	edge_list = seg_crx_lists[k];
-	crx_list = crx_store + *index;
-	n_ecrx = 0;
-	for (i = 0; i < num_tris; ++i)
-	{
-
-	    if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-	    {
-		add_to_crx_list(index,0,intfc,tris[i],surfs[i],crx_list,
-				crx_tmp_store,edge_list,&n_ecrx,crds_crx,iv,ie);
-	    }
-	    
-
-	}
-	seg_crx_count[k] = n_ecrx;
-
-		/* Count NORTH face crossings */
-
-	k = seg_index3d(icrds[0],icrds[1],icrds[2],NORTH,gmax);
-	edge_list = seg_crx_lists[k];
-	crx_list = crx_store + *index;
-	n_ecrx = 0;
-	for (i = 0; i < num_tris; ++i)
-	{
-	    if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-	    {
-		add_to_crx_list(index,1,intfc,tris[i],surfs[i],crx_list,
-				crx_tmp_store,edge_list,&n_ecrx,crds_crx,iv,ie);
-	
-	    }
-	    
-	}
-	seg_crx_count[k] = n_ecrx;
-
-		/* Count UPPER face crossings */
-
-	/* To release when debugging 
-	if (icrds[0] == 35 && icrds[1] == 37 && icrds[2] == 34)
-	if (icrds[0] == 38 && icrds[1] == 39)
-	{
-	    add_to_debug("block_crossing");
-	    printf("icrds = %d %d %d dir = UPPER\n",icrds[0],icrds[1],icrds[2]);
-	}
-	*/
-	k = seg_index3d(icrds[0],icrds[1],icrds[2],UPPER,gmax);
-	edge_list = seg_crx_lists[k];
-	crx_list = crx_store + *index;
-	n_ecrx = 0;
-	for (i = 0; i < num_tris; ++i)
-	{
-	    if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-	    {
-		/* To release when debugging
-		if (debugging("block_crossing"))
-		    printf("iv = %d  ie = %d\n",iv,ie);
-		*/
-		add_to_crx_list(index,2,intfc,tris[i],surfs[i],crx_list,
-				crx_tmp_store,edge_list,&n_ecrx,crds_crx,iv,ie);
-	    }
-	}
-	seg_crx_count[k] = n_ecrx;
-	/*
-	if (debugging("block_crossing"))
-	{
-	    printf("n_ecrx = %d\n",n_ecrx);
-	    remove_from_debug("block_crossing");
-	}
-	*/
 
-	if (icrds[0] != xmax-1 && icrds[1] != ymax-1 && icrds[2] != zmax-1)
-	    return;
-
-	if (icrds[0] == xmax - 1)
-	{
-	    icrds[0] += 1;
-	    coords[0] += h[0];
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],NORTH,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,1,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,&n_ecrx,
-				    crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],UPPER,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,2,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,&n_ecrx,
-				    crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    icrds[0] -= 1;
-	    coords[0] -= h[0];
-	}
-	if (icrds[1] == ymax - 1)
+	ne = block_grid_edges3d(icrds,gmax,en,edir);
+	for (n = 0; n < ne; ++n)
 	{
-	    icrds[1] += 1;
-	    coords[1] += h[1];
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],EAST,gmax);
+	    grid_edge_start3d(rgr,icrds,en[n],coords);
+	    k = seg_index3d(en[n][0],en[n][1],en[n][2],
+			    grid_edge_dir[edir[n]],gmax);
 	    edge_list = seg_crx_lists[k];
 	    crx_list = crx_store + *index;
 	    n_ecrx = 0;
-	    
 	    for (i = 0; i < num_tris; ++i)
 	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,0,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,
-				    &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],UPPER,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,2,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,
-				    &n_ecrx,crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    coords[1] -= h[1];
-	    icrds[1] -= 1;
-	}
-	if (icrds[2] == zmax - 1)
-	{
-	    icrds[2] += 1;
-	    coords[2] += h[2];
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],EAST,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,0,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,&n_ecrx,
-				    crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],NORTH,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,1,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,&n_ecrx,
-				    crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    coords[2] -= h[2];
-	    icrds[2] -= 1;
-	}
-	if (icrds[0] == xmax-1 && icrds[1] == ymax-1)
-	{
-	    icrds[0] += 1;
-	    icrds[1] += 1;
-	    coords[0] += h[0];
-	    coords[1] += h[1];
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],UPPER,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,2,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,2,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,&n_ecrx,
-				    crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    coords[0] -= h[0];
-	    coords[1] -= h[1];
-	    icrds[0] -= 1;
-	    icrds[1] -= 1;
-	}
-	if (icrds[0] == xmax-1 && icrds[2] == zmax-1)
-	{
-	    icrds[0] += 1;
-	    icrds[2] += 1;
-	    coords[0] += h[0];
-	    coords[2] += h[2];
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],NORTH,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,1,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,1,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,&n_ecrx,
-				    crds_crx,iv,ie);
-		}
-	    }
-	    seg_crx_count[k] = n_ecrx;
-	    coords[0] -= h[0];
-	    coords[2] -= h[2];
-	    icrds[0] -= 1;
-	    icrds[2] -= 1;
-	}
-	if (icrds[1] == ymax-1 && icrds[2] == zmax-1)
-	{
-	    icrds[1] += 1;
-	    icrds[2] += 1;
-	    coords[1] += h[1];
-	    coords[2] += h[2];
-	    k = seg_index3d(icrds[0],icrds[1],icrds[2],EAST,gmax);
-	    edge_list = seg_crx_lists[k];
-	    crx_list = crx_store + *index;
-	    n_ecrx = 0;
-	    for (i = 0; i < num_tris; ++i)
-	    {
-	    	if (tri_edge_crossing(tris[i],coords,crds_crx,0,&iv,&ie,h))
-		{
-		    add_to_crx_list(index,0,intfc,tris[i],surfs[i],crx_list,
-				    crx_tmp_store,edge_list,&n_ecrx,
-				    crds_crx,iv,ie);
-		}
+		if (flags != NULL && flags[n*num_tris+i] == 0)
+		    continue;
+	    	if (tri_edge_crossing(tris[i],coords,crds_crx,edir[n],
+					&iv,&ie,h))
+	    	{
+		    add_to_crx_list(index,edir[n],intfc,tris[i],surfs[i],
+				crx_list,crx_tmp_store,edge_list,&n_ecrx,
+				crds_crx,iv,ie);
+	    	}
 	    }
 	    seg_crx_count[k] = n_ecrx;
-	    coords[1] -= h[1];
-	    coords[2] -= h[2];
-	    icrds[1] -= 1;
-	    icrds[2] -= 1;
 	}
 }		/*end insert_block_crossings*/
 
@@ -4894,9 +4724,12 @@ EXPORT 	int insert_grid_intfc_crossings3d(
 	SURFACE		**s;
 	int		nt;
         int             icrds[MAXD];
-        int             i,j,k;
+        int             i,j,k,id,nblocks;
         int             crx_index = 0;
         int             xmax, ymax, zmax;
+	int		en[MAX_BLOCK_EDGES][MAXD], edir[MAX_BLOCK_EDGES];
+	int		*flag_offsets;
+	unsigned char	*flags;
         CRXING          *crx_store = T->crx_store;
         int             **seg_crx_lists = T->seg_crx_lists;
         int             *seg_crx_count = T->seg_crx_count;
@@ -4911,18 +4744,50 @@ EXPORT 	int insert_grid_intfc_crossings3d(
         ymax = rgr->gmax[1];
         zmax = rgr->gmax[2];
 
+	/* Offsets of the edge-tri crossing flags of each block */
+
+	nblocks = T->num_tri_pages*TOPO_TILE_VOLUME;
+	uni_array(&flag_offsets,nblocks+1,INT);
+	flag_offsets[0] = 0;
+	for (id = 0; id < nblocks; ++id)
+	{
+	    nt = T->tri_offsets[id+1] - T->tri_offsets[id];
+	    flag_offsets[id+1] = flag_offsets[id];
+	    if (nt == 0) continue;
+	    topo_block_icoords3d(T,id,icrds);
+	    flag_offsets[id+1] += nt*block_grid_edges3d(icrds,rgr->gmax,
+							  en,edir);
+	}
+	uni_array(&flags,max(flag_offsets[nblocks],1),sizeof(unsigned char));
+
+#pragma omp parallel for schedule(dynamic,TOPO_TILE_VOLUME) \
+		if (nblocks > MIN_PARALLEL_CRX_BLOCKS)
+	for (id = 0; id < nblocks; ++id)
+	{
+	    int ntris = T->tri_offsets[id+1] - T->tri_offsets[id];
+	    int ic[MAXD];
+
+	    if (ntris == 0) continue;
+	    topo_block_icoords3d(T,id,ic);
+	    flag_block_crossings(rgr,T->tristore + T->tri_offsets[id],ntris,
+				 ic,flags + flag_offsets[id]);
+	}
+
 	for (k = 0; k < zmax; ++k)
 	for (j = 0; j < ymax; ++j)
 	for (i = 0; i < xmax; ++i)
 	{
-	    nt = T->num_of_tris[k][j][i];
+	    nt = Num_tris_in_block3d(T,i,j,k);
 	    if (nt == 0) continue;
-	    t = T->tris[k][j][i];
-	    s = T->surfaces[k][j][i];
+	    t = Tris_in_block3d(T,i,j,k);
+	    s = Surfs_in_block3d(T,i,j,k);
             icrds[0] = i; icrds[1] = j; icrds[2] = k;
+	    id = Topo_block_id3d(T,i,j,k);
 	    insert_block_crossings(grid_intfc,rgr,crx_store,seg_crx_lists,
-			seg_crx_count,t,s,nt,icrds,&crx_index);
+			seg_crx_count,t,s,nt,icrds,&crx_index,
+			flags + flag_offsets[id]);
 	}
+	free_these(2,flag_offsets,flags);
 	if (crx_index != T->n_crx)
 	{
 	    (void) printf("ERROR: counted number of crossings does not"
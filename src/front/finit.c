@@ -76,6 +76,10 @@ LOCAL	void    init_3d_front_states(Front*,INIT_DATA*,
 					      INIT_DATA*));
 LOCAL	void	f_prompt_for_surface_redist_options(INIT_DATA*);
 LOCAL 	void 	read_print_front_time_and_step(Front*,FILE*);
+LOCAL	void	restart_slice(F_BASIC_DATA*,int,int,int,int*,int*);
+LOCAL	INTERFACE **read_restart_pieces(F_INIT_DATA*,Front*,F_BASIC_DATA*,
+				int*);
+LOCAL	INTERFACE *join_restart_pieces(Front*,INTERFACE**,int*);
 
 /*
 *			prompt_for_front_options():
@@ -1687,7 +1691,25 @@ EXPORT  void    FT_StartUp(
 		set_size_of_intfc_state(front->sizest);
 
         	f_set_interface_hooks(dim,init_data(&Init));
-		if (ft_basic->RestartRun)
+		if (ft_basic->RepartitionRun)
+		{
+		    INTERFACE **pieces;
+		    int num_pieces[MAXD];
+		    comp_grid[i_grid].dim = dim;
+		    set_remap_and_rect_grid(ft_basic->L,ft_basic->U,
+			    ft_basic->gmax,IDENTITY_REMAP,&comp_grid[i_grid]);
+        	    front->rect_grid = &comp_grid[i_grid];
+		    pieces = read_restart_pieces(&Init,front,ft_basic,
+					num_pieces);
+		    i_intfc(&Init) = front->interf = pieces[0];
+        	    set_default_front(&Init,front);
+		    i_intfc(&Init) = front->interf = 
+			join_restart_pieces(front,pieces,num_pieces);
+		    free(pieces);
+		    set_size_of_intfc_state(front->sizest);
+		    set_default_comp(NO);
+		}
+		else if (ft_basic->RestartRun)
 		{
 		    IO_TYPE io_type;
 		    int grid_set;
@@ -1696,7 +1718,7 @@ EXPORT  void    FT_StartUp(
 		    set_remap_and_rect_grid(ft_basic->L,ft_basic->U,
 			    ft_basic->gmax,IDENTITY_REMAP,&comp_grid[i_grid]);
         	    front->rect_grid = &comp_grid[i_grid];
-		    rfile = fopen(ft_basic->restart_name,"r");
+		    rfile = fopen_uncompressed(ft_basic->restart_name);
 		    determine_io_type(rfile,&io_type);
 		    read_print_front_time_and_step(front,io_type.file);
 		    i_intfc(&Init) = front->interf = 
@@ -1747,7 +1769,9 @@ EXPORT  void    FT_StartUp(
 
 	front->hdf_movie_var = NULL;
 	set_topological_grid(front->interf,front->rect_grid);
-	if (ft_basic != NULL && ft_basic->RestartRun)
+	if (ft_basic != NULL && ft_basic->RepartitionRun)
+	    clip_front_to_subdomain(front);
+	else if (ft_basic != NULL && ft_basic->RestartRun)
 	{
 	    int rbt[3][2];
 	    for (i = 0; i < dim; ++i)
@@ -1762,6 +1786,173 @@ EXPORT  void    FT_StartUp(
 	return;
 }       /* end FT_StartUp */
 
+/*
+*			restart_slice():
+*
+*	Mesh cells [lo,hi) of slice k in direction i of the partition of
+*	the restart run, printed by a load balanced run or the uniform one.
+*/
+
+LOCAL	void	restart_slice(
+	F_BASIC_DATA	*ft_basic,
+	int	G,
+	int	i,
+	int	k,
+	int	*lo,
+	int	*hi)
+{
+	int	*cuts = ft_basic->restart_cuts[i];
+
+	if (cuts != NULL)
+	{
+	    *lo = cuts[k];
+	    *hi = cuts[k+1];
+	}
+	else
+	    partition_slice(G,ft_basic->restart_subdomains[i],k,lo,hi);
+}	/* end restart_slice */
+
+/*
+*			read_restart_pieces():
+*
+*	Reads the interfaces of a restart run printed on the partition
+*	ft_basic->restart_subdomains, cut at ft_basic->restart_cuts after
+*	load balancing.  Only the files overlapping the
+*	subdomain of this processor and its buffer zones are read, they
+*	are returned as a box of num_pieces[0] x num_pieces[1] x
+*	num_pieces[2] pieces, x fastest.  The front states of each file
+*	are read by the optional ft_basic->read_restart_intfc_states(),
+*	since the points are reordered once the pieces are joined.
+*/
+
+LOCAL	INTERFACE **read_restart_pieces(
+	F_INIT_DATA	*Init,
+	Front		*front,
+	F_BASIC_DATA	*ft_basic,
+	int		*num_pieces)
+{
+	RECT_GRID	*gr = front->rect_grid;
+	INTERFACE	**pieces;
+	IO_TYPE		io_type;
+	FILE		*rfile;
+	int		*P = ft_basic->restart_subdomains;
+	int		*G = gr->gmax;
+	int		dim = gr->dim;
+	int		lo[MAXD],hi[MAXD],pmin[MAXD],ip[MAXD];
+	int		i,k,id,l,h,grid_set;
+	int		num_files = 1,num_old_files = 1;
+	char		fname[256],sname[256];
+
+	/* Mesh cells of this subdomain and its buffer zones */
+	id = pp_mynode();
+	for (i = 0; i < dim; ++i)
+	{
+	    partition_slice(G[i],ft_basic->subdomains[i],
+				id % ft_basic->subdomains[i],&lo[i],&hi[i]);
+	    id /= ft_basic->subdomains[i];
+	    lo[i] = max(lo[i] - buffer_zones(init_data(Init))[i],0);
+	    hi[i] = min(hi[i] + buffer_zones(init_data(Init))[i],G[i]);
+	}
+	for (i = 0; i < MAXD; ++i)
+	{
+	    num_pieces[i] = 1;
+	    if (i >= dim) continue;
+	    for (pmin[i] = 0; pmin[i] < P[i] - 1; ++pmin[i])
+	    {
+		restart_slice(ft_basic,G[i],i,pmin[i],&l,&h);
+		if (h > lo[i]) break;
+	    }
+	    for (; pmin[i] + num_pieces[i] < P[i]; ++num_pieces[i])
+	    {
+		restart_slice(ft_basic,G[i],i,pmin[i] + num_pieces[i],&l,&h);
+		if (l >= hi[i]) break;
+	    }
+	    num_files *= num_pieces[i];
+	    num_old_files *= P[i];
+	}
+
+	uni_array(&pieces,num_files,sizeof(INTERFACE*));
+	uni_array(&ft_basic->restart_pieces,num_files,INT);
+	uni_array(&ft_basic->restart_piece_grids,num_files,sizeof(RECT_GRID));
+	ft_basic->num_restart_pieces = num_files;
+	for (k = 0; k < num_files; ++k)
+	{
+	    for (id = k, i = 0; i < dim; ++i)
+	    {
+		ip[i] = pmin[i] + id % num_pieces[i];
+		id /= num_pieces[i];
+	    }
+	    id = domain_id(ip,P,dim);
+	    strcpy(fname,ft_basic->restart_name);
+	    strcpy(sname,ft_basic->restart_state_name);
+	    if (num_old_files > 1)
+	    {
+		sprintf(fname+strlen(fname),"-nd%s",right_flush(id,4));
+		sprintf(sname+strlen(sname),"-nd%s",right_flush(id,4));
+	    }
+	    if ((rfile = fopen_uncompressed(fname)) == NULL)
+	    {
+		screen("ERROR in read_restart_pieces(), "
+		       "cannot open restart file %s\n",fname);
+		clean_up(ERROR);
+	    }
+	    determine_io_type(rfile,&io_type);
+	    read_print_front_time_and_step(front,io_type.file);
+	    pieces[k] = read_print_interface((INIT_DATA*)Init,&io_type,
+					NO,&grid_set);
+	    (void) Fclose(rfile);
+	    if (ft_basic->read_restart_intfc_states != NULL)
+		(*ft_basic->read_restart_intfc_states)(pieces[k],sname);
+	    ft_basic->restart_pieces[k] = id;
+	    copy_rect_grid(&ft_basic->restart_piece_grids[k],
+				computational_grid(pieces[k]));
+	}
+	return pieces;
+}	/* end read_restart_pieces */
+
+/*
+*			join_restart_pieces():
+*
+*	Joins the box of restart pieces into one interface on the global
+*	computational grid, ready to be clipped to the new subdomain.
+*/
+
+LOCAL	INTERFACE *join_restart_pieces(
+	Front		*front,
+	INTERFACE	**pieces,
+	int		*num_pieces)
+{
+	INTERFACE	*intfc = NULL;
+	int		i,dim = front->rect_grid->dim;
+	int		last = num_pieces[0]*num_pieces[1]*num_pieces[2] - 1;
+	int		rbt[MAXD][2];
+
+	for (i = 0; i < dim; ++i)
+	{
+	    rbt[i][0] = rect_boundary_type(pieces[0],i,0);
+	    rbt[i][1] = rect_boundary_type(pieces[last],i,1);
+	}
+	if (last == 0)
+	    intfc = pieces[0];
+	else if (dim == 2)
+	    intfc = assemble_intfc_pieces2d(front,pieces,num_pieces);
+	else if (dim == 3)
+	    intfc = assemble_intfc_pieces3d(pieces,num_pieces);
+	else
+	{
+	    screen("ERROR in join_restart_pieces(), "
+		   "repartitioned restart is not implemented in %dD\n",dim);
+	    clean_up(ERROR);
+	}
+	for (i = 0; i < dim; ++i)
+	{
+	    rect_boundary_type(intfc,i,0) = rbt[i][0];
+	    rect_boundary_type(intfc,i,1) = rbt[i][1];
+	}
+	copy_rect_grid(computational_grid(intfc),front->rect_grid);
+	return intfc;
+}	/* end join_restart_pieces */
+
 EXPORT	void FT_InitIntfc(
         Front  *front,
 	LEVEL_FUNC_PACK *level_func_pack)
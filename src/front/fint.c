@@ -69,6 +69,7 @@ LOCAL	void 	f_fprint_Dirichlet_bdry_states(FILE*,INTERFACE*);
 	/* LOCAL external variables */
 LOCAL size_t	size_of_intfc_state = 0;
 LOCAL boolean	copyintfcstates = YES;
+LOCAL boolean	shareintfcstates = NO;
 LOCAL boolean      set_copy_from_to_lists = NO;
 LOCAL boolean      usewalledge = NO;
 
@@ -126,6 +127,30 @@ EXPORT boolean copy_intfc_states(void)
 	return copyintfcstates;
 }		/*end copy_intfc_states*/
 
+/*
+*		copy_interface_sharing_states():
+*
+*	Copies intfc without copying the point states.  The points of the
+*	copy refer to the states of the points of intfc, which stay in the
+*	storage of intfc.  This is for temporary copies that are cut and
+*	then copied again, as the buffer interfaces of the scatter, where
+*	copying every state of intfc is wasted on the points that are cut
+*	away.  The copy must not write its shared states and must be
+*	deleted before intfc.  Points added to the copy get their own
+*	states, and the curve and bond tri states are copied as usual.
+*/
+
+EXPORT INTERFACE *copy_interface_sharing_states(
+	INTERFACE	*intfc)
+{
+	INTERFACE	*new_intfc;
+
+	shareintfcstates = YES;
+	new_intfc = copy_interface(intfc);
+	shareintfcstates = NO;
+	return new_intfc;
+}		/*end copy_interface_sharing_states*/
+
 
 EXPORT	void set_computational_grid(
 	INTERFACE	*intfc,
@@ -555,7 +580,7 @@ EXPORT	POINT *f_Point(
 
 	if ((p = i_Point(coords)) == NULL)
 	    return NULL;
-	if ((sizest = size_of_state(intfc)) != 0)
+	if (((sizest = size_of_state(intfc)) != 0) && !shareintfcstates)
 	{
 	    left_state(p) = alloc_intfc_state(intfc,sizest);
 	    right_state(p) = alloc_intfc_state(intfc,sizest);
@@ -597,7 +622,12 @@ EXPORT	POINT *f_copy_point(
 	INTERFACE	*intfc = current_interface();
 	int i,dim = intfc->dim;
 
-	if ((copy_intfc_states() == YES) &&
+	if (shareintfcstates)
+	{
+	    left_state(newp) = left_state(p);
+	    right_state(newp) = right_state(p);
+	}
+	else if ((copy_intfc_states() == YES) &&
 	    ((sizest = size_of_state(intfc)) != 0))
 	{
 	    ft_assign(left_state(newp),left_state(p),sizest);
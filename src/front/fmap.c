@@ -42,6 +42,7 @@ LOCAL 	void FrontPreAdvance2d(Front*);
 LOCAL 	void FrontPreAdvance3d(Front*);
 LOCAL 	void sort_blk_cell(INTRP_CELL *);
 LOCAL   boolean new_vtx_is_closer(double,double,double*,double*,int);
+LOCAL	void init_thread_runtime(F_BASIC_DATA*);
 LOCAL	boolean extrapolation_permitted;
 
 EXPORT	void FT_Propagate(
@@ -366,16 +367,25 @@ EXPORT	void	FT_Init(
 	char *out_name     = f_basic->out_name;
 	char *restart_name = f_basic->restart_name;
 	int  *subdomains   = f_basic->subdomains;
+	int  *restart_subdomains = f_basic->restart_subdomains;
         int i,total_num_proc = 1;
+	boolean repartition = NO;
 	char dirname[256];
 	char file_name[256];
 	FILE *ifile;
 
         pp_init(&argc,&argv);
-	if (f_basic == NULL) return;
+	if (f_basic == NULL)
+	{
+	    pp_thread_init(0);
+	    return;
+	}
 
 	f_basic->ReadFromInput = NO;
 	f_basic->RestartRun = NO;
+	f_basic->RepartitionRun = NO;
+	f_basic->read_restart_intfc_states = NULL;
+	f_basic->num_restart_pieces = 0;
     	f_basic->dim = 1;
 
 	argc--;
@@ -383,7 +393,10 @@ EXPORT	void	FT_Init(
 	/* Set for default */
 	strcpy(out_name,"intfc");
 	for (i = 0; i < MAXD; ++i)
-            subdomains[i] = 1;
+	{
+            subdomains[i] = restart_subdomains[i] = 1;
+	    f_basic->restart_cuts[i] = NULL;
+	}
 	f_basic->coord_system = IDENTITY_REMAP;
 	while (argc >= 1)
 	{
@@ -427,6 +440,19 @@ EXPORT	void	FT_Init(
                 argc -= 2;
                 argv += 2;
                 break;
+	    case 'n':
+	    case 'N':
+		repartition = YES;
+                for (i = 0; i < MAXD; ++i)
+                {
+                    if (argc < 2 || argv[1][0] == '-') break;
+                    argc -= 1;
+                    argv += 1;
+                    restart_subdomains[i] = atoi(argv[0]);
+                }
+                argc -= 1;
+                argv += 1;
+		break;
 	    case 'c':
 	    case 'C':
 		switch (argv[1][0])
@@ -491,8 +517,53 @@ EXPORT	void	FT_Init(
 		argv += 2;
 	    }
 	}
+	/* A restart over a different partition reads all restart files
+	 * overlapping the new subdomain, see FT_StartUp() */
+	for (i = 0; i < MAXD; ++i)
+	{
+	    if (!repartition)
+		restart_subdomains[i] = subdomains[i];
+	    else if (restart_subdomains[i] != subdomains[i])
+		f_basic->RepartitionRun = f_basic->RestartRun;
+	}
+	/* A load balanced run leaves the cells of its subdomains */
+	if (f_basic->RestartRun)
+	{
+	    sprintf(file_name,"%s/intfc-ts%s-partition",restart_name,
+			right_flush(f_basic->RestartStep,7));
+	    if (read_front_partition(file_name,f_basic->dim,
+			restart_subdomains,f_basic->restart_cuts))
+		f_basic->RepartitionRun = YES;
+	}
+	init_thread_runtime(f_basic);
 }	/* end FrontInitStatndardIO */
 
+/*
+*	Starts the thread runtime of the libraries.  The number of threads
+*	is read from the optional input line "Enter number of threads:",
+*	or else taken from the environment (see pp_thread_init()).
+*/
+
+LOCAL	void init_thread_runtime(
+	F_BASIC_DATA *f_basic)
+{
+	FILE *infile;
+	int nthreads = 0;
+
+	if (f_basic->ReadFromInput &&
+	    (infile = fopen(f_basic->in_name,"r")) != NULL)
+	{
+	    if (fgetstring(infile,"Enter number of threads:"))
+	    {
+		if (fscanf(infile,"%d",&nthreads) != 1)
+		    nthreads = 0;
+		(void) printf("Enter number of threads: %d\n",nthreads);
+	    }
+	    fclose(infile);
+	}
+	pp_thread_init(nthreads);
+}	/* end init_thread_runtime */
+
 EXPORT	void FT_Draw(
 	Front *front)
 {
@@ -1801,6 +1872,48 @@ EXPORT	boolean FrontCpuAdaptSubdomain(
 	return cpu_adapt_front(front,cpu_time,lexpand,uexpand);
 }	/* end FrontCpuAdaptSubdomain */
 
+EXPORT	double FT_IntfcElementWeight(
+	Front *front,
+	double front_time,
+	double field_time)
+{
+	return intfc_element_weight(front,front_time,field_time);
+}	/* end FT_IntfcElementWeight */
+
+EXPORT	boolean FT_BalancePartition(
+	Front *front,
+	double weight,
+	double tol,
+	int **cuts)
+{
+	return balance_front_partition(front,weight,tol,cuts);
+}	/* end FT_BalancePartition */
+
+EXPORT	boolean FT_ShiftSubdomain(
+	Front *front,
+	int **cuts,
+	int *lexpand,
+	int *uexpand)
+{
+	if (!shift_front_subdomain(front,cuts,lexpand,uexpand))
+	    return NO;
+
+	/* The grid interfaces follow the new subdomain */
+	if (front->old_grid_intfc != NULL)
+	    FT_FreeOldGridIntfc(front);
+	if (front->grid_intfc != NULL)
+	{
+	    FT_FreeGridIntfc(front);
+	    FT_MakeGridIntfc(front);
+	}
+	if (front->comp_grid_intfc != NULL)
+	{
+	    FT_FreeCompGridIntfc(front);
+	    FT_MakeCompGridIntfc(front);
+	}
+	return YES;
+}	/* end FT_ShiftSubdomain */
+
 EXPORT void FT_ReadSpaceDomain(
         char *in_name,
         F_BASIC_DATA *f_basic)
@@ -3281,6 +3394,33 @@ EXPORT	void FT_SetTimeStep(
             printf("Time step from FT_SetTimeStep(): %f\n",front->dt);
 }	/* end FT_SetTimeStep */
 
+EXPORT	void FT_SetTimeStepWithMaxSpeeds(
+	Front *front,
+	int n,
+	double *max_speed)
+{
+	double fcrds[MAXD];
+	double *vals;
+	double CFL = Time_step_factor(front);
+	int i;
+
+	uni_array(&vals,n+1,sizeof(double));
+	/* f_max_front_time_step, negated to be maximized with the speeds */
+	vals[0] = -CFL*(*front->max_front_time_step)(front,fcrds);
+	for (i = 0; i < n; ++i)
+	    vals[i+1] = max_speed[i];
+#if defined(__MPI__)
+	pp_global_max(vals,n+1);
+#endif /* defined(__MPI__) */
+	front->dt = -vals[0];
+	for (i = 0; i < n; ++i)
+	    max_speed[i] = vals[i+1];
+	free(vals);
+	if (debugging("step_size"))
+            printf("Time step from FT_SetTimeStepWithMaxSpeeds(): %f\n",
+				front->dt);
+}	/* end FT_SetTimeStepWithMaxSpeeds */
+
 EXPORT	void FT_InitDebug(char *inname)
 {
 	FILE *infile = fopen(inname,"r");
@@ -3349,6 +3489,117 @@ EXPORT	void FT_GetStatesAtPoint(
 	slsr(p,hse,hs,sl,sr);
 }	/* end FT_GetStatesAtPoint */
 
+EXPORT	HS_STATE_POOL *FT_MakeHsStatePool(
+	Front *front,
+	HYPER_SURF *hs,
+	int num_vars,
+	double (**state_var)(Locstate))
+{
+	HS_STATE_POOL *pool;
+	HYPER_SURF_ELEMENT **hse;
+	Locstate sl,sr;
+	POINT *p;
+	int i,j,v,n;
+	int dim = front->rect_grid->dim;
+
+	FT_ScalarMemoryAlloc((POINTER*)&pool,sizeof(HS_STATE_POOL));
+	pool->hs = hs;
+	pool->num_vars = num_vars;
+	FT_VectorMemoryAlloc((POINTER*)&pool->state_var,max(num_vars,1),
+				sizeof(double (*)(Locstate)));
+	for (v = 0; v < num_vars; ++v)
+	    pool->state_var[v] = state_var[v];
+
+	/* Number the points, hse[i] is an element with points[i] */
+	n = 0;
+	if (dim == 2)
+	{
+	    CURVE *c = Curve_of_hs(hs);
+	    BOND *b;
+
+	    for (n = 1, b = c->first; b != NULL; b = b->next)
+		++n;
+	    FT_VectorMemoryAlloc((POINTER*)&pool->points,max(n,1),
+				sizeof(POINT*));
+	    FT_VectorMemoryAlloc((POINTER*)&hse,max(n,1),
+				sizeof(HYPER_SURF_ELEMENT*));
+	    for (i = 0, b = c->first; b != NULL; b = b->next, ++i)
+	    {
+		pool->points[i] = b->start;
+		hse[i] = Hyper_surf_element(b);
+	    }
+	    pool->points[i] = c->last->end;
+	    hse[i] = Hyper_surf_element(c->last);
+	}
+	else if (dim == 3)
+	{
+	    SURFACE *s = Surface_of_hs(hs);
+	    TRI *tri;
+
+	    for (tri = first_tri(s); !at_end_of_tri_list(tri,s);
+				tri = tri->next)
+		for (j = 0; j < 3; ++j)
+		    Index_of_point(Point_of_tri(tri)[j]) = -1;
+	    for (tri = first_tri(s); !at_end_of_tri_list(tri,s);
+				tri = tri->next)
+		for (j = 0; j < 3; ++j)
+		{
+		    p = Point_of_tri(tri)[j];
+		    if (Index_of_point(p) == -1)
+			Index_of_point(p) = n++;
+		}
+	    FT_VectorMemoryAlloc((POINTER*)&pool->points,max(n,1),
+				sizeof(POINT*));
+	    FT_VectorMemoryAlloc((POINTER*)&hse,max(n,1),
+				sizeof(HYPER_SURF_ELEMENT*));
+	    for (i = 0; i < n; ++i)
+		pool->points[i] = NULL;
+	    for (tri = first_tri(s); !at_end_of_tri_list(tri,s);
+				tri = tri->next)
+		for (j = 0; j < 3; ++j)
+		{
+		    p = Point_of_tri(tri)[j];
+		    i = Index_of_point(p);
+		    if (pool->points[i] != NULL)
+			continue;
+		    pool->points[i] = p;
+		    hse[i] = Hyper_surf_element(tri);
+		}
+	}
+	else
+	{
+	    screen("ERROR in FT_MakeHsStatePool(), dim = %d not supported\n",
+				dim);
+	    clean_up(ERROR);
+	}
+	pool->num_points = n;
+
+	FT_MatrixMemoryAlloc((POINTER*)&pool->left_var,max(num_vars,1),
+				max(n,1),sizeof(double));
+	FT_MatrixMemoryAlloc((POINTER*)&pool->right_var,max(num_vars,1),
+				max(n,1),sizeof(double));
+	for (i = 0; i < n; ++i)
+	{
+	    slsr(pool->points[i],hse[i],hs,&sl,&sr);
+	    for (v = 0; v < num_vars; ++v)
+	    {
+		pool->left_var[v][i] = (*state_var[v])(sl);
+		pool->right_var[v][i] = (*state_var[v])(sr);
+	    }
+	}
+	FT_FreeThese(1,hse);
+	return pool;
+}	/* end FT_MakeHsStatePool */
+
+EXPORT	void FT_FreeHsStatePool(
+	HS_STATE_POOL *pool)
+{
+	if (pool == NULL)
+	    return;
+	FT_FreeThese(5,pool->state_var,pool->points,pool->left_var,
+				pool->right_var,pool);
+}	/* end FT_FreeHsStatePool */
+
 EXPORT	void FT_ScalarMemoryAlloc(
 	POINTER *a,
 	int size)
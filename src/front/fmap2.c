@@ -36,9 +36,18 @@ LOCAL double corner_cell_frac(double***,double***,COMPONENT**,
 LOCAL void rot_clockwise_90(double***,double***,int**);
 LOCAL void FT_ComputeGridVolumeFraction2d(Front*,COMPONENT,POINTER*);
 LOCAL double FT_ComputeTotalVolumeFraction2d(Front*,COMPONENT);
+LOCAL void FT_ComputeGridVolumeFraction3d(Front*,COMPONENT,POINTER*);
+LOCAL double FT_ComputeTotalVolumeFraction3d(Front*,COMPONENT);
+LOCAL double cut_cell_volume3d(RECT_GRID*,Table*,int*,COMPONENT);
+LOCAL void cell_edge_crossing3d(RECT_GRID*,Table*,int*,int,double*);
 LOCAL void forward_curve_seg_len_constr(CURVE*,BOND*,BOND*,int,double);
 LOCAL void backward_curve_seg_len_constr(CURVE*,BOND*,BOND*,int,double);
 static boolean find_nearest_ring2_cell_with_comp(int*,int*,int*,int*,int);
+LOCAL void init_signed_distance(INTERFACE*,double,double*,char*);
+LOCAL double sweep_signed_distance(RECT_GRID*,double*,char*);
+LOCAL double eikonal_update(double*,double*,int);
+LOCAL double sqr_dist_to_bond(double*,BOND*);
+LOCAL double sqr_dist_to_tri(double*,TRI*);
 
 EXPORT double FT_ComputeTotalVolumeFraction(
 	Front *front,
@@ -49,8 +58,7 @@ EXPORT double FT_ComputeTotalVolumeFraction(
 	case 2:
 	    return FT_ComputeTotalVolumeFraction2d(front,comp_of_vol);
 	case 3:
-	    screen("FT_ComputeTotalVolumeFraction3d() not implemented!\n");
-	    return 0.0;
+	    return FT_ComputeTotalVolumeFraction3d(front,comp_of_vol);
 	}
 }	/* end FT_ComputeTotalVolumeFraction */
 
@@ -93,7 +101,7 @@ EXPORT void FT_ComputeGridVolumeFraction(
 	    FT_ComputeGridVolumeFraction2d(front,comp_of_vol,grid_vol_frac);
 	    return;
 	case 3:
-	    screen("FT_ComputeVolumeFraction3d() not implemented!\n");
+	    FT_ComputeGridVolumeFraction3d(front,comp_of_vol,grid_vol_frac);
 	    return;
 	}
 }	/* end FT_ComputeGridVolumeFraction */
@@ -289,6 +297,236 @@ LOCAL void rot_clockwise_90(
 	}
 }	/* end rot_clockwise_90 */
 
+/*
+*	Total volume of comp_of_vol in the cells of the topological grid
+*	owned by this subdomain, summed over all subdomains.  Cells with
+*	all corners on one side are counted without a crossing lookup.
+*	The grid interface is remade every step, so the total is one pass
+*	over the owned cells per call rather than an update.
+*/
+
+LOCAL double FT_ComputeTotalVolumeFraction3d(
+	Front *front,
+	COMPONENT comp_of_vol)
+{
+	INTERFACE *grid_intfc = front->grid_intfc;
+	RECT_GRID *top_grid = &topological_grid(grid_intfc);
+	Table *T = table_of_interface(grid_intfc);
+	int *lbuf = front->rect_grid->lbuf;
+	int *ubuf = front->rect_grid->ubuf;
+	int *top_gmax = top_grid->gmax;
+	double total_vol = 0.0;
+	int i,j,k,imin[MAXD],imax[MAXD];
+
+	for (i = 0; i < 3; ++i)
+	{
+	    imin[i] = lbuf[i];
+	    imax[i] = (ubuf[i] == 0) ? top_gmax[i] - 1 : top_gmax[i] - ubuf[i];
+	}
+#pragma omp parallel for private(i,j) reduction(+:total_vol)
+	for (k = imin[2]; k <= imax[2]; ++k)
+	for (j = imin[1]; j <= imax[1]; ++j)
+	for (i = imin[0]; i <= imax[0]; ++i)
+	{
+	    int icell[MAXD];
+	    icell[0] = i;	icell[1] = j;	icell[2] = k;
+	    total_vol += cut_cell_volume3d(top_grid,T,icell,comp_of_vol);
+	}
+
+	pp_global_sum(&total_vol,1);
+	return total_vol;
+}	/* end FT_ComputeTotalVolumeFraction3d */
+
+/*
+*	Volume of comp_of_vol in the cells of the topological grid, the
+*	cell (i,j,k) lying between the nodes (i,j,k) and (i+1,j+1,k+1).
+*	The buffer cells are taken from the neighboring subdomains so the
+*	overlapping cells agree.
+*/
+
+LOCAL void FT_ComputeGridVolumeFraction3d(
+	Front *front,
+	COMPONENT comp_of_vol,
+	POINTER *grid_vol_frac)
+{
+	INTERFACE *grid_intfc = front->grid_intfc;
+	RECT_GRID *top_grid = &topological_grid(grid_intfc);
+	Table *T = table_of_interface(grid_intfc);
+	int *gmax = top_grid->gmax;
+	double ***vol_frac_3d;
+	double *vol;
+	int i,j,k,size;
+
+	size = (gmax[0] + 1)*(gmax[1] + 1)*(gmax[2] + 1);
+	uni_array(&vol,size,FLOAT);
+	FT_TriArrayMemoryAlloc((POINTER*)&vol_frac_3d,gmax[0],gmax[1],gmax[2],
+				sizeof(double));
+#pragma omp parallel for private(i,j)
+	for (k = 0; k <= gmax[2]; ++k)
+	for (j = 0; j <= gmax[1]; ++j)
+	for (i = 0; i <= gmax[0]; ++i)
+	{
+	    int icell[MAXD];
+	    icell[0] = i;	icell[1] = j;	icell[2] = k;
+	    vol[d_index3d(i,j,k,gmax)] = (i == gmax[0] || j == gmax[1] ||
+			k == gmax[2]) ? 0.0 :
+			cut_cell_volume3d(top_grid,T,icell,comp_of_vol);
+	}
+	FT_ParallelExchGridArrayBuffer(vol,front,NULL);
+
+	for (i = 0; i < gmax[0]; ++i)
+	for (j = 0; j < gmax[1]; ++j)
+	for (k = 0; k < gmax[2]; ++k)
+	    vol_frac_3d[i][j][k] = vol[d_index3d(i,j,k,gmax)];
+	free(vol);
+	*grid_vol_frac = (POINTER)vol_frac_3d;
+}	/* end FT_ComputeGridVolumeFraction3d */
+
+/*
+*	Volume of comp_of_vol in cell icell by the divergence theorem,
+*
+*		V = 1/3 sum_faces A_f (x_f - x0).n_f
+*
+*	where A_f is the area of comp_of_vol on face f, cut by the grid
+*	crossings on its edges, and x0 is the mean of the crossings of the
+*	cell.  The interface term vanishes for x0 on a planar interface, so
+*	the volume is exact for an interface planar in the cell and second
+*	order otherwise.  The faces are shared with the neighboring cells,
+*	so the cut volumes of a closed surface add up to its volume.  T is
+*	the table of the grid interface, looked up once by the caller since
+*	table_of_interface() locks the table list.
+*/
+
+LOCAL double cut_cell_volume3d(
+	RECT_GRID *top_grid,
+	Table *T,
+	int *icell,
+	COMPONENT comp_of_vol)
+{
+	COMPONENT *top_comp = T->components;
+	int *gmax = top_grid->gmax;
+	double *L = top_grid->L;
+	double *h = top_grid->h;
+	static const int cycle[4][2] = {{0,0},{1,0},{1,1},{0,1}};
+	boolean in[8];
+	double crx[3][4][MAXD];
+	double x0[MAXD],poly[8][2],area,xf,volume;
+	int ic[MAXD],m,n_in,ncrx,l,la,lb,s,e,v,n,ia,ib;
+
+	n_in = 0;
+	for (m = 0; m < 8; ++m)
+	{
+	    for (l = 0; l < 3; ++l)
+		ic[l] = icell[l] + ((m >> l) & 1);
+	    in[m] = (top_comp[d_index3d(ic[0],ic[1],ic[2],gmax)] ==
+				comp_of_vol) ? YES : NO;
+	    if (in[m]) ++n_in;
+	}
+	if (n_in == 0)
+	    return 0.0;
+	if (n_in == 8)
+	    return h[0]*h[1]*h[2];
+
+	/* Crossings of the edges in direction l, e indexes the edge by the
+	   offsets in the two other directions */
+	ncrx = 0;
+	x0[0] = x0[1] = x0[2] = 0.0;
+	for (l = 0; l < 3; ++l)
+	for (e = 0; e < 4; ++e)
+	{
+	    la = (l + 1)%3;
+	    lb = (l + 2)%3;
+	    m = ((e & 1) << la) | ((e >> 1) << lb);
+	    if (in[m] == in[m | (1 << l)])
+		continue;
+	    for (n = 0; n < 3; ++n)
+		ic[n] = icell[n] + ((m >> n) & 1);
+	    cell_edge_crossing3d(top_grid,T,ic,l,crx[l][e]);
+	    for (n = 0; n < 3; ++n)
+		x0[n] += crx[l][e][n];
+	    ++ncrx;
+	}
+	for (n = 0; n < 3; ++n)
+	    x0[n] /= ncrx;
+
+	volume = 0.0;
+	for (l = 0; l < 3; ++l)
+	for (s = 0; s < 2; ++s)
+	{
+	    /* Walk the face perimeter, keeping corners of comp_of_vol and
+	       the crossings where the side changes */
+	    la = (l + 1)%3;
+	    lb = (l + 2)%3;
+	    n = 0;
+	    for (v = 0; v < 4; ++v)
+	    {
+		int m0,m1;
+		ia = cycle[v][0];
+		ib = cycle[v][1];
+		m0 = (s << l) | (ia << la) | (ib << lb);
+		m1 = (s << l) | (cycle[(v+1)%4][0] << la) |
+				(cycle[(v+1)%4][1] << lb);
+		if (in[m0])
+		{
+		    poly[n][0] = L[la] + (icell[la] + ia)*h[la];
+		    poly[n][1] = L[lb] + (icell[lb] + ib)*h[lb];
+		    ++n;
+		}
+		if (in[m0] != in[m1])
+		{
+		    /* the edge runs in la if ib is unchanged, else in lb */
+		    double *p = (ib == cycle[(v+1)%4][1]) ?
+				crx[la][ib | (s << 1)] : crx[lb][s | (ia << 1)];
+		    poly[n][0] = p[la];
+		    poly[n][1] = p[lb];
+		    ++n;
+		}
+	    }
+	    if (n < 3)
+		continue;
+	    area = 0.0;
+	    for (v = 0; v < n; ++v)
+		area += poly[v][0]*poly[(v+1)%n][1] -
+			poly[(v+1)%n][0]*poly[v][1];
+	    area = 0.5*fabs(area);
+	    xf = L[l] + (icell[l] + s)*h[l];
+	    volume += (s == 1) ? area*(xf - x0[l]) : area*(x0[l] - xf);
+	}
+	volume /= 3.0;
+	return min(max(volume,0.0),h[0]*h[1]*h[2]);
+}	/* end cut_cell_volume3d */
+
+/*
+*	First crossing on the grid edge from node ic in direction l, the
+*	edge midpoint if the crossing is missing.  The crossings are read
+*	from the segment lists of T as in GridSegCrossing(), which would
+*	look up the table again for every edge.
+*/
+
+LOCAL void cell_edge_crossing3d(
+	RECT_GRID *top_grid,
+	Table *T,
+	int *ic,
+	int l,
+	double *p)
+{
+	static const GRID_DIRECTION dir[3] = {EAST,NORTH,UPPER};
+	CRXING *crx;
+	int n,k;
+
+	for (n = 0; n < 3; ++n)
+	    p[n] = top_grid->L[n] + ic[n]*top_grid->h[n];
+	k = seg_index3d(ic[0],ic[1],ic[2],dir[l],top_grid->gmax);
+	if (T->seg_crx_count[k] > 0)
+	{
+	    crx = T->crx_store + T->seg_crx_lists[k][0];
+	    for (n = 0; n < 3; ++n)
+		p[n] = Coords(crx->pt)[n];
+	}
+	else
+	    p[l] += 0.5*top_grid->h[l];
+}	/* end cell_edge_crossing3d */
+
 EXPORT double FT_CurveLength(
         CURVE *c)
 {
@@ -1868,6 +2106,8 @@ EXPORT void FT_InitFrontVeloFunc(
 
 	if (debugging("trace")) 
 	    (void) printf("Entering FT_InitFrontVeloFunc()\n");
+	front->batch_vfunc = NULL;
+	front->batch_vfunc_needs = 0;
 	if (velo_func_pack == NULL)
 	{
 	    screen("\n\t\tSpecifying Velocity Field\n\n");
@@ -1891,72 +2131,97 @@ EXPORT void FT_InitFrontVeloFunc(
 	    case 'T':
 	    case 't':
 	    	front->vfunc = translation_vel;
+	    	front->batch_vfunc = translation_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_translation_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    	break;
 	    case 'R':
 	    case 'r':
 	    	front->vfunc = radial_motion_vel;
+	    	front->batch_vfunc = radial_motion_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_radial_motion_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    	break;
 	    case 'S':
 	    case 's':
 	    	front->vfunc = shear_motion_vel;
+	    	front->parallel_point_propagate = YES;
 	    	init_shear_motion_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    	break;
 	    case 'W':
 	    case 'w':
 	    	front->vfunc = sine_motion_vel;
+	    	front->batch_vfunc = sine_motion_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_sine_motion_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    break;
 	    case 'C':
 	    case 'c':
 	    	front->vfunc = circular_rotation_vel;
+	    	front->batch_vfunc = circular_rotation_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_circular_rotation_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    	break;
 	    case 'B':
 	    case 'b':
 	    	front->vfunc = burgers_vel;
+	    	front->batch_vfunc = burgers_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_burgers_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    break;
 	    case 'H':
 	    case 'h':
 	    	front->vfunc = bipolar_vel;
+	    	front->batch_vfunc = bipolar_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_bipolar_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    	break;
 	    case 'N':
 	    case 'n':
 	    	front->vfunc = normal_vel;
+	    	front->batch_vfunc = normal_vel_batch;
+	    	front->batch_vfunc_needs = VELO_NEED_NORMAL;
+	    	front->parallel_point_propagate = NO;
 	    	init_norv_params(&front->vparams,dim);
 	    	front->_point_propagate = first_order_point_propagate;
 	    	break;
 	    case 'K':
 	    case 'k':
 	    	front->vfunc = curvature_vel;
+	    	front->batch_vfunc = curvature_vel_batch;
+	    	front->batch_vfunc_needs = VELO_NEED_NORMAL |
+					VELO_NEED_CURVATURE;
+	    	front->parallel_point_propagate = NO;
 	    	init_curvature_params(&front->vparams,dim);
 	    	front->_point_propagate = first_order_point_propagate;
 	    	break;
 	    case 'F':
 	    case 'f':
 	    	front->vfunc = flame_vel;
+	    	front->parallel_point_propagate = NO;
 	    	init_flame_params(&front->vparams,dim);
 	    	front->_point_propagate = first_order_point_propagate;
 	    	break;
 	    case 'V':
 	    case 'v':
 	    	front->vfunc = vortex_vel;
+	    	front->batch_vfunc = vortex_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_vortex_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    	break;
 	    case 'D':
 	    case 'd':
 	    	front->vfunc = double_vortex_vel;
+	    	front->batch_vfunc = double_vortex_vel_batch;
+	    	front->parallel_point_propagate = YES;
 	    	init_bipolar_params(&front->vparams,dim);
 	    	front->_point_propagate = fourth_order_point_propagate;
 	    	break;
@@ -1970,6 +2235,9 @@ EXPORT void FT_InitFrontVeloFunc(
 	{
 	    front->vfunc = velo_func_pack->func;
 	    front->vparams = velo_func_pack->func_params;
+	    front->parallel_point_propagate = velo_func_pack->reentrant;
+	    front->batch_vfunc = velo_func_pack->batch_func;
+	    front->batch_vfunc_needs = velo_func_pack->batch_needs;
 	    if (velo_func_pack->point_propagate != NULL)
 	    	front->_point_propagate = velo_func_pack->point_propagate;
 	    else
@@ -2862,3 +3130,392 @@ static void cell_length(
 	    }
 	}
 }	/* end cell_length */
+
+/*
+*			FT_ComputeSignedDistance():
+*
+*	Signed distance to the tracked interface at the nodes of the
+*	topological grid of front->grid_intfc, the grid of the solver
+*	arrays.  Nodes at a corner of a block holding BONDS or TRIS get the
+*	exact distance to the elements of the blocks within two blocks of
+*	the node.  The other nodes are filled by the parallel fast sweeping
+*	method (Detrixhe, Gibou and Min, JCP 237, 2013), which orders each
+*	of the 2^dim Gauss-Seidel sweeps by the hyperplanes i+j+k = const
+*	whose nodes are independent of each other.  Subdomain buffers are
+*	exchanged after each round of sweeps until no node changes, at most
+*	SDIST_MAX_ROUNDS rounds.  Running out of rounds leaves a partial
+*	distance away from the front and is reported by a warning.
+*/
+
+enum {
+	SDIST_MAX_ROUNDS = 32
+};
+
+EXPORT void FT_ComputeSignedDistance(
+	Front *front,
+	COMPONENT comp,
+	double band,
+	double *sdist)
+{
+	INTERFACE *grid_intfc = front->grid_intfc;
+	RECT_GRID *top_grid;
+	Table *T;
+	int *top_gmax,*top_comp;
+	int dim,size,l,ic,round;
+	double hmin,hmax,cap,change;
+	char *fixed;
+
+	if (grid_intfc == NULL)
+	{
+	    screen("ERROR in FT_ComputeSignedDistance(), "
+		   "grid_intfc not made, call FT_MakeGridIntfc() first\n");
+	    clean_up(ERROR);
+	}
+	top_grid = &topological_grid(grid_intfc);
+	top_gmax = top_grid->gmax;
+	dim = grid_intfc->dim;
+	T = table_of_interface(grid_intfc);
+	top_comp = T->components;
+	if (grid_intfc->modified || T->new_grid)
+	    make_interface_topology_lists(grid_intfc);
+
+	size = 1;
+	hmin = HUGE;
+	hmax = 0.0;
+	for (l = 0; l < dim; ++l)
+	{
+	    size *= top_gmax[l] + 1;
+	    hmin = min(hmin,top_grid->h[l]);
+	    hmax = max(hmax,top_grid->h[l]);
+	}
+	cap = (band > 0.0) ? band*hmax : HUGE_VAL;
+	uni_array(&fixed,size,CHAR);
+
+	init_signed_distance(grid_intfc,cap,sdist,fixed);
+	FT_ParallelExchGridArrayBuffer(sdist,front,NULL);
+	for (round = 0; round < SDIST_MAX_ROUNDS; ++round)
+	{
+	    change = sweep_signed_distance(top_grid,sdist,fixed);
+	    FT_ParallelExchGridArrayBuffer(sdist,front,NULL);
+	    pp_global_max(&change,1);
+	    if (debugging("signed_distance"))
+		(void) printf("FT_ComputeSignedDistance(): round %d "
+			      "change = %g\n",round,change);
+	    if (change <= 1.0e-12*hmin)
+		break;
+	}
+	if (round == SDIST_MAX_ROUNDS)
+	    screen("WARNING in FT_ComputeSignedDistance(), no convergence "
+		   "in %d sweep rounds, last change = %g\n",
+		   SDIST_MAX_ROUNDS,change);
+
+#pragma omp parallel for
+	for (ic = 0; ic < size; ++ic)
+	{
+	    if (top_comp[ic] == comp)
+		sdist[ic] = -sdist[ic];
+	}
+	free(fixed);
+}	/* end FT_ComputeSignedDistance */
+
+/*
+*	Exact unsigned distance at the nodes next to the front, cap at the
+*	other nodes.  The nodes next to the front are marked fixed.  A node
+*	with elements in one of its 2^dim blocks is within sqrt(dim)*h of
+*	them, so the elements outside the blocks within two blocks of the
+*	node, at least 2h away, cannot be closer.
+*/
+
+LOCAL void init_signed_distance(
+	INTERFACE *grid_intfc,
+	double cap,
+	double *dist,
+	char *fixed)
+{
+	RECT_GRID *top_grid = &topological_grid(grid_intfc);
+	Table *T = table_of_interface(grid_intfc);
+	int *gmax = top_grid->gmax;
+	int dim = grid_intfc->dim;
+	int nk = (dim == 3) ? gmax[2] + 1 : 1;
+	int i,j,k;
+
+#pragma omp parallel for private(i,j)
+	for (k = 0; k < nk; ++k)
+	for (j = 0; j <= gmax[1]; ++j)
+	for (i = 0; i <= gmax[0]; ++i)
+	{
+	    int ic[MAXD],lo[MAXD],hi[MAXD],ib[MAXD];
+	    int n,l;
+	    double p[MAXD],d2;
+	    boolean near_front = NO;
+
+	    ic[0] = i;	ic[1] = j;	ic[2] = k;
+	    n = d_index(ic,gmax,dim);
+	    dist[n] = cap;
+	    fixed[n] = NO;
+	    for (l = 0; l < dim; ++l)
+	    {
+		p[l] = top_grid->L[l] + ic[l]*top_grid->h[l];
+		lo[l] = max(ic[l] - 1,0);
+		hi[l] = min(ic[l],gmax[l] - 1);
+	    }
+	    if (dim == 2)
+	    {
+		for (ib[1] = lo[1]; ib[1] <= hi[1] && !near_front; ++ib[1])
+		for (ib[0] = lo[0]; ib[0] <= hi[0]; ++ib[0])
+		    if (T->num_of_bonds[ib[1]][ib[0]] != 0)
+			near_front = YES;
+	    }
+	    else
+	    {
+		for (ib[2] = lo[2]; ib[2] <= hi[2] && !near_front; ++ib[2])
+		for (ib[1] = lo[1]; ib[1] <= hi[1] && !near_front; ++ib[1])
+		for (ib[0] = lo[0]; ib[0] <= hi[0]; ++ib[0])
+		    if (Num_tris_in_block3d(T,ib[0],ib[1],ib[2]) != 0)
+			near_front = YES;
+	    }
+	    if (!near_front)
+		continue;
+
+	    for (l = 0; l < dim; ++l)
+	    {
+		lo[l] = max(ic[l] - 2,0);
+		hi[l] = min(ic[l] + 1,gmax[l] - 1);
+	    }
+	    d2 = HUGE_VAL;
+	    if (dim == 2)
+	    {
+		for (ib[1] = lo[1]; ib[1] <= hi[1]; ++ib[1])
+		for (ib[0] = lo[0]; ib[0] <= hi[0]; ++ib[0])
+		{
+		    BOND **b = T->bonds[ib[1]][ib[0]];
+		    CURVE **c = T->curves[ib[1]][ib[0]];
+		    int m,nb = T->num_of_bonds[ib[1]][ib[0]];
+		    for (m = 0; m < nb; ++m)
+		    {
+			if (is_bdry(c[m])) continue;
+			d2 = min(d2,sqr_dist_to_bond(p,b[m]));
+		    }
+		}
+	    }
+	    else
+	    {
+		for (ib[2] = lo[2]; ib[2] <= hi[2]; ++ib[2])
+		for (ib[1] = lo[1]; ib[1] <= hi[1]; ++ib[1])
+		for (ib[0] = lo[0]; ib[0] <= hi[0]; ++ib[0])
+		{
+		    TRI **t = Tris_in_block3d(T,ib[0],ib[1],ib[2]);
+		    SURFACE **s = Surfs_in_block3d(T,ib[0],ib[1],ib[2]);
+		    int m,nt = Num_tris_in_block3d(T,ib[0],ib[1],ib[2]);
+		    for (m = 0; m < nt; ++m)
+		    {
+			if (is_bdry(s[m])) continue;
+			d2 = min(d2,sqr_dist_to_tri(p,t[m]));
+		    }
+		}
+	    }
+	    if (d2 == HUGE_VAL)		/* boundary hypersurfaces only */
+		continue;
+	    dist[n] = min(sqrt(d2),cap);
+	    fixed[n] = YES;
+	}
+}	/* end init_signed_distance */
+
+/*
+*	One round of the 2^dim sweeps, returns the largest change.  The
+*	nodes with the same sum of sweep ordered indices only depend on
+*	nodes of the previous sum, and are updated in parallel.
+*/
+
+LOCAL double sweep_signed_distance(
+	RECT_GRID *top_grid,
+	double *dist,
+	char *fixed)
+{
+	int *gmax = top_grid->gmax;
+	int dim = top_grid->dim;
+	int n[MAXD],stride[MAXD];
+	int sweep,level,nlevel,l;
+	double change = 0.0;
+
+	for (l = 0; l < MAXD; ++l)
+	    n[l] = (l < dim) ? gmax[l] + 1 : 1;
+	stride[0] = 1;
+	stride[1] = n[0];
+	stride[2] = n[0]*n[1];
+	nlevel = n[0] + n[1] + n[2] - 2;
+
+	for (sweep = 0; sweep < (1 << dim); ++sweep)
+	for (level = 0; level < nlevel; ++level)
+	{
+	    int i,imin,imax;
+
+	    imin = max(0,level - (n[1] - 1) - (n[2] - 1));
+	    imax = min(n[0] - 1,level);
+#pragma omp parallel for reduction(max:change)
+	    for (i = imin; i <= imax; ++i)
+	    {
+		int j,jmin,jmax,ic[MAXD],io,ie,l,k;
+		double a[MAXD],u,du;
+
+		jmin = max(0,level - i - (n[2] - 1));
+		jmax = min(n[1] - 1,level - i);
+		for (j = jmin; j <= jmax; ++j)
+		{
+		    ic[0] = i;
+		    ic[1] = j;
+		    ic[2] = level - i - j;
+		    io = 0;
+		    for (l = 0; l < dim; ++l)
+		    {
+			k = (sweep & (1 << l)) ? n[l] - 1 - ic[l] : ic[l];
+			io += k*stride[l];
+			ic[l] = k;
+		    }
+		    if (fixed[io])
+			continue;
+		    for (l = 0; l < dim; ++l)
+		    {
+			a[l] = HUGE_VAL;
+			if (ic[l] > 0)
+			    a[l] = dist[io-stride[l]];
+			if (ic[l] < n[l] - 1)
+			{
+			    ie = io + stride[l];
+			    a[l] = min(a[l],dist[ie]);
+			}
+		    }
+		    u = eikonal_update(a,top_grid->h,dim);
+		    if (u < dist[io])
+		    {
+			du = min(dist[io] - u,HUGE);
+			dist[io] = u;
+			if (du > change)
+			    change = du;
+		    }
+		}
+	    }
+	}
+	return change;
+}	/* end sweep_signed_distance */
+
+/*
+*	Godunov upwind solution u of |grad u| = 1 from the smaller
+*	neighbor values a[l] in each direction with spacings h[l].
+*/
+
+LOCAL double eikonal_update(
+	double *a,
+	double *h,
+	int dim)
+{
+	double as[MAXD],hs[MAXD],tmp;
+	double A,B,C,u;
+	int l,m;
+
+	for (l = 0; l < dim; ++l)
+	{
+	    as[l] = a[l];
+	    hs[l] = h[l];
+	}
+	for (l = 1; l < dim; ++l)
+	for (m = l; m > 0 && as[m] < as[m-1]; --m)
+	{
+	    tmp = as[m];	as[m] = as[m-1];	as[m-1] = tmp;
+	    tmp = hs[m];	hs[m] = hs[m-1];	hs[m-1] = tmp;
+	}
+	if (as[0] == HUGE_VAL)
+	    return HUGE_VAL;
+
+	u = as[0] + hs[0];
+	A = B = C = 0.0;
+	for (l = 0; l < dim; ++l)
+	{
+	    if (l > 0 && u <= as[l])
+		break;
+	    A += 1.0/sqr(hs[l]);
+	    B += as[l]/sqr(hs[l]);
+	    C += sqr(as[l]/hs[l]);
+	    if (l > 0)
+		u = (B + sqrt(max(B*B - A*(C - 1.0),0.0)))/A;
+	}
+	return u;
+}	/* end eikonal_update */
+
+LOCAL double sqr_dist_to_bond(
+	double *p,
+	BOND *b)
+{
+	double *p0 = Coords(b->start);
+	double *p1 = Coords(b->end);
+	double d[2],w[2],len2,s;
+
+	d[0] = p1[0] - p0[0];	d[1] = p1[1] - p0[1];
+	w[0] = p[0] - p0[0];	w[1] = p[1] - p0[1];
+	len2 = d[0]*d[0] + d[1]*d[1];
+	s = (len2 > 0.0) ? (w[0]*d[0] + w[1]*d[1])/len2 : 0.0;
+	s = min(max(s,0.0),1.0);
+	return sqr(w[0] - s*d[0]) + sqr(w[1] - s*d[1]);
+}	/* end sqr_dist_to_bond */
+
+/*
+*	Square distance from p to the closest point of tri, by the Voronoi
+*	regions of its vertices, edges and face.
+*/
+
+LOCAL double sqr_dist_to_tri(
+	double *p,
+	TRI *tri)
+{
+	double *a = Coords(Point_of_tri(tri)[0]);
+	double *b = Coords(Point_of_tri(tri)[1]);
+	double *c = Coords(Point_of_tri(tri)[2]);
+	double ab[3],ac[3],ap[3],bp[3],cp[3],q[3];
+	double d1,d2,d3,d4,d5,d6,va,vb,vc,v,w,den;
+	int l;
+
+	for (l = 0; l < 3; ++l)
+	{
+	    ab[l] = b[l] - a[l];
+	    ac[l] = c[l] - a[l];
+	    ap[l] = p[l] - a[l];
+	    bp[l] = p[l] - b[l];
+	    cp[l] = p[l] - c[l];
+	}
+	d1 = Dot3d(ab,ap);	d2 = Dot3d(ac,ap);
+	d3 = Dot3d(ab,bp);	d4 = Dot3d(ac,bp);
+	d5 = Dot3d(ab,cp);	d6 = Dot3d(ac,cp);
+	vc = d1*d4 - d3*d2;
+	vb = d5*d2 - d1*d6;
+	va = d3*d6 - d5*d4;
+
+	if (d1 <= 0.0 && d2 <= 0.0)		/* vertex a */
+	    return Dot3d(ap,ap);
+	if (d3 >= 0.0 && d4 <= d3)		/* vertex b */
+	    return Dot3d(bp,bp);
+	if (d6 >= 0.0 && d5 <= d6)		/* vertex c */
+	    return Dot3d(cp,cp);
+	if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)	/* edge ab */
+	{
+	    v = d1/(d1 - d3);
+	    for (l = 0; l < 3; ++l) q[l] = ap[l] - v*ab[l];
+	    return Dot3d(q,q);
+	}
+	if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)	/* edge ac */
+	{
+	    w = d2/(d2 - d6);
+	    for (l = 0; l < 3; ++l) q[l] = ap[l] - w*ac[l];
+	    return Dot3d(q,q);
+	}
+	if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)	/* edge bc */
+	{
+	    w = (d4 - d3)/((d4 - d3) + (d5 - d6));
+	    for (l = 0; l < 3; ++l) q[l] = bp[l] - w*(c[l] - b[l]);
+	    return Dot3d(q,q);
+	}
+	den = 1.0/(va + vb + vc);		/* face */
+	v = vb*den;
+	w = vc*den;
+	for (l = 0; l < 3; ++l) q[l] = ap[l] - v*ab[l] - w*ac[l];
+	return Dot3d(q,q);
+}	/* end sqr_dist_to_tri */
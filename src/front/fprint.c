@@ -1161,12 +1161,23 @@ EXPORT void print_front_output(
 	if (numnodes > 1)
 	    sprintf(intfc_name,"%s-nd%s",intfc_name,right_flush(pp_mynode(),4));
 
-	out_file = fopen(intfc_name,"w");
+	/* A compressed file is printed to a scratch stream first */
+	out_file = (is_compressed_output()) ? tmpfile() : fopen(intfc_name,"w");
 	print_title(out_file,"");
 	fprint_front_time_stamp(out_file,front);
 	fprintf(out_file,"\n#");
 	fprint_interface(out_file,front->interf);
-	fclose(out_file);
+	if (is_compressed_output())
+	    fcompress_and_close(out_file,intfc_name);
+	else
+	    fclose(out_file);
+	if (numnodes > 1 && pp_mynode() == 0 && !uniform_front_partition(front))
+	{
+	    /* Needed to restart after load balancing */
+	    sprintf(intfc_name,"%s/intfc-ts%s-partition",out_name,
+			right_flush(step,7));
+	    print_front_partition(front,intfc_name);
+	}
 	if (front->rect_grid->dim == 2 && debugging("component"))
 	{
 	    sprintf(comp_name,"%s/comp.ts%s",out_name,right_flush(step,7));
@@ -37,6 +37,8 @@ LOCAL 	void 	f_second_order_intfc_propagate3d(Front*,POINTER,INTERFACE*,
 				INTERFACE*,double);
 LOCAL	void 	set_propagation_bounds(Front*,double*,double*);
 LOCAL	boolean	out_of_bound(POINT*,double*,double*,int);
+LOCAL	void	propagate_curve_point_pairs(Front*,POINTER,CURVE*,CURVE*,
+					double,double*,double*);
 
 /*
 *			f_tan_curve_propagate():
@@ -316,6 +318,11 @@ EXPORT void f_curve_propagate2d(
 	    return;
 
 	set_propagation_bounds(fr,L,U);
+	if (fr->parallel_point_propagate == YES || fr->batch_vfunc != NULL)
+	{
+	    propagate_curve_point_pairs(fr,wave,oldc,newc,dt,L,U);
+	    oldb = NULL;
+	}
 	while (oldb) 
 	{
 	    if ((oldb != oldc->last) && (!n_pt_propagated(newb->end)))
@@ -365,6 +372,93 @@ EXPORT void f_curve_propagate2d(
 	debug_print("f_curve_propagate","Leaving f_curve_propagate2d\n");
 }		/*end f_curve_propagate2d*/
 
+/*
+*			propagate_curve_point_pairs():
+*
+*	Threaded and batched version of the point loop in
+*	f_curve_propagate2d(). The bonds whose end points need propagation
+*	are collected first, the points are then propagated through
+*	batch_point_propagate() or concurrently by point_propagate(), and
+*	the bonds are updated afterwards, once both of their end points
+*	have moved. Threading requires reentrant front->vfunc and
+*	front->_point_propagate.
+*/
+
+LOCAL	void	propagate_curve_point_pairs(
+	Front		*fr,
+	POINTER		wave,
+	CURVE		*oldc,
+	CURVE		*newc,
+	double		dt,
+	double		*L,
+	double		*U)
+{
+	BOND		*oldb,*newb;
+	POINT		**oldpts,**newpts;
+	HYPER_SURF_ELEMENT **oldhses;
+	HYPER_SURF	**oldhss;
+	int		i,n,num_bonds,dim = fr->interf->dim;	
+
+	num_bonds = 0;
+	for (oldb = oldc->first; oldb != NULL; oldb = oldb->next)
+	    ++num_bonds;
+	uni_array(&oldpts,num_bonds,sizeof(POINT*));
+	uni_array(&newpts,num_bonds,sizeof(POINT*));
+	uni_array(&oldhses,num_bonds,sizeof(HYPER_SURF_ELEMENT*));
+	uni_array(&oldhss,num_bonds,sizeof(HYPER_SURF*));
+	n = 0;
+	for (oldb = oldc->first, newb = newc->first; oldb != oldc->last;
+	     oldb = oldb->next, newb = newb->next)
+	{
+	    if (n_pt_propagated(newb->end))
+		continue;
+	    n_pt_propagated(newb->end) = YES;
+	    if (out_of_bound(oldb->end,L,U,dim) &&
+		wave_type(oldc) != MOVABLE_BODY_BOUNDARY &&
+		wave_type(oldc) != ICE_PARTICLE_BOUNDARY) 
+	    {
+		Locstate newsl,newsr;
+		Locstate oldsl,oldsr;
+		slsr(newb->end,Hyper_surf_element(newb),Hyper_surf(newc),
+				&newsl,&newsr);
+		slsr(oldb->end,Hyper_surf_element(oldb),Hyper_surf(oldc),
+				&oldsl,&oldsr);
+		ft_assign(newsl,oldsl,fr->sizest);                 
+		ft_assign(newsr,oldsr,fr->sizest);
+		continue;
+	    }
+	    oldpts[n] = oldb->end;
+	    newpts[n] = newb->end;
+	    oldhses[n] = Hyper_surf_element(oldb->next);
+	    oldhss[n] = Hyper_surf(oldc);
+	    ++n;
+	}
+
+	if (!batch_point_propagate(fr,n,oldpts,newpts,oldhses,oldhss,dt))
+	{
+#pragma omp parallel for schedule(dynamic,256) \
+		if (fr->parallel_point_propagate == YES)
+	    for (i = 0; i < n; ++i)
+	    {
+	    	double Vp[MAXD];
+	    	point_propagate(fr,wave,oldpts[i],newpts[i],oldhses[i],
+				oldhss[i],dt,Vp);
+	    }
+	}
+
+	for (oldb = oldc->first, newb = newc->first; oldb != NULL;
+	     oldb = oldb->next, newb = newb->next)
+	{
+	    if (fr->bond_propagate != NULL)
+	    	(*fr->bond_propagate)(fr,wave,oldb,newb,oldc,dt);
+	    else
+	    	set_bond_length(newb,dim); /* Update new bond length */
+	    if (oldb == oldc->last)
+		break;
+	}
+	free_these(4,oldpts,newpts,oldhses,oldhss);
+}		/*end propagate_curve_point_pairs*/
+
 EXPORT	void	set_no_tan_propagate(
 	CURVE	*c)
 {
@@ -1183,6 +1183,195 @@ EXPORT  void first_order_point_propagate(
 	set_max_front_speed(dim,s,NULL,Coords(newp),front);
 }       /* first_order_point_propagate */
 
+#define		BATCH_VELO_CHUNK	512
+
+/*
+*			batch_point_propagate():
+*
+*	Propagates n points through the batched velocity function
+*	front->batch_vfunc, using the same Runge-Kutta scheme as the
+*	scalar point propagator installed in front->_point_propagate.
+*	Normals and curvatures, when requested through batch_vfunc_needs,
+*	are evaluated at the old points. The new points must be distinct,
+*	as the chunks write them concurrently. Returns NO if the front has
+*	no batched velocity or uses its own point propagator, in which case
+*	the caller must fall back to point_propagate().
+*/
+
+EXPORT	boolean	batch_point_propagate(
+	Front			*front,
+	int			n,
+	POINT			**oldpts,
+	POINT			**newpts,
+	HYPER_SURF_ELEMENT	**oldhses,
+	HYPER_SURF		**oldhss,
+	double			dt)
+{
+	double	**x0,**nor,*kappa;
+	int	i,k,order,dim = front->rect_grid->dim;
+	int	needs = front->batch_vfunc_needs;
+	int	nchunks;
+	double	*L = front->rect_grid->L;
+	double	*U = front->rect_grid->U;
+	double	*h = front->rect_grid->h;
+
+	if (front->batch_vfunc == NULL)
+	    return NO;
+	if (front->_point_propagate == first_order_point_propagate)
+	    order = 1;
+	else if (front->_point_propagate == second_order_point_propagate)
+	    order = 2;
+	else if (front->_point_propagate == fourth_order_point_propagate)
+	    order = 4;
+	else
+	    return NO;
+	if (n == 0)
+	    return YES;
+
+	bi_array(&x0,dim,n,FLOAT);
+	nor = NULL;
+	kappa = NULL;
+	if (needs & VELO_NEED_NORMAL)
+	    bi_array(&nor,dim,n,FLOAT);
+	if (needs & VELO_NEED_CURVATURE)
+	    uni_array(&kappa,n,FLOAT);
+
+	/* Gather, geometry is evaluated serially on the old interface */
+	for (k = 0; k < n; ++k)
+	{
+	    for (i = 0; i < dim; ++i)
+		x0[i][k] = Coords(oldpts[k])[i];
+	    if (nor != NULL)
+	    {
+		double nk[MAXD];
+		normal(oldpts[k],oldhses[k],oldhss[k],nk,front);
+		for (i = 0; i < dim; ++i)
+		    nor[i][k] = nk[i];
+	    }
+	    if (kappa != NULL)
+		kappa[k] = mean_curvature_at_point(oldpts[k],oldhses[k],
+					oldhss[k],front);
+	}
+
+	nchunks = (n + BATCH_VELO_CHUNK - 1)/BATCH_VELO_CHUNK;
+#pragma omp parallel for schedule(dynamic,1) \
+		if (front->parallel_point_propagate == YES && nchunks > 1)
+	for (k = 0; k < nchunks; ++k)
+	{
+	    double x[MAXD][BATCH_VELO_CHUNK];
+	    double kv[MAXD][BATCH_VELO_CHUNK];
+	    double V[MAXD][BATCH_VELO_CHUNK];
+	    double *px0[MAXD],*px[MAXD],*pk[MAXD],*pnor[MAXD];
+	    double smax[MAXD+1],*cmax[MAXD+1];
+	    int	   j,l,m = min(BATCH_VELO_CHUNK,n - k*BATCH_VELO_CHUNK);
+	    int    start = k*BATCH_VELO_CHUNK;
+
+	    for (i = 0; i < dim; ++i)
+	    {
+		px0[i] = x0[i] + start;
+		px[i] = x[i];
+		pk[i] = kv[i];
+		pnor[i] = (nor != NULL) ? nor[i] + start : NULL;
+	    }
+
+	    /* Stage 1 */
+	    (*front->batch_vfunc)(front->vparams,front,m,px0,
+				(nor != NULL) ? pnor : NULL,
+				(kappa != NULL) ? kappa + start : NULL,pk);
+	    for (i = 0; i < dim; ++i)
+	    for (l = 0; l < m; ++l)
+		V[i][l] = kv[i][l];
+	    if (order == 2)
+	    {
+		for (i = 0; i < dim; ++i)
+		for (l = 0; l < m; ++l)
+		    x[i][l] = px0[i][l] + dt*kv[i][l];
+	        (*front->batch_vfunc)(front->vparams,front,m,px,
+				(nor != NULL) ? pnor : NULL,
+				(kappa != NULL) ? kappa + start : NULL,pk);
+		for (i = 0; i < dim; ++i)
+		for (l = 0; l < m; ++l)
+		    V[i][l] = 0.5*(V[i][l] + kv[i][l]);
+	    }
+	    else if (order == 4)
+	    {
+		static const double a[3] = {0.5,0.5,1.0};
+		static const double b[3] = {2.0,2.0,1.0};
+		for (j = 0; j < 3; ++j)
+		{
+		    for (i = 0; i < dim; ++i)
+		    for (l = 0; l < m; ++l)
+		    	x[i][l] = px0[i][l] + a[j]*dt*kv[i][l];
+	            (*front->batch_vfunc)(front->vparams,front,m,px,
+				(nor != NULL) ? pnor : NULL,
+				(kappa != NULL) ? kappa + start : NULL,pk);
+		    for (i = 0; i < dim; ++i)
+		    for (l = 0; l < m; ++l)
+		    	V[i][l] += b[j]*kv[i][l];
+		}
+		for (i = 0; i < dim; ++i)
+		for (l = 0; l < m; ++l)
+		    V[i][l] /= 6.0;
+	    }
+
+	    /* Scatter and collect the maximum front speeds of the chunk */
+	    for (i = 0; i <= dim; ++i)
+	    {
+		smax[i] = -HUGE;
+		cmax[i] = NULL;
+	    }
+	    for (l = 0; l < m; ++l)
+	    {
+		POINT *newp = newpts[start+l];
+		double s;
+		boolean inside;
+
+		if (wave_type(oldhss[start+l]) < MOVABLE_BODY_BOUNDARY)
+		{
+		    for (i = 0; i < dim; ++i)
+			Coords(newp)[i] = px0[i][l];
+		    continue;
+		}
+		inside = YES;
+		for (i = 0; i < dim; ++i)
+		{
+		    Coords(newp)[i] = px0[i][l] + dt*V[i][l];
+		    if (Coords(newp)[i] < L[i] - h[i] ||
+			Coords(newp)[i] > U[i] + h[i])
+			inside = NO;
+		}
+		if (!inside)	/* ignored by set_max_front_speed() */
+		    continue;
+		s = 0.0;
+		for (i = 0; i < dim; ++i)
+		{
+		    s += sqr(V[i][l]);
+		    if (fabs(V[i][l]) > smax[i])
+		    {
+			smax[i] = fabs(V[i][l]);
+			cmax[i] = Coords(newp);
+		    }
+		}
+		s = sqrt(s);
+		if (s > smax[dim])
+		{
+		    smax[dim] = s;
+		    cmax[dim] = Coords(newp);
+		}
+	    }
+	    for (i = 0; i <= dim; ++i)
+	    {
+		if (cmax[i] != NULL)
+		    set_max_front_speed(i,smax[i],NULL,cmax[i],front);
+	    }
+	}
+
+	free(x0);
+	if (nor != NULL) free(nor);
+	if (kappa != NULL) free(kappa);
+	return YES;
+}	/* end batch_point_propagate */
+
 /******************prop along wall for 3d***********************/
 #define  MAX_TRIS   50
 #define  MAX_TAN_TRIS  50
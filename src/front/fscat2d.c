@@ -625,6 +625,73 @@ EXPORT	void	clip_to_interior_region(
 }		/*end clip_to_interior_region*/
 
 
+/*
+*			assemble_intfc_pieces2d():
+*
+*	Joins the interfaces of a box of n[0] x n[1] adjacent subdomains,
+*	ordered x fastest, into one interface.  Used to restart on a
+*	different partition.  The pieces are clipped to their interior
+*	region on the sides shared with another piece of the box and the
+*	cut nodes are merged as in perform_interface_communication().
+*	The pieces are consumed, the first one is returned on the union of
+*	the grids of all pieces.
+*/
+
+EXPORT	INTERFACE *assemble_intfc_pieces2d(
+	Front		*fr,
+	INTERFACE	**pieces,
+	int		*n)
+{
+	INTERFACE	*intfc = pieces[0];
+	INTERFACE	*sav_fr_intfc = fr->interf;
+	RECT_GRID	*gr = computational_grid(intfc);
+	RECT_GRID	*pgr;
+	boolean		status = FUNCTION_SUCCEEDED;
+	int		lbuf[MAXD],ubuf[MAXD],ip[MAXD];
+	int		i,dir,num_pieces = n[0]*n[1];
+
+	DEBUG_ENTER(assemble_intfc_pieces2d)
+	for (i = 0; i < num_pieces; ++i)
+	{
+	    ip[0] = i%n[0];
+	    ip[1] = i/n[0];
+	    pgr = computational_grid(pieces[i]);
+	    set_current_interface(pieces[i]);
+	    delete_subdomain_curves(pieces[i]);
+	    delete_passive_boundaries(pieces[i]);
+	    for (dir = 0; dir < 2; ++dir)
+	    {
+		lbuf[dir] = (ip[dir] > 0) ? pgr->lbuf[dir] : 0;
+		ubuf[dir] = (ip[dir] < n[dir]-1) ? pgr->ubuf[dir] : 0;
+	    }
+	    clip_to_interior_region(pieces[i],lbuf,ubuf);
+	}
+	set_current_interface(intfc);
+	for (i = 1; i < num_pieces; ++i)
+	{
+	    copy_interface_into(pieces[i],intfc);
+	    merge_rect_grids(gr,gr,computational_grid(pieces[i]));
+	    (void) delete_interface(pieces[i]);
+	}
+	fr->interf = intfc;
+	for (dir = 0; dir < 2; ++dir)
+	{
+	    if (n[dir] > 1 && !merge_interface(fr,dir))
+		status = FUNCTION_FAILED;
+	}
+	fr->interf = sav_fr_intfc;
+	if (!status)
+	{
+	    screen("ERROR in assemble_intfc_pieces2d(), "
+		   "merge_interface() failed\n");
+	    clean_up(ERROR);
+	}
+	DEBUG_INTERFACE("Interface after assemble_intfc_pieces2d()",intfc);
+	DEBUG_LEAVE(assemble_intfc_pieces2d)
+	return intfc;
+}		/*end assemble_intfc_pieces2d*/
+
+
 /*
 *			delete_subdomain_curves():
 *
@@ -706,7 +773,7 @@ LOCAL INTERFACE *set_send_intfc(
 	sav_copy = copy_intfc_states();
 	set_size_of_intfc_state(size_of_state(intfc));
 	set_copy_intfc_states(YES);
-	tmp_intfc = copy_interface(intfc);
+	tmp_intfc = copy_interface_sharing_states(intfc);
 	if (tmp_intfc == NULL)
 	{
 	    screen("ERROR in set_send_intfc(), copy_interface() failed\n");
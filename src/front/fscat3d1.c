@@ -3700,7 +3700,9 @@ EXPORT	INTERFACE  *cut_buf_interface1(
 	sav_intfc = current_interface();
 
 	set_size_of_intfc_state(size_of_state(intfc));
-	tmp_intfc = copy_interface(intfc);
+	/* A cut copy sent to another process is copied again */
+	tmp_intfc = (me[dir] == him[dir]) ? copy_interface(intfc) :
+				copy_interface_sharing_states(intfc);
 	set_dual_grid(&dual_gr,gr);
 
 	if (nb == 0)
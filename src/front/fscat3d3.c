@@ -1123,8 +1123,73 @@ EXPORT INTERFACE *collect_hyper_surface(
 	}
 }	/* end collect_hyper_surface */
 
+/*
+*	Joins the interfaces of a box of n[0] x n[1] x n[2] adjacent
+*	subdomains, ordered x fastest, the same way collect_hyper_surface()
+*	patches the pieces of all processors.  Used to restart on a
+*	different partition.  The pieces are consumed.
+*/
+
+EXPORT INTERFACE *assemble_intfc_pieces3d(
+	INTERFACE	**pieces,
+	int		*n)
+{
+	INTERFACE	*adj_intfc;
+	RECT_GRID	*gr;
+	boolean		sav_copy = copy_intfc_states();
+	boolean		status = FUNCTION_SUCCEEDED;
+	int		i,j,dir,stride,num_pieces = n[0]*n[1]*n[2];
+
+	set_copy_intfc_states(YES);
+	for (i = 0; i < num_pieces; ++i)
+	{
+	    adj_intfc = cut_intfc_to_wave_type(pieces[i],ANY_WAVE_TYPE);
+	    if (adj_intfc == NULL)
+	    {
+		screen("ERROR in assemble_intfc_pieces3d(), "
+		       "can't cut piece %d\n",i);
+		clean_up(ERROR);
+	    }
+	    /* The cut owns its point states, so the piece can go */
+	    delete_interface(pieces[i]);
+	    pieces[i] = adj_intfc;
+	}
+
+	/* Patch in x-direction, then the rows in y and the planes in z */
+	for (dir = 0, stride = 1; dir < 3; stride *= n[dir], ++dir)
+	{
+	    for (i = 0; i < num_pieces; i += stride*n[dir])
+	    {
+		gr = computational_grid(pieces[i]);
+		for (j = 1; j < n[dir]; ++j)
+		{
+		    adj_intfc = pieces[i + j*stride];
+		    status = buffer_extension3d3(pieces[i],adj_intfc,
+					dir,1,status);
+		    merge_rect_grids(gr,gr,computational_grid(adj_intfc));
+		    delete_interface(adj_intfc);
+		}
+	    }
+	}
+	set_copy_intfc_states(sav_copy);
+	set_current_interface(pieces[0]);
+	if (!status)
+	{
+	    screen("ERROR in assemble_intfc_pieces3d(), "
+		   "buffer_extension3d3() failed\n");
+	    clean_up(ERROR);
+	}
+	return pieces[0];
+}	/* end assemble_intfc_pieces3d */
+
 #define		MAX_DELETE	20
 
+/*
+*	Returns a copy of intfc with the surfaces of wave type w_type and
+*	the null sides at the subdomain boundary opened.  The copy has its
+*	own point states, so it may outlive intfc and be sent.
+*/
+
 LOCAL INTERFACE *cut_intfc_to_wave_type(
 	INTERFACE *intfc,
 	int w_type)
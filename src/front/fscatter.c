@@ -50,6 +50,10 @@ LOCAL 	int 	set_recv_comp_buffer_limits(int,int*,int*,int,int,int*,
 LOCAL 	void  	bundle_struct_buffer(int,int*,int*,int*,POINTER,byte*,int);
 LOCAL 	void  	unbundle_struct_buffer(int,int*,int*,int*,POINTER,byte*,int);
 LOCAL   void    reflect_struct_buffer(int,int,int,int*,int*,int*,POINTER,int);
+LOCAL	void	bisect_cost_profile(double*,int,int,int,int,int*);
+LOCAL	void	set_subdomain_grids(Front*,double*,double*,int*);
+LOCAL	int	subdomain_intfc_elements(Front*,double**);
+LOCAL	int	add_intfc_element(Front*,double*,double**);
 
 /*
 *			scatter_front():
@@ -1260,6 +1264,487 @@ EXPORT	boolean cpu_adapt_front(
 	return YES;
 }	/* end cpu_adapt_front */
 
+/*
+*			partition_slice():
+*
+*	Mesh cells [lo,hi) of slice k when G cells are divided among P
+*	subdomains, the same division as set_front_pp_grid().
+*/
+
+EXPORT	void	partition_slice(
+	int	G,
+	int	P,
+	int	k,
+	int	*lo,
+	int	*hi)
+{
+	int	basic_slices = G/P;
+	int	extra_slices = G%P;
+
+	*lo = (k < extra_slices) ? k*(basic_slices + 1) :
+				   k*basic_slices + extra_slices;
+	*hi = (k + 1 < extra_slices) ? (k + 1)*(basic_slices + 1) :
+				       (k + 1)*basic_slices + extra_slices;
+}	/* end partition_slice */
+
+/*
+*			uniform_front_partition():
+*
+*	Returns YES if the subdomains are still those of set_front_pp_grid(),
+*	NO once the load balancing has moved their boundaries.
+*/
+
+EXPORT	boolean	uniform_front_partition(
+	Front	*front)
+{
+	PP_GRID		*pp_grid = front->pp_grid;
+	RECT_GRID	*gl_gr = &pp_grid->Global_grid;
+	int		i,k,lo,hi;
+
+	for (i = 0; i < gl_gr->dim; ++i)
+	for (k = 1; k < pp_grid->gmax[i]; ++k)
+	{
+	    partition_slice(gl_gr->gmax[i],pp_grid->gmax[i],k,&lo,&hi);
+	    if (irint((pp_grid->dom[i][k] - gl_gr->L[i])/gl_gr->h[i]) != lo)
+		return NO;
+	}
+	return YES;
+}	/* end uniform_front_partition */
+
+/*
+*			print_front_partition():
+*			read_front_partition():
+*
+*	The cell indices of the subdomain boundaries in each direction,
+*	printed with the interface of a load balanced run so that its
+*	restart can find the pieces of the partition.  read_front_partition()
+*	returns NO if there is no such file.
+*/
+
+EXPORT	void	print_front_partition(
+	Front	*front,
+	const char *fname)
+{
+	PP_GRID		*pp_grid = front->pp_grid;
+	RECT_GRID	*gl_gr = &pp_grid->Global_grid;
+	FILE		*file;
+	int		i,k;
+
+	if ((file = fopen(fname,"w")) == NULL)
+	{
+	    screen("ERROR in print_front_partition(), "
+		   "cannot open %s\n",fname);
+	    clean_up(ERROR);
+	}
+	(void) fprintf(file,"Subdomain partition of the computational grid\n");
+	for (i = 0; i < gl_gr->dim; ++i)
+	{
+	    (void) fprintf(file,"Cuts in direction %d: %d subdomains,",i,
+				pp_grid->gmax[i]);
+	    for (k = 0; k <= pp_grid->gmax[i]; ++k)
+		(void) fprintf(file," %d",irint((pp_grid->dom[i][k] -
+				gl_gr->L[i])/gl_gr->h[i]));
+	    (void) fprintf(file,"\n");
+	}
+	(void) fclose(file);
+}	/* end print_front_partition */
+
+EXPORT	boolean	read_front_partition(
+	const char *fname,
+	int	dim,
+	int	*P,
+	int	**cuts)
+{
+	FILE		*file;
+	char		string[100];
+	int		i,k;
+
+	if ((file = fopen(fname,"r")) == NULL)
+	    return NO;
+	for (i = 0; i < dim; ++i)
+	{
+	    (void) sprintf(string,"Cuts in direction %d:",i);
+	    if (!fgetstring(file,string) ||
+		fscanf(file,"%d subdomains,",&P[i]) != 1 || P[i] < 1)
+	    {
+		screen("ERROR in read_front_partition(), "
+		       "no cuts in direction %d in %s\n",i,fname);
+		clean_up(ERROR);
+	    }
+	    uni_array(&cuts[i],P[i] + 1,INT);
+	    for (k = 0; k <= P[i]; ++k)
+	    {
+		if (fscanf(file,"%d",&cuts[i][k]) != 1)
+		{
+		    screen("ERROR in read_front_partition(), "
+			   "cut %d of direction %d missing in %s\n",
+			   k,i,fname);
+		    clean_up(ERROR);
+		}
+	    }
+	}
+	(void) fclose(file);
+	return YES;
+}	/* end read_front_partition */
+
+/*
+*			intfc_element_weight():
+*
+*	Cost of one interface element relative to a mesh cell, from the
+*	time spent on the front and on the field since the last balancing.
+*	The times and counts are summed over all processors.
+*/
+
+EXPORT	double	intfc_element_weight(
+	Front	*front,
+	double	front_time,
+	double	field_time)
+{
+	RECT_GRID	*gr = front->rect_grid;
+	double		sums[4];
+	int		i;
+
+	sums[0] = front_time;
+	sums[1] = field_time;
+	sums[2] = (double)subdomain_intfc_elements(front,NULL);
+	sums[3] = 1.0;
+	for (i = 0; i < gr->dim; ++i)
+	    sums[3] *= gr->gmax[i];
+	pp_global_sum(sums,4L);
+	if (sums[0] <= 0.0 || sums[1] <= 0.0 || sums[2] == 0.0)
+	    return 0.0;
+	return (sums[0]/sums[2])/(sums[1]/sums[3]);
+}	/* end intfc_element_weight */
+
+/*
+*			balance_front_partition():
+*
+*	Load balancing by interface density.  The cost of a subdomain is
+*	its number of mesh cells plus weight times its number of interface
+*	elements.  If the largest cost exceeds tol times the average, the
+*	cost is summed over the slabs of cells normal to each direction and
+*	the slabs are divided by recursive bisection, giving the new cell
+*	indices of the subdomain boundaries in cuts[i][0..P[i]].  The
+*	partition stays a tensor product of slabs, so the neighbors of each
+*	subdomain and the PP_GRID layout are unchanged.  Returns YES if the
+*	boundaries should move, see shift_front_subdomain().
+*/
+
+EXPORT	boolean	balance_front_partition(
+	Front	*front,
+	double	weight,
+	double	tol,
+	int	**cuts)
+{
+	PP_GRID		*pp_grid = front->pp_grid;
+	RECT_GRID	*gr = front->rect_grid;
+	RECT_GRID	*gl_gr = &pp_grid->Global_grid;
+	int		*P = pp_grid->gmax;
+	int		*G = gl_gr->gmax;
+	int		i,k,g,lo,min_cells,dim = gr->dim;
+	int		num_elems;
+	double		*prof[MAXD],*cost;
+	double		cells,my_cost,max_cost,avg_cost;
+	boolean		changed = NO;
+
+	if (pp_numnodes() == 1) return NO;
+
+	for (i = 0; i < dim; ++i)
+	{
+	    uni_array(&prof[i],G[i],FLOAT);
+	    for (g = 0; g < G[i]; ++g)
+		prof[i][g] = 0.0;
+	}
+	num_elems = subdomain_intfc_elements(front,prof);
+
+	cells = 1.0;
+	for (i = 0; i < dim; ++i)
+	    cells *= gr->gmax[i];
+	my_cost = max_cost = avg_cost = cells + weight*num_elems;
+	pp_global_max(&max_cost,1L);
+	pp_global_sum(&avg_cost,1L);
+	avg_cost /= pp_numnodes();
+	if (debugging("load_balance"))
+	{
+	    (void) printf("In balance_front_partition(): weight = %g, "
+			  "%d elements, cost = %g\n",weight,num_elems,my_cost);
+	    (void) printf("max cost = %g, average = %g, imbalance = %g\n",
+			  max_cost,avg_cost,max_cost/avg_cost);
+	}
+	if (max_cost < tol*avg_cost)
+	{
+	    for (i = 0; i < dim; ++i)
+		free(prof[i]);
+	    return NO;
+	}
+
+	for (i = 0; i < dim; ++i)
+	{
+	    /* Cost of the slabs of cells normal to direction i */
+	    lo = irint((gr->L[i] - gl_gr->L[i])/gr->h[i]);
+	    for (g = 0; g < G[i]; ++g)
+		prof[i][g] *= weight;
+	    for (g = lo; g < lo + gr->gmax[i]; ++g)
+		prof[i][g] += cells/gr->gmax[i];
+	    pp_global_sum(prof[i],(long)G[i]);
+
+	    uni_array(&cost,G[i] + 1,FLOAT);
+	    cost[0] = 0.0;
+	    for (g = 0; g < G[i]; ++g)
+		cost[g+1] = cost[g] + prof[i][g];
+
+	    /* A neighbor's buffer zone never reaches past a subdomain */
+	    min_cells = min(2*pp_grid->buf[i],G[i]/P[i]);
+	    if (cuts[i] == NULL)
+		uni_array(&cuts[i],P[i] + 1,INT);
+	    cuts[i][0] = 0;
+	    cuts[i][P[i]] = G[i];
+	    bisect_cost_profile(cost,0,G[i],P[i],min_cells,cuts[i]);
+	    for (k = 1; k < P[i]; ++k)
+	    	if (cuts[i][k] != irint((pp_grid->dom[i][k] - gl_gr->L[i])/
+					gl_gr->h[i]))
+		    changed = YES;
+	    if (debugging("load_balance"))
+	    {
+		(void) printf("New cuts in direction %d:",i);
+		for (k = 0; k <= P[i]; ++k)
+		    (void) printf(" %d",cuts[i][k]);
+		(void) printf("\n");
+	    }
+	    free_these(2,cost,prof[i]);
+	}
+	return changed;
+}	/* end balance_front_partition */
+
+/*
+*			bisect_cost_profile():
+*
+*	Divides the cells [lo,hi) among np subdomains.  The cut between the
+*	first np/2 subdomains and the others leaves them the nearest share
+*	of the cost, each subdomain keeps at least min_cells cells.  cost[g]
+*	is the cost of the cells [0,g).  The interior cuts are returned in
+*	cuts[1..np-1].
+*/
+
+LOCAL	void	bisect_cost_profile(
+	double	*cost,
+	int	lo,
+	int	hi,
+	int	np,
+	int	min_cells,
+	int	*cuts)
+{
+	int	n1 = np/2;
+	int	c,best,cmin,cmax;
+	double	target;
+
+	if (np == 1) return;
+	target = cost[lo] + (cost[hi] - cost[lo])*n1/np;
+	cmin = lo + n1*min_cells;
+	cmax = hi - (np - n1)*min_cells;
+	for (best = c = cmin; c <= cmax; ++c)
+	    if (fabs(cost[c] - target) < fabs(cost[best] - target))
+		best = c;
+	cuts[n1] = best;
+	bisect_cost_profile(cost,lo,best,n1,min_cells,cuts);
+	bisect_cost_profile(cost,best,hi,np - n1,min_cells,cuts + n1);
+}	/* end bisect_cost_profile */
+
+/*
+*			shift_front_subdomain():
+*
+*	Moves the subdomain boundaries toward cuts, found by
+*	balance_front_partition(), by at most the buffer width so that the
+*	new interior is covered by the old interface and its buffer zones.
+*	The interface is then scattered on the new subdomains.  lexpand and
+*	uexpand return the number of cells by which the lower and upper
+*	sides of this subdomain moved outward.  Returns NO once every
+*	boundary has reached its cut, the caller repeats it until then.
+*/
+
+EXPORT	boolean	shift_front_subdomain(
+	Front	*front,
+	int	**cuts,
+	int	*lexpand,
+	int	*uexpand)
+{
+	PP_GRID		*pp_grid = front->pp_grid;
+	RECT_GRID	*gl_gr = &pp_grid->Global_grid;
+	double		*h = gl_gr->h;
+	double		L[MAXD],U[MAXD];
+	int		gmax[MAXD],me[MAXD];
+	int		i,k,cut,shift,dim = gl_gr->dim;
+	boolean		moved = NO;
+
+	find_Cartesian_coordinates(pp_mynode(),pp_grid,me);
+	for (i = 0; i < dim; ++i)
+	{
+	    lexpand[i] = uexpand[i] = 0;
+	    for (k = 1; k < pp_grid->gmax[i]; ++k)
+	    {
+		cut = irint((pp_grid->dom[i][k] - gl_gr->L[i])/h[i]);
+		if (cut == cuts[i][k]) continue;
+		moved = YES;
+		shift = (cuts[i][k] > cut) ? min(cuts[i][k] - cut,
+						 pp_grid->buf[i]) :
+					     -min(cut - cuts[i][k],
+						 pp_grid->buf[i]);
+		if (k == me[i])
+		    lexpand[i] = -shift;
+		if (k == me[i] + 1)
+		    uexpand[i] = shift;
+		pp_grid->dom[i][k] = (cut + shift)*h[i] + gl_gr->L[i];
+	    }
+	    L[i] = pp_grid->dom[i][me[i]];
+	    U[i] = pp_grid->dom[i][me[i] + 1];
+	    gmax[i] = irint((U[i] - L[i])/h[i]);
+	}
+	if (!moved) return NO;
+
+	if (debugging("load_balance"))
+	{
+	    (void) printf("In shift_front_subdomain(): lexpand =");
+	    for (i = 0; i < dim; ++i)
+		(void) printf(" %d",lexpand[i]);
+	    (void) printf(", uexpand =");
+	    for (i = 0; i < dim; ++i)
+		(void) printf(" %d",uexpand[i]);
+	    (void) printf("\n");
+	}
+	set_subdomain_grids(front,L,U,gmax);
+	if (!scatter_front(front))
+	{
+	    screen("ERROR in shift_front_subdomain(), "
+		   "scatter_front() failed\n");
+	    clean_up(ERROR);
+	}
+	return YES;
+}	/* end shift_front_subdomain */
+
+/*
+*			set_subdomain_grids():
+*
+*	Resets the grids of the front to the subdomain [L,U] with the same
+*	buffer zones, as pp_clip_rect_grids() does on the initial partition.
+*/
+
+LOCAL	void	set_subdomain_grids(
+	Front	*front,
+	double	*L,
+	double	*U,
+	int	*gmax)
+{
+	INTERFACE	*intfc = front->interf;
+	RECT_GRID	*zoom_gr = &front->pp_grid->Zoom_grid;
+	RECT_GRID	*t_gr = &topological_grid(intfc);
+	RECT_GRID	*c_gr = computational_grid(intfc);
+	int		i,tgmax[MAXD],dim = zoom_gr->dim;
+
+	set_rect_grid(L,U,zoom_gr->GL,zoom_gr->GU,zoom_gr->lbuf,zoom_gr->ubuf,
+		      gmax,dim,&c_gr->Remap,zoom_gr);
+	copy_rect_grid(c_gr,zoom_gr);
+	copy_rect_grid(front->rect_grid,zoom_gr);
+	if (dim == 3)
+	    set_topological_grid(intfc,c_gr);
+	else
+	{
+	    for (i = 0; i < dim; ++i)
+		tgmax[i] = irint((zoom_gr->VU[i] - zoom_gr->VL[i])/t_gr->h[i]);
+	    set_rect_grid(zoom_gr->VL,zoom_gr->VU,t_gr->GL,t_gr->GU,
+			  NOBUF,NOBUF,tgmax,dim,&t_gr->Remap,t_gr);
+	}
+	intfc->table->new_grid = YES;
+	intfc->modified = YES;
+}	/* end set_subdomain_grids */
+
+/*
+*			subdomain_intfc_elements():
+*
+*	Number of elements of the physical hypersurfaces, points in 1D,
+*	bonds in 2D and triangles in 3D, centered in the interior of the
+*	subdomain.  If prof is not NULL, each element is also added to
+*	prof[i][g], g the global index of its cell in direction i.
+*/
+
+LOCAL	int	subdomain_intfc_elements(
+	Front	*front,
+	double	**prof)
+{
+	INTERFACE	*intfc = front->interf;
+	RECT_GRID	*gr = front->rect_grid;
+	POINT		**p;
+	CURVE		**c;
+	SURFACE		**s;
+	BOND		*b;
+	TRI		*t;
+	double		center[MAXD];
+	int		i,num_elems = 0;
+
+	switch (gr->dim)
+	{
+	case 1:
+	    for (p = intfc->points; p && *p; ++p)
+	    {
+		if (wave_type(*p) < FIRST_PHYSICS_WAVE_TYPE) continue;
+		center[0] = Coords(*p)[0];
+		num_elems += add_intfc_element(front,center,prof);
+	    }
+	    break;
+	case 2:
+	    for (c = intfc->curves; c && *c; ++c)
+	    {
+		if (wave_type(*c) < FIRST_PHYSICS_WAVE_TYPE) continue;
+		for (b = (*c)->first; b != NULL; b = b->next)
+		{
+		    for (i = 0; i < 2; ++i)
+			center[i] = 0.5*(Coords(b->start)[i] +
+					 Coords(b->end)[i]);
+		    num_elems += add_intfc_element(front,center,prof);
+		}
+	    }
+	    break;
+	case 3:
+	    for (s = intfc->surfaces; s && *s; ++s)
+	    {
+		if (wave_type(*s) < FIRST_PHYSICS_WAVE_TYPE) continue;
+		surf_tri_loop(*s,t)
+		{
+		    for (i = 0; i < 3; ++i)
+			center[i] = (Coords(Point_of_tri(t)[0])[i] +
+				     Coords(Point_of_tri(t)[1])[i] +
+				     Coords(Point_of_tri(t)[2])[i])/3.0;
+		    num_elems += add_intfc_element(front,center,prof);
+		}
+	    }
+	    break;
+	}
+	return num_elems;
+}	/* end subdomain_intfc_elements */
+
+LOCAL	int	add_intfc_element(
+	Front	*front,
+	double	*center,
+	double	**prof)
+{
+	RECT_GRID	*gr = front->rect_grid;
+	RECT_GRID	*gl_gr = &front->pp_grid->Global_grid;
+	int		i,g,dim = gr->dim;
+
+	for (i = 0; i < dim; ++i)
+	    if (center[i] < gr->L[i] || center[i] >= gr->U[i])
+		return 0;
+	if (prof != NULL)
+	{
+	    for (i = 0; i < dim; ++i)
+	    {
+		g = (int)floor((center[i] - gl_gr->L[i])/gr->h[i]);
+		g = max(0,min(g,gl_gr->gmax[i] - 1));
+		prof[i][g] += 1.0;
+	    }
+	}
+	return 1;
+}	/* end add_intfc_element */
+
 LOCAL   void reflect_array_buffer(
         int dim,
         int dir,
@@ -642,28 +642,39 @@ EXPORT	void	f_set_max_front_speed(
 	double		*coords,
 	Front		*fr)
 {
-	if (fabs(spd) > Spfr(fr)[i])
+	int	j, dim = fr->rect_grid->dim;
+	double *L,*U,*h;
+
+	if (fabs(spd) <= Spfr(fr)[i])
+	    return;
+
+	L = fr->rect_grid->L;
+	U = fr->rect_grid->U;
+	h = fr->rect_grid->h;
+	if (coords != NULL)
 	{
-	    int	j, dim = fr->rect_grid->dim;
-	    double *L,*U,*h;
-	    L = fr->rect_grid->L;
-	    U = fr->rect_grid->U;
-	    h = fr->rect_grid->h;
+	    for (j = 0; j < dim; ++j)
+	    {
+		if (coords[j] < L[j] - h[j] ||
+		    coords[j] > U[j] + h[j])
+		    return;		/* sufficiently outside domain */
+	    }
+	}
 
-	    if (coords != NULL)
+	/* May be called from threaded point propagation, recheck inside */
+#pragma omp critical (max_front_speed)
+	{
+	    if (fabs(spd) > Spfr(fr)[i])
 	    {
-	    	for (j = 0; j < dim; ++j)
-		{
-		    if (coords[j] < L[j] - h[j] ||
-			coords[j] > U[j] + h[j])
-			return;		/* sufficiently outside domain */
-	    	    MaxFrontSpeedCoords(fr)[i][j] = coords[j];
-		 
-		}
+	    	if (coords != NULL)
+	    	{
+	    	    for (j = 0; j < dim; ++j)
+	    	    	MaxFrontSpeedCoords(fr)[i][j] = coords[j];
+	    	}
+	    	Spfr(fr)[i] = fabs(spd);
+	    	if (state != NULL)
+	    	    ft_assign(MaxFrontSpeedState(fr)[i],state,fr->sizest);
 	    }
-	    Spfr(fr)[i] = fabs(spd);
-	    if (state != NULL)
-	    	ft_assign(MaxFrontSpeedState(fr)[i],state,fr->sizest);
 	}
 }		/*end f_set_max_front_speed*/
 
@@ -752,3 +752,367 @@ EXPORT int double_vortex_vel(
         vel[1] = -s1*dx1/d1 - s2*dx2/d2;
 	vel[1] -= 0.3;
 }       /* end double_vortex_vel */
+
+/*
+*	Batched velocity functions for point propagation
+*
+*	These evaluate the same fields as the functions above for n points
+*	at once. Coordinates, normals and velocities are stored by
+*	component, coords[i][k] is the i-th coordinate of the k-th point,
+*	so that the loops over points are contiguous and vectorizable.
+*/
+
+EXPORT int translation_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	TRANS_PARAMS *trans_params = (TRANS_PARAMS*)params;
+	int i,k;
+
+	for (i = 0; i < trans_params->dim; ++i)
+	{
+	    double v = trans_params->vel[i];
+#pragma omp simd
+	    for (k = 0; k < n; ++k)
+		vel[i][k] = v;
+	}
+	return YES;
+}	/* end translation_vel_batch */
+
+EXPORT int sine_motion_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	SINE_MOTION_PARAMS *sine_params = (SINE_MOTION_PARAMS*)params;
+	int i,k,dim = sine_params->dim;
+	double vmax = sine_params->vmax;
+	double wave_number = 2.0*PI/sine_params->wave_length;
+	double phase = sine_params->phase;
+	double *x = coords[0];
+	double *v = vel[dim-1];
+
+	for (i = 0; i < dim-1; ++i)
+	{
+#pragma omp simd
+	    for (k = 0; k < n; ++k)
+		vel[i][k] = 0.0;
+	}
+#pragma omp simd
+	for (k = 0; k < n; ++k)
+	    v[k] = vmax*sin(wave_number*x[k] - phase);
+	return YES;
+}	/* end sine_motion_vel_batch */
+
+EXPORT int radial_motion_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	RADIAL_MOTION_PARAMS *r_params = (RADIAL_MOTION_PARAMS*)params;
+	double *cen = r_params->cen;
+	double speed = r_params->speed;
+	int i,k,dim = r_params->dim;
+
+	for (k = 0; k < n; ++k)
+	{
+	    double dist = 0.0;
+	    for (i = 0; i < dim; ++i)
+		dist += sqr(coords[i][k]-cen[i]);
+	    dist = speed/sqrt(dist);
+	    for (i = 0; i < dim; ++i)
+		vel[i][k] = (coords[i][k]-cen[i])*dist;
+	}
+	return YES;
+}	/* end radial_motion_vel_batch */
+
+EXPORT int burgers_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	BURGERS_PARAMS *b_params = (BURGERS_PARAMS*)params;
+	int i,k,dim = b_params->dim;
+	double *y = coords[dim-1];
+
+	for (i = 0; i < dim-1; ++i)
+	{
+#pragma omp simd
+	    for (k = 0; k < n; ++k)
+		vel[i][k] = y[k];
+	}
+#pragma omp simd
+	for (k = 0; k < n; ++k)
+	    vel[dim-1][k] = 0.0;
+	return YES;
+}	/* end burgers_vel_batch */
+
+EXPORT int circular_rotation_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	CIRCULAR_ROTATION_PARAMS *c_params = (CIRCULAR_ROTATION_PARAMS*)params;
+	double x0 = c_params->x_0;
+	double y0 = c_params->y_0;
+	double omega_0 = c_params->omega_0;
+	double domega_dr = c_params->grad;
+	double *x = coords[0];
+	double *y = coords[1];
+	int k,dim = front->rect_grid->dim;
+
+	/* Same field as circular_rotation_vel(), the quadrant cases
+	   there reduce to V*(-dy,dx)/rad */
+#pragma omp simd
+	for (k = 0; k < n; ++k)
+	{
+	    double dx = x[k] - x0;
+	    double dy = y[k] - y0;
+	    double rad = sqrt(dx*dx + dy*dy);
+	    double s = (rad == 0.0) ? 0.0 : omega_0 + domega_dr*rad;
+
+	    vel[0][k] = -s*dy;
+	    vel[1][k] =  s*dx;
+	}
+	if (dim == 3)
+	{
+#pragma omp simd
+	    for (k = 0; k < n; ++k)
+		vel[2][k] = 0.0;
+	}
+	return YES;
+}	/* end circular_rotation_vel_batch */
+
+EXPORT int normal_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	NORV_PARAMS *norv_params = (NORV_PARAMS*)params;
+	double coeff = norv_params->coeff;
+	int i,k;
+
+	for (i = 0; i < norv_params->dim; ++i)
+	{
+#pragma omp simd
+	    for (k = 0; k < n; ++k)
+		vel[i][k] = nor[i][k]*coeff;
+	}
+	return YES;
+}	/* end normal_vel_batch */
+
+EXPORT int curvature_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	NORV_PARAMS *norv_params = (NORV_PARAMS*)params;
+	double coeff = norv_params->coeff;
+	double epsilon = norv_params->epsilon;
+	int i,k;
+
+	for (i = 0; i < norv_params->dim; ++i)
+	{
+#pragma omp simd
+	    for (k = 0; k < n; ++k)
+		vel[i][k] = nor[i][k]*(coeff - epsilon*kappa[k]);
+	}
+	return YES;
+}	/* end curvature_vel_batch */
+
+EXPORT int bipolar_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	BIPOLAR_PARAMS *bipolar_params = (BIPOLAR_PARAMS*)params;
+	double *cen1 = bipolar_params->cen1;
+	double *cen2 = bipolar_params->cen2;
+	double rev_time = bipolar_params->reverse_time;
+	double c1 = bipolar_params->i1/2.0/PI;
+	double c2 = bipolar_params->i2/2.0/PI;
+	double *x = coords[0];
+	double *y = coords[1];
+	int k;
+
+	if (rev_time >= 0.0 && front->time > rev_time)
+	{
+	    c1 *= -1;
+	    c2 *= -1;
+	}
+#pragma omp simd
+	for (k = 0; k < n; ++k)
+	{
+	    double dx1 = x[k] - cen1[0];
+	    double dy1 = y[k] - cen1[1];
+	    double dx2 = x[k] - cen2[0];
+	    double dy2 = y[k] - cen2[1];
+	    double s1 = c1/(sqr(dx1) + sqr(dy1));
+	    double s2 = c2/(sqr(dx2) + sqr(dy2));
+
+	    vel[0][k] =  s1*dy1 + s2*dy2;
+	    vel[1][k] = -s1*dx1 - s2*dx2;
+	}
+	return YES;
+}	/* end bipolar_vel_batch */
+
+EXPORT int vortex_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	VORTEX_PARAMS *vortex_params = (VORTEX_PARAMS*)params;
+	int k,dim = vortex_params->dim;
+	char *type = vortex_params->type;
+	double coeff2 = 1.0;
+	double *x = coords[0];
+	double *y = coords[1];
+	double *z = (dim == 3) ? coords[2] : NULL;
+
+	if (vortex_params->time > 0 && front->time >= vortex_params->time)
+	    coeff2 = -1.0;
+	if (vortex_params->cos_time > 0)
+	    coeff2 = cos((front->time*PI)/vortex_params->cos_time);
+
+	if (dim == 2)
+	{
+	    switch(type[0])
+	    {
+	    case 'm':
+	    case 'M':
+#pragma omp simd
+		for (k = 0; k < n; ++k)
+		{
+		    double xtemp = 4*PI*(x[k]+0.5);
+		    double ytemp = 4*PI*(y[k]+0.5);
+		    vel[0][k] = coeff2*sin(xtemp)*sin(ytemp); 
+		    vel[1][k] = coeff2*cos(xtemp)*cos(ytemp); 
+		}
+		break;
+	    case 's':
+	    case 'S':
+#pragma omp simd
+		for (k = 0; k < n; ++k)
+		{
+		    double sx = sin(PI*x[k]);
+		    double sy = sin(PI*y[k]);
+		    vel[0][k] = -coeff2*sx*sx*sin(2*PI*y[k]);
+		    vel[1][k] = coeff2*sin(2*PI*x[k])*sy*sy;
+		}
+		break;
+	    default:
+		screen("Undefined vortex type!\n");
+		clean_up(ERROR);
+	    }
+	}
+	else if (dim == 3)
+	{
+	    switch(type[0])
+	    {
+	    case 'm':
+	    case 'M':
+#pragma omp simd
+		for (k = 0; k < n; ++k)
+		{
+		    double sx = sin(PI*x[k]);
+		    double sy = sin(PI*y[k]);
+		    double sz = sin(PI*z[k]);
+		    double s2x = sin(2*PI*x[k]);
+		    double s2y = sin(2*PI*y[k]);
+		    double s2z = sin(2*PI*z[k]);
+	            vel[0][k] = coeff2*2*sx*sx*s2y*s2z;
+	            vel[1][k] = -coeff2*s2x*sy*sy*s2z;
+	            vel[2][k] = -coeff2*s2x*s2y*sz*sz;
+		}
+		break;
+	    case 's':
+	    case 'S':
+#pragma omp simd
+		for (k = 0; k < n; ++k)
+		{
+		    double sx = sin(PI*x[k]);
+		    double sy = sin(PI*y[k]);
+		    double r = sqrt((x[k]-0.5)*(x[k]-0.5)+(y[k]-0.5)*(y[k]-0.5));
+		    vel[0][k] = coeff2*sx*sx*sin(2*PI*y[k]);
+		    vel[1][k] = -coeff2*sin(2*PI*x[k])*sy*sy;
+		    vel[2][k] = coeff2*sqr(1-2*r);
+		}
+		break;
+	    default:
+	        screen("Undefined time dependency type!\n");
+	        clean_up(ERROR);
+	    }
+	}    
+	return YES;
+}	/* end vortex_vel_batch */
+
+EXPORT int double_vortex_vel_batch(
+	POINTER params,
+	Front *front,
+	int n,
+	double **coords,
+	double **nor,
+	double *kappa,
+	double **vel)
+{
+	BIPOLAR_PARAMS *dv_params = (BIPOLAR_PARAMS*)params;
+	double *cen1 = dv_params->cen1;
+	double *cen2 = dv_params->cen2;
+	double c1 = dv_params->i1/2.0/PI;
+	double c2 = dv_params->i2/2.0/PI;
+	double *x = coords[0];
+	double *y = coords[1];
+	int k;
+
+#pragma omp simd
+	for (k = 0; k < n; ++k)
+	{
+	    double dx1 = x[k] - cen1[0];
+	    double dy1 = y[k] - cen1[1];
+	    double dx2 = x[k] - cen2[0];
+	    double dy2 = y[k] - cen2[1];
+	    double s1 = c1/(sqr(dx1) + sqr(dy1));
+	    double s2 = c2/(sqr(dx2) + sqr(dy2));
+
+	    vel[0][k] =  s1*dy1 + s2*dy2;
+	    vel[1][k] = -s1*dx1 - s2*dx2 - 0.3;
+	}
+	return YES;
+}	/* end double_vortex_vel_batch */
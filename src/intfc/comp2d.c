@@ -42,6 +42,18 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 
 #include <iloc.h>
 
+typedef struct {
+	double		x, y;		/* Position being projected */
+	const COMPONENT	*eq_comps;
+	int		n_eq;
+	USE_BOUNDARIES	bdry;
+	HYPER_SURF	*hs;
+	double		min_distance;	/* Square distance to nearest bond */
+	double		min_norm_dist;	/* Square normal distance to it */
+	double		t_closest;	/* Parametric coord of closest point */
+	SIDE		side;
+} NEAREST_BOND_SEARCH;
+
 	/* LOCAL Function Declarations */
 LOCAL	COMPONENT find_compon2d(int,int,INTERFACE*);
 LOCAL	boolean	blocks_on_bond(BOND*,CURVE*,int**,COMPONENT**,RECT_GRID*);
@@ -54,6 +66,7 @@ LOCAL	boolean	on_front_block2d(int,int,const COMPONENT*,int,INTERFACE*,
 	                         USE_BOUNDARIES,HYPER_SURF*);
 LOCAL	boolean	set_bond_and_curve_list_pointers(struct Table*,int,int);
 LOCAL	double	i_sd2d(double,double,BOND*,POINT**,double*,SIDE*);
+LOCAL	double	nearest_bond_visit(BVH_ELEM*,POINTER);
 LOCAL	SIDE	check_closest_point_is_node(double*,SIDE,HYPER_SURF*,COMPONENT,
 					    COMPONENT,COMPONENT,USE_BOUNDARIES,
 					    INTERFACE*);
@@ -1120,155 +1133,30 @@ LIB_LOCAL boolean long_nearest_interface_point2d(
 	HYPER_SURF_ELEMENT **phse,
 	HYPER_SURF	**phs)
 {
-    	const COMPONENT *eq_comps;
-	int             n_eq;
-	POINT    *p;
-	BOND     *b;
-	CURVE    **c;
+	NEAREST_BOND_SEARCH ns;
 	SIDE	 side;	       /* Side of interface bond -
 				* either NEGATIVE_SIDE(=left)
 				* or POSITIVE_SIDE(=right)
 				*/
-	double    distance;      /* Distance from (x,y) to a Bond */
-	double    min_distance;  /* Distance to Nearest Bond */
-	double    norm_dist;     /* Normal Distance to a Bond */
-	double    min_norm_dist; /* Normal Distance to the Nearest Bond*/
 	double    t_closest;
-	double    x, y;
-	double    dsx, dsy, dex, dey, dbx, dby, ds2, de2;
-	double    l, sx, sy, ex, ey, spe, sps, vp;
 
 	        /* Find Closest Point on Front: */
-	(void) printf("Warning: calling long_nearest_interface_point2d()\n");
+	if (debugging("efficiency"))
+	    (void) printf("#long_nearest_interface_point2d is called\n");
 	p_closest = NULL;       c_closest = NULL;       b_closest = NULL;
-	min_distance = HUGE_VAL;
 	t_last = 0.0;
-	min_norm_dist = HUGE_VAL; /* For lint */
-	b_closest = NULL;
-	x = coords[0];	y = coords[1];
-    	eq_comps = equivalent_components_list(comp,&n_eq,intfc);
-	for (c = intfc->curves; c && *c; ++c)
-	{
-	    if (hs)
-	    {
-	        if (Curve_of_hs(hs) != *c) continue;
-	        /* Note: In this case for statement is redundant
-	        *  but it does provide a check that 
-	        *  curve cc is on interface intfc
-	        */
-	    }
-	    else
-	    {
-		if (!comp_is_on_curve(*c,eq_comps,n_eq))
-	            continue;
-		if (skip_boundary_hs(Hyper_surf(*c),bdry))
-	            continue;
-	    }
-	    ex = Coords((*c)->first->start)[0];
-	    dex = ex - x;
-	    ey = Coords((*c)->first->start)[1];
-	    dey = ey - y;
-	    de2 = dex*dex + dey*dey;
-	    for (b = (*c)->first; b ; b = b->next)
-	    {
-		if ((l = bond_length(b)) == 0)
-		    continue;
-
-		sx = ex;
-		dsx = dex;
-		sy = ey;
-		dsy = dey;
-		ds2 = de2;
-
-	        ex = Coords(b->end)[0];
-		dex = ex - x;
-	        ey = Coords(b->end)[1];
-		dey = ey - y;
-	        de2 = dex*dex + dey*dey;
-
-		dbx = ex - sx;
-		dby = ey - sy;
-
-		sps = dbx*dsx + dby*dsy;
-		spe = dbx*dex + dby*dey;
-
-		if ((ds2 > min_distance) && (de2 > min_distance))
-		{
-		    if ((sps > 0.0) || (0.0 > spe))
-			continue;
-		    vp = dsx*dey-dsy*dex; 
-		    if ((norm_dist = vp*vp/(l*l)) > min_distance)
-			continue;
-	            side = (vp >= 0.0) ? NEGATIVE_SIDE : POSITIVE_SIDE;
-		    p = NULL;
-		    distance = norm_dist;
-		    t_last = -sps/(l*l);
-		}
-		else
-		{     
-		    vp = dsx*dey-dsy*dex; 
-	            side = (vp >= 0.0) ? NEGATIVE_SIDE : POSITIVE_SIDE;
-		    norm_dist = vp*vp/(l*l);
-		    if (sps >= 0.0)
-		    {
-			p = b->start;
-			distance = ds2;
-	                t_last = 0.0;
-		    }
-		    else if (spe <= 0.0)
-		    {
-			p = b->end;
-			distance = de2;
-	                t_last = 1.0;
-		    }
-		    else
-		    {
-		        p = NULL;
-	                distance = norm_dist;
-		        t_last = -sps/(l*l);
-		    }
-		}
-
-	        if ((p != NULL) && (p == p_closest))
-	        {
-	
-	            /*                                                    *
-	            *                                                     *
-	            * Whenever p != NULL coords is beyond the end of      *
-	            * the bond.   Thus this is the case where x,y is      *
-	            * beyond the end of two adjacent bonds, with their    *
-	            * intersection being the closest point to coords.     *
-	            *                                                     *
-	            * The side is in general ambiguous.                   *
-	            *                                                     *
-	            * The correct bond wrt which the side should be com-  *
-	            * puted is that which has the larger normal distance  *
-	            * from coords.                                        *
-	            *                                                     *
-	            * The following code assumes that both bonds belong   *
-	            * to the same curve.                                  *
-	            *                                                     */
-
-	            /* min_nor.. has value when used */
-	            if (norm_dist >= min_norm_dist)
-	            {
-	                t_closest = t_last;
-	                b_closest = b;
-	                c_closest = *c;
-	            }
-	        }
-
-	        else if (distance < min_distance || c_closest == NULL)
-	        {
-	            min_distance = distance;
-	            min_norm_dist = norm_dist;
-	            t_closest = t_last;
-	            p_closest = p;
-	            b_closest = b;
-	            c_closest = *c;
-	        }
-	    }
-	}
+	ns.x = coords[0];	ns.y = coords[1];
+    	ns.eq_comps = equivalent_components_list(comp,&ns.n_eq,intfc);
+	ns.bdry = bdry;
+	ns.hs = hs;
+	ns.min_distance = HUGE_VAL;
+	ns.min_norm_dist = HUGE_VAL; /* For lint */
+	ns.side = UNKNOWN_SIDE;
+	ns.t_closest = 0.0;
+	(void) bvh_nearest_search(interface_bvh(intfc),coords,
+				  nearest_bond_visit,(POINTER)&ns);
+	side = ns.side;
+	t_closest = ns.t_closest;
 
 	if (b_closest == NULL)
 	{
@@ -1310,6 +1198,96 @@ LIB_LOCAL boolean long_nearest_interface_point2d(
 	return YES;
 }	    /*end long_nearest_interface_point2d*/
 
+/*
+*	Visit function of the hierarchy search of
+*	long_nearest_interface_point2d().  Of two adjacent bonds closest
+*	at their common point, the one with the larger normal distance is
+*	kept, which determines the side of coords.
+*/
+
+LOCAL	double	nearest_bond_visit(
+	BVH_ELEM	*e,
+	POINTER		arg)
+{
+	NEAREST_BOND_SEARCH *ns = (NEAREST_BOND_SEARCH*)arg;
+	BOND	*b = Bond_of_hse(e->hse);
+	CURVE	*c = Curve_of_hs(e->hs);
+	POINT	*p;
+	double	distance, norm_dist, tb;
+	double	dsx, dsy, dex, dey, dbx, dby, ds2, de2;
+	double	l, sps, spe, vp;
+
+	if (ns->hs)
+	{
+	    if (Curve_of_hs(ns->hs) != c)
+		return ns->min_distance;
+	}
+	else
+	{
+	    if (!comp_is_on_curve(c,ns->eq_comps,ns->n_eq))
+		return ns->min_distance;
+	    if (skip_boundary_hs(e->hs,ns->bdry))
+		return ns->min_distance;
+	}
+	if ((l = bond_length(b)) == 0)
+	    return ns->min_distance;
+
+	dsx = Coords(b->start)[0] - ns->x;
+	dsy = Coords(b->start)[1] - ns->y;
+	dex = Coords(b->end)[0] - ns->x;
+	dey = Coords(b->end)[1] - ns->y;
+	ds2 = dsx*dsx + dsy*dsy;
+	de2 = dex*dex + dey*dey;
+	dbx = dex - dsx;
+	dby = dey - dsy;
+	sps = dbx*dsx + dby*dsy;
+	spe = dbx*dex + dby*dey;
+
+	vp = dsx*dey-dsy*dex; 
+	ns->side = (vp >= 0.0) ? NEGATIVE_SIDE : POSITIVE_SIDE;
+	norm_dist = vp*vp/(l*l);
+	if (sps >= 0.0)
+	{
+	    p = b->start;
+	    distance = ds2;
+	    tb = 0.0;
+	}
+	else if (spe <= 0.0)
+	{
+	    p = b->end;
+	    distance = de2;
+	    tb = 1.0;
+	}
+	else
+	{
+	    p = NULL;
+	    distance = norm_dist;
+	    tb = -sps/(l*l);
+	}
+
+	if ((p != NULL) && (p == p_closest))
+	{
+	    /* coords is beyond the common end of two adjacent bonds */
+	    if (norm_dist >= ns->min_norm_dist)
+	    {
+	        ns->t_closest = tb;
+	        b_closest = b;
+	        c_closest = c;
+	    }
+	}
+	else if (distance < ns->min_distance || c_closest == NULL)
+	{
+	    ns->min_distance = distance;
+	    ns->min_norm_dist = norm_dist;
+	    ns->t_closest = tb;
+	    p_closest = p;
+	    b_closest = b;
+	    c_closest = c;
+	}
+	t_last = tb;
+	return ns->min_distance;
+}		/*end nearest_bond_visit*/
+
 /*
 *			long_nearest_similar_interface_point2d():
 *
@@ -1791,6 +1769,7 @@ EXPORT boolean make_bond_comp_lists(
 
 	intfc->modified = NO;
 	intfc->table->new_grid = NO;
+	reset_interface_bvh(intfc);
 
 	if (DEBUG) (void) printf("Leaving make_bond_comp_lists()\n\n");
 	return FUNCTION_SUCCEEDED;
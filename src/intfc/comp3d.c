@@ -62,6 +62,15 @@ typedef struct {
 	int	idir;		/* used in directional projection */
 } TRI_PROJECTION;
 
+typedef struct {
+	TRI_PROJECTION	*closest;	/* Closest tri found so far */
+	TRI_PROJECTION	*tri_proj;	/* Projection on the visited tri */
+	const COMPONENT	*eq_comps;
+	int		n_eq;
+	USE_BOUNDARIES	bdry;
+	HYPER_SURF	*hs;
+} NEAREST_TRI_SEARCH;
+
 	/* LOCAL Function Declarations */
 LOCAL	COMPONENT	set_comp_on_block(int*,INTERFACE*);
 LOCAL	COMPONENT	comp_at_closest(TRI_PROJECTION*);
@@ -71,14 +80,18 @@ LOCAL	boolean	comp_is_on_surface(SURFACE*,const COMPONENT*,int);
 LOCAL	boolean	new_tri_is_closer(TRI_PROJECTION*,TRI_PROJECTION*);
 LOCAL	boolean	old_tri_on_vertex(TRI_PROJECTION*,TRI_PROJECTION*);
 LOCAL	boolean	old_tri_on_edge(TRI_PROJECTION*,TRI_PROJECTION*);
-LOCAL	boolean	set_tri_and_surface_list_pointers(struct Table*,int,int,int);
+LOCAL	boolean	alloc_topo_tiles3d(struct Table*,int*);
+LOCAL	boolean	set_tri_and_surface_list_pointers(struct Table*);
 LOCAL	int	**add_to_bls_list(int**,int*,int*,int*);
 LOCAL	int	block_dimension(int*);
-LOCAL	void	blocks_on_grid_based_tri(TRI*,int***,COMPONENT***,RECT_GRID*, 
+LOCAL	void	blocks_on_grid_based_tri(TRI*,struct Table*,RECT_GRID*, 
 				INTERFACE *);
-LOCAL	void	blocks_on_tri(TRI*,int***,COMPONENT***,RECT_GRID*,INTERFACE*);
-LOCAL	void	fill_tri_and_surface_lists(int***,TRI*****,SURFACE*****,
-	        			   INTERFACE*);
+LOCAL	void	blocks_on_tri(TRI*,struct Table*,RECT_GRID*,INTERFACE*);
+LOCAL	void	compress_topo_tiles3d(struct Table*,int,int);
+LOCAL	void	fill_tri_and_surface_lists(struct Table*,INTERFACE*);
+LOCAL	void	free_topo_tile_pages(TOPO_TILE*);
+LOCAL	void	reset_topo_tiles3d(struct Table*,COMPONENT);
+LOCAL	double	nearest_tri_visit(BVH_ELEM*,POINTER);
 LOCAL	void	nearest_on_front_grid_block(int*,int*,INTERFACE*);
 LOCAL  	boolean    nearest_local_on_front_grid_block(int*,int*,int,
 				USE_BOUNDARIES,INTERFACE*);
@@ -94,6 +107,7 @@ LOCAL   double   shortest_2line_dist_dir(int,double*,double*,double*,double*,
 LOCAL   COMPONENT component_wrt_icoords3d_vertex(double*,int*,POINT*,
 				INTERFACE*);
 LOCAL	int 	compare_tris(const void*,const void*);
+LOCAL	int	tri_block_id3d(struct Table*,int,int,int);
 
 LOCAL	double	crx_tol;/*TOLERANCE*/
 LOCAL	double	crx_tolv;
@@ -139,16 +153,16 @@ LOCAL	boolean	comp_is_on_surface(
 *	a rectangular grid structure on the INTERFACE, by default
 *	over the smallest rectangle that contains all of the
 *	INTERFACE points.   The list of tris and surfaces passing
-*	through each grid block is then computed, tris[iz][iy][ix]
-*	surfaces[iz][iy][ix], and also the array of off-front component
-*	values  compon3d[iz][iy][ix].   For on-front blocks, the compon3d[][][]
-*	array is given the flag value ONFRONT.
+*	through each grid block is then computed, Tris_in_block3d() and
+*	Surfs_in_block3d(), and also the off-front component value
+*	Comp_of_block3d() of each block.   For on-front blocks, the component
+*	is given the flag value ONFRONT.
 *
 *	component() determines the grid block containing the point
-*	x,y,z and if it is off-front, returns the value compon3d[iz][iy][ix].
+*	x,y,z and if it is off-front, returns the value Comp_of_block3d().
 *	If on-front, it locates the closest INTERFACE surface within
 *	the grid block (and determines which side of the surface it
-*	is on) by looping over the local tris[iz][iy][ix].  It then
+*	is on) by looping over the local Tris_in_block3d().  It then
 *	returns the appropriate left or right COMPONENT value of
 *	that SURFACE.
 *
@@ -215,10 +229,10 @@ LIB_LOCAL COMPONENT component3d(
 	iy = icoords[1];
 	iz = icoords[2];
 
-	if (T->compon3d[iz][iy][ix] != ONFRONT)
+	if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 	{
 	    DEBUG_LEAVE(component3d)
-	    return T->compon3d[iz][iy][ix];	/* Off Front */
+	    return Comp_of_block3d(T,ix,iy,iz);	/* Off Front */
 	}
 	/* On Front: */
 
@@ -244,8 +258,8 @@ LIB_LOCAL COMPONENT component3d(
 
 	if(debugging("fill_comp"))
 	{
-	    tecplot_show_box_tris("crx_input", T->tris[iz][iy][ix], 
-		T->num_of_tris[iz][iy][ix], &T->rect_grid, icoords);
+	    tecplot_show_box_tris("crx_input", Tris_in_block3d(T,ix,iy,iz), 
+		Num_tris_in_block3d(T,ix,iy,iz), &T->rect_grid, icoords);
 	}
 
 	for (iz = izmin; iz <= izmax; ++iz)
@@ -254,10 +268,10 @@ LIB_LOCAL COMPONENT component3d(
 	    {
 	        for (ix = ixmin; ix <= ixmax; ++ix)
 		{
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 			continue;
-	            t = T->tris[iz][iy][ix];
-	            nt = T->num_of_tris[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            nt = Num_tris_in_block3d(T,ix,iy,iz);
 
 		    for (k = 0; k < nt; ++k, ++t, ++s)
 			Tri_projection_computed(*t) = NO;
@@ -270,11 +284,11 @@ LIB_LOCAL COMPONENT component3d(
 	    {
 	        for (ix = ixmin; ix <= ixmax; ++ix)
 		{
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 			continue;
-	            t = T->tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
-	            nt = T->num_of_tris[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
+	            nt = Num_tris_in_block3d(T,ix,iy,iz);
 
 	            for (k = 0; k < nt; ++k, ++t, ++s)
 	            {
@@ -360,10 +374,10 @@ LOCAL COMPONENT component_wrt_icoords3d(
 	    {
 	        for (ix = ixmin; ix <= ixmax; ++ix)
 		{
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 			continue;
-	            t = T->tris[iz][iy][ix];
-	            nt = T->num_of_tris[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            nt = Num_tris_in_block3d(T,ix,iy,iz);
 	            for (i = 0; i < nt; ++i)
 			Tri_projection_computed(t[i]) = NO;
 		}
@@ -375,14 +389,14 @@ LOCAL COMPONENT component_wrt_icoords3d(
 	    {
 	        for (ix = ixmin; ix <= ixmax; ++ix)
 		{
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 			continue;
 
 	            /* find the number of tris and surfs in icoords */
 
-	            t = T->tris[iz][iy][ix];
-	            nt = T->num_of_tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            nt = Num_tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
 
 	            /* loop over the tris in block at icoords to find the min */
 
@@ -464,8 +478,8 @@ LOCAL	void	nearest_on_front_grid_block(
 	    {
 	    	for (k = 0; k < zmax; ++k)
 	    	{
-	            if ((T->compon3d[k][j][i] != ONFRONT) ||
-	                (T->num_of_tris[k][j][i] == 0))
+	            if ((Comp_of_block3d(T,i,j,k) != ONFRONT) ||
+	                (Num_tris_in_block3d(T,i,j,k) == 0))
 	    	    	continue;
 	    	    ir = sqr(i-ix)+sqr(j-iy)+sqr(k-iz);
 	    	    if (ir < irmin)
@@ -712,7 +726,7 @@ LIB_LOCAL COMPONENT dir_long_component3d(
 *	closest point.
 *
 *	This routine is O(1) if called on an ONFRONT gridblock,
-*	but is otherwise O(N).
+*	and is otherwise O(log N) through the hierarchy of ibvh.c.
 *
 *	If surface is not NULL then component and boundary are ignored,
 *	and instead the routine finds the closest point on this surface.
@@ -756,16 +770,13 @@ LIB_LOCAL boolean nearest_interface_point3d(
 
 	if ((point_in_buffer(coords,&T->rect_grid) == YES) ||
 	    (rect_in_which(coords,icoords,&T->rect_grid) == FUNCTION_FAILED) ||
-	    (T->compon3d[icoords[2]][icoords[1]][icoords[0]] != ONFRONT))
+	    (Comp_of_block3d(T,icoords[0],icoords[1],icoords[2]) != ONFRONT))
 	{
-		if(!nearest_local_on_front_grid_block(icoords,icoords,10,
-					bdry,intfc))
-		{
-		    if (debugging("interpolate"))
-			print_rectangular_grid(&T->rect_grid);
-	            return long_nearest_interface_point3d(coords,comp,intfc,
+	    /* Off front, search the hierarchy of the whole interface */
+	    if (debugging("interpolate"))
+		print_rectangular_grid(&T->rect_grid);
+	    return long_nearest_interface_point3d(coords,comp,intfc,
 					bdry,hs,ans,a,phse,phs);
-		}
         }
 
 	eq_comps = equivalent_components_list(comp,&n_eq,intfc);
@@ -809,11 +820,11 @@ LIB_LOCAL boolean nearest_interface_point3d(
 	    {
 	        for (iz = iz1; iz <= iz2; ++iz)
 	        {
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 	                continue;
-	            t = T->tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
-	            for (k = 0; k < T->num_of_tris[iz][iy][ix]; ++k, ++t, ++s)
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
+	            for (k = 0; k < Num_tris_in_block3d(T,ix,iy,iz); ++k, ++t, ++s)
 	            {
 	                if (hs)
 	                {
@@ -911,7 +922,7 @@ LIB_LOCAL boolean nearest_similar_interface_point3d(
 	    }
 	/* Test for Off Front */
 	if ((rect_in_which(coords, icoords, &T->rect_grid) == FUNCTION_FAILED)
-	    || (T->compon3d[icoords[2]][icoords[1]][icoords[0]] != ONFRONT))
+	    || (Comp_of_block3d(T,icoords[0],icoords[1],icoords[2]) != ONFRONT))
 	{
 	    return long_nearest_similar_interface_point3d(coords,compp,compn,
 							  intfc,bdry,hs,ans,
@@ -958,13 +969,13 @@ LIB_LOCAL boolean nearest_similar_interface_point3d(
 	    {
 	        for (iz = iz1; iz <= iz2; ++iz)
 	        {
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 	                continue;
 
-	            t = T->tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
 
-	            for (k = 0; k < T->num_of_tris[iz][iy][ix]; ++k, ++t, ++s)
+	            for (k = 0; k < Num_tris_in_block3d(T,ix,iy,iz); ++k, ++t, ++s)
 	            {
 	                if (hs)
 	                {
@@ -1054,7 +1065,7 @@ LIB_LOCAL boolean nearest_interface_point_within_range3d(
 
 	if ((point_in_buffer(coords,&T->rect_grid) == YES) ||
 	    (rect_in_which(coords,icoords,&T->rect_grid) == FUNCTION_FAILED) ||
-	    (T->compon3d[icoords[2]][icoords[1]][icoords[0]] != ONFRONT))
+	    (Comp_of_block3d(T,icoords[0],icoords[1],icoords[2]) != ONFRONT))
 	{
 	    if(!nearest_local_on_front_grid_block(icoords,icoords,range,bdry,
 				intfc))
@@ -1102,11 +1113,11 @@ LIB_LOCAL boolean nearest_interface_point_within_range3d(
 	    {
 	        for (iz = iz1; iz <= iz2; ++iz)
 	        {
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 	                continue;
-	            t = T->tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
-	            for (k = 0; k < T->num_of_tris[iz][iy][ix]; ++k, ++t, ++s)
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
+	            for (k = 0; k < Num_tris_in_block3d(T,ix,iy,iz); ++k, ++t, ++s)
 	            {
 	                if (hs)
 	                {
@@ -1180,12 +1191,8 @@ LIB_LOCAL boolean long_nearest_interface_point3d(
 	HYPER_SURF_ELEMENT **phse,
 	HYPER_SURF	**phs)
 {
-        const COMPONENT *eq_comps;
-	int             n_eq;
+	NEAREST_TRI_SEARCH ns;
 	TRI_PROJECTION	Closest, Tri_proj;
-	TRI_PROJECTION	*closest = &Closest, *tri_proj = &Tri_proj;
-	TRI		*t;
-	SURFACE		**s;
 	int		i;
 	int		dim = intfc->dim;
 
@@ -1201,39 +1208,13 @@ LIB_LOCAL boolean long_nearest_interface_point3d(
 	for (i = 0; i < dim; ++i)
 	    Tri_proj.pt[i] = coords[i];
 
-	eq_comps = equivalent_components_list(comp,&n_eq,intfc);
-	for (s = intfc->surfaces; s && *s; ++s)
-	{
-	    /* new made wall surface has no tris, should be excluded */
-	    if(first_tri(*s) == NULL)
-	        continue;
-	    
-	    if (hs)
-	    {
-	    	if (Surface_of_hs(hs) != *s)
-	    	    continue;
-	    	/*
-	         * Note: In this case the for statement is redundant but it
-	    	 * does provide a check that the surface is on the interface
-	    	 * intfc
-	         */
-	    }
-	    else
-	    {
-		if (!comp_is_on_surface(*s,eq_comps,n_eq))
-	    	    continue;
-		if (skip_boundary_hs(Hyper_surf(*s),bdry))
-	    	    continue;
-	    }
-	    Tri_proj.s = *s;
-	    for (t = first_tri(*s); !at_end_of_tri_list(t,*s); t = t->next)
-	    {
-	        Tri_proj.tri = t;
-	        shortest_distance3d(tri_proj);
-	        if (new_tri_is_closer(tri_proj,closest) == YES)
-	            Closest = Tri_proj;
-	    }
-	}
+	ns.closest = &Closest;
+	ns.tri_proj = &Tri_proj;
+	ns.eq_comps = equivalent_components_list(comp,&ns.n_eq,intfc);
+	ns.bdry = bdry;
+	ns.hs = hs;
+	(void) bvh_nearest_search(interface_bvh(intfc),coords,
+				  nearest_tri_visit,(POINTER)&ns);
 
 	if (Closest.tri == NULL)
 	{ 
@@ -1252,6 +1233,39 @@ LIB_LOCAL boolean long_nearest_interface_point3d(
 	return YES;
 }		/*end long_nearest_interface_point3d*/
 
+/*
+*	Visit function of the hierarchy search of
+*	long_nearest_interface_point3d(), with the same selection of the
+*	surfaces and of the closest tri as the search of the grid blocks.
+*/
+
+LOCAL	double	nearest_tri_visit(
+	BVH_ELEM	*e,
+	POINTER		arg)
+{
+	NEAREST_TRI_SEARCH *ns = (NEAREST_TRI_SEARCH*)arg;
+	SURFACE		*s = Surface_of_hs(e->hs);
+
+	if (ns->hs)
+	{
+	    if (Surface_of_hs(ns->hs) != s)
+	    	return ns->closest->d2;
+	}
+	else
+	{
+	    if (!comp_is_on_surface(s,ns->eq_comps,ns->n_eq))
+	    	return ns->closest->d2;
+	    if (skip_boundary_hs(e->hs,ns->bdry))
+	    	return ns->closest->d2;
+	}
+	ns->tri_proj->tri = Tri_of_hse(e->hse);
+	ns->tri_proj->s = s;
+	shortest_distance3d(ns->tri_proj);
+	if (new_tri_is_closer(ns->tri_proj,ns->closest) == YES)
+	    *ns->closest = *ns->tri_proj;
+	return ns->closest->d2;
+}		/*end nearest_tri_visit*/
+
 /*
 *			long_nearest_similar_interface_point3d():
 *
@@ -1987,9 +2001,9 @@ LOCAL	boolean old_tri_on_edge(
 /*
 *			make_tri_comp_lists():
 *
-*	This function determines the local component and tri list arrays
-*	compon3d[][][], num_of_tris[][][], and tris[][][]
-*	for an INTERFACE relative to a grid.
+*	This function determines the local block components, tri counts
+*	and tri lists (see the Block3d macros in table.h) for an INTERFACE
+*	relative to a grid.
 *
 *	Returns 1 if successful or 0 on error (insufficient space).
 */
@@ -2017,6 +2031,7 @@ EXPORT boolean make_tri_comp_lists(
 	}
 	intfc->modified = NO;
 	intfc->table->new_grid = NO;
+	reset_interface_bvh(intfc);
 
 	DEBUG_LEAVE(make_tri_comp_lists)
 	return FUNCTION_SUCCEEDED;
@@ -2028,14 +2043,19 @@ EXPORT boolean make_tri_comp_lists(
 /*
 *			make_tri_lists():
 *
-*	Computes the number of TRIS num_of_tris[iz][iy][ix] of INTERFACE
+*	Computes the number of TRIS Num_tris_in_block3d() of INTERFACE
 *	traversing each grid block of RECT_GRID, and constructs the
-*	lists tris[iz][iy][ix] and surfaces[iz][iy][ix] of traversing TRIS
+*	lists Tris_in_block3d() and Surfs_in_block3d() of traversing TRIS
 *	and SURFACES for each grid block:
 *
-*	Initializes  compon3d[iz][iy][ix]  to ONFRONT for blocks traversed
+*	Initializes  Comp_of_block3d()  to ONFRONT for blocks traversed
 *	by INTERFACE and to the component value elsewhere.
 *
+*	The tables are block-sparse:  the grid is divided into tiles of
+*	TOPO_TILE_SIZE^3 blocks,  tri list pages are allocated only for
+*	tiles that are crossed by the front,  and the block components of
+*	a tile are collapsed to a single label once they all agree.
+*
 *
 *	Returns 1 if successful or 0 on error (if insufficient
 *	storage is available, or there is a problem in rect_in_which()).
@@ -2046,26 +2066,26 @@ EXPORT boolean make_tri_comp_lists(
 *	This is a three-pass construction over the INTERFACE with an
 *	intermediate pass over the RECT_GRID.
 *
-*	On the first pass, the array tri_blocks is filled in along with
-*	the number of tris in each mesh-square num_of_tris[][][].  This
+*	On the first pass, the array tri_blocks is filled in and the tiles
+*	crossed by the front are numbered as tri pages.  This
 *	is accomplished by calling the routine blocks_on_tri()
 *	consecutively on each TRI of INTERFACE.
 *
 *	tri_blocks will contain for each TRI of INTERFACE the list
-*	of (ix,iy,iz) integer triples for all grid blocks of the grid which are
-*	traversed by TRI.   The end of the integer-triple list for a
-*	TRI is marked with the integer  END_TRI.
+*	of compact block ids (tri page*TOPO_TILE_VOLUME + index in tile) for
+*	all grid blocks of the grid which are traversed by TRI.   The end of
+*	the id list for a TRI is marked with the integer  END_TRI.
 *
-*	The second pass, set_tri_list_pointers(), initializes the
-*	pointers tris[iz][iy][ix] to point to the correct offsets in
-*	the array tristore[] using the previously constructed
-*	num_of_tris[][][] array.   Similarly for surfaces[iz][iy][ix].
+*	The second pass, set_tri_and_surface_list_pointers(), counts the
+*	tris of each block from tri_blocks and scans the counts into the
+*	row offsets tri_offsets[] of the packed array tristore[].
 *
-*	The third pass, fill_tri_and_curve_lists(), is a loop over the
+*	The third pass, fill_tri_and_surface_lists(), is a loop over the
 *	TRIS of INTERFACE.   For each TRI, the grid square information
-*	previously stored in tri_blocks is transferred to the tris[][][]
-*	array by adding TRI to tris[iz][iy][ix] for each (ix,iy,iz) triple
-*	in the tri_block list for that TRI.   Similarly for surfaces[][][].
+*	previously stored in tri_blocks is transferred to tristore[]
+*	by adding TRI to the row of each block id in the tri_block list
+*	for that TRI.   Similarly for the surfaces.  This pass is serial
+*	so that the order of the tris within a block is reproducible.
 *
 *	Storage Requirements:
 *
@@ -2078,14 +2098,15 @@ EXPORT boolean make_tri_comp_lists(
 *	a hyperplane. In dimension d, this number is 1 + 2 + 2**2 + ...
 *	+ 2**(d-1) = 2**d -1, and for d = 3, the number is 7.  Thus in the
 *	worst case, a triangle meets 7 of the 8 contingous octants. The storage
-*	requirement is 3 integers per block (octant) and one additional integer
-*	to mark the end of the list of blocks. Thus the storage is bounded by
-*	(3 * 7 + 1) * num_tris = 22 * num_tris.  The corresponidng two
-*	dimensional estimate is (2 * 3 + 1) * num_tris = 7 * num_tris. On a
+*	requirement is one integer per block (octant),  its compact id,  and
+*	one additional integer to mark the end of the list of blocks. Thus the
+*	storage is bounded by (7 + 1) * num_tris = 8 * num_tris.  The
+*	corresponidng two dimensional estimate is (2 * 3 + 1) * num_tris =
+*	7 * num_tris. On a
 *	probabilistic basis, a considerably smaller amount of storage would do.
 *
 *	Estimates of tristore and surfacestore are not needed, as the
-*	num_of_tris[][][] and num_of_surfaces[][][] are computed exactly
+*	block tri counts are computed exactly
 *	before this storage is needed, giving exact values for the tristore and
 *	surfacestore.
 */
@@ -2106,7 +2127,7 @@ enum { END_TRI = -1 };	/* Any integer that cannot be a grid block index */
 #define  mark_end_of_tri(tblocks)	 *((tblocks)++) = END_TRI
 #define  end_tri(tblocks)		((tblocks) == END_TRI)
 
-LOCAL	int total_num_of_tri_blocks;	/* sum of num_of_tris[iz][iy][ix] */
+LOCAL	int total_num_of_tri_blocks;	/* sum of block tri counts */
 LOCAL	int *Tri_blocks = NULL;	/* Temporary Array */
 LOCAL	int *tri_blocks = NULL;	/* Points to temporary array */
 LOCAL	int tri_blocks_size, tri_blocks_top;
@@ -2287,11 +2308,244 @@ de_out_s:
 void	set_sort_tol(RECT_GRID  *);
 void	sort_tris_on_blocks(INTERFACE	*);
 
+/*
+*			alloc_topo_tiles3d():
+*			free_topo_tiles3d():
+*			set_comp_of_block3d():
+*			compress_topo_tiles3d():
+*
+*	Storage management for the block-sparse 3D topological tables.
+*	The tile directory is allocated with every tile homogeneous with
+*	label NO_COMP.  set_comp_of_block3d() gives a tile a page of block
+*	labels the first time one of its blocks is assigned a label that
+*	differs from the tile label,  and compress_topo_tiles3d() releases
+*	the page again when all blocks of the tile carry the same label.
+*	Tri pages are numbered by tri_block_id3d() for the tiles crossed
+*	by the front only.
+*/
+
+LOCAL	boolean	alloc_topo_tiles3d(
+	struct Table	*T,
+	int		*gmax)
+{
+	int		i, ntiles;
+
+	ntiles = 1;
+	for (i = 0; i < 3; ++i)
+	{
+	    T->topo_tile_gmax[i] = (gmax[i] + TOPO_TILE_MASK) >> TOPO_TILE_SHIFT;
+	    ntiles *= T->topo_tile_gmax[i];
+	}
+	uni_array(&T->topo_tiles,ntiles,sizeof(TOPO_TILE));
+	uni_array(&T->tri_page_tiles,ntiles,INT);
+	if (T->topo_tiles == NULL || T->tri_page_tiles == NULL)
+	    return NO;
+	for (i = 0; i < ntiles; ++i)
+	{
+	    T->topo_tiles[i].comp = NO_COMP;
+	    T->topo_tiles[i].page = -1;
+	}
+	T->num_tri_pages = 0;
+	T->tri_offsets = NULL;
+	return YES;
+}		/*end alloc_topo_tiles3d*/
+
+LOCAL	void	free_topo_tile_pages(
+	TOPO_TILE	*tile)
+{
+	if (tile->comps != NULL)
+	{
+	    free(tile->comps);
+	    tile->comps = NULL;
+	}
+	tile->page = -1;
+}		/*end free_topo_tile_pages*/
+
+EXPORT	void	free_topo_tiles3d(
+	struct Table	*T)
+{
+	int		i, ntiles;
+
+	if (T->topo_tiles != NULL)
+	{
+	    ntiles = T->topo_tile_gmax[0]*T->topo_tile_gmax[1]*
+		     T->topo_tile_gmax[2];
+	    for (i = 0; i < ntiles; ++i)
+		free_topo_tile_pages(T->topo_tiles + i);
+	    free(T->topo_tiles);
+	    T->topo_tiles = NULL;
+	}
+	if (T->tri_page_tiles != NULL)
+	{
+	    free(T->tri_page_tiles);
+	    T->tri_page_tiles = NULL;
+	}
+	if (T->tri_offsets != NULL)
+	{
+	    free(T->tri_offsets);
+	    T->tri_offsets = NULL;
+	}
+	T->num_tri_pages = 0;
+	if (T->tristore != NULL)
+	{
+	    free(T->tristore);
+	    T->tristore = NULL;
+	}
+	if (T->surfacestore != NULL)
+	{
+	    free(T->surfacestore);
+	    T->surfacestore = NULL;
+	}
+}		/*end free_topo_tiles3d*/
+
+/*
+*	Sets all blocks to the component comp with no tris,  as for an
+*	interface that does not cross the topological grid.
+*/
+
+LOCAL	void	reset_topo_tiles3d(
+	struct Table	*T,
+	COMPONENT	comp)
+{
+	int		i, ntiles;
+
+	ntiles = T->topo_tile_gmax[0]*T->topo_tile_gmax[1]*T->topo_tile_gmax[2];
+	for (i = 0; i < ntiles; ++i)
+	{
+	    free_topo_tile_pages(T->topo_tiles + i);
+	    T->topo_tiles[i].comp = comp;
+	}
+	if (T->tri_offsets != NULL)
+	{
+	    free(T->tri_offsets);
+	    T->tri_offsets = NULL;
+	}
+	T->num_tri_pages = 0;
+}		/*end reset_topo_tiles3d*/
+
+EXPORT	void	set_comp_of_block3d(
+	struct Table	*T,
+	int		ix,
+	int		iy,
+	int		iz,
+	COMPONENT	comp)
+{
+	TOPO_TILE	*tile = &Topo_tile3d(T,ix,iy,iz);
+	int		i;
+
+	if (tile->comps == NULL)
+	{
+	    if (tile->comp == comp)
+		return;
+	    uni_array(&tile->comps,TOPO_TILE_VOLUME,sizeof(COMPONENT));
+	    if (tile->comps == NULL)
+	    {
+		screen("ERROR in set_comp_of_block3d(), "
+		       "can't allocate component page\n");
+		clean_up(ERROR);
+	    }
+	    for (i = 0; i < TOPO_TILE_VOLUME; ++i)
+		tile->comps[i] = tile->comp;
+	}
+	tile->comps[Topo_index_in_tile3d(ix,iy,iz)] = comp;
+}		/*end set_comp_of_block3d*/
+
+/*
+*	Collapses the component pages of the tile layers tzmin <= tz < tzmax
+*	whose blocks inside the topological grid all carry the same label.
+*/
+
+LOCAL	void	compress_topo_tiles3d(
+	struct Table	*T,
+	int		tzmin,
+	int		tzmax)
+{
+	TOPO_TILE	*tile;
+	COMPONENT	c;
+	int		*gmax = T->rect_grid.gmax;
+	int		*tgmax = T->topo_tile_gmax;
+	int		tx, ty, tz, i, j, k, n[3];
+	boolean		uniform;
+
+	for (tz = tzmin; tz < tzmax; ++tz)
+	for (ty = 0; ty < tgmax[1]; ++ty)
+	for (tx = 0; tx < tgmax[0]; ++tx)
+	{
+	    tile = T->topo_tiles + (tz*tgmax[1] + ty)*tgmax[0] + tx;
+	    if (tile->comps == NULL)
+		continue;
+	    n[0] = min(TOPO_TILE_SIZE,gmax[0] - (tx << TOPO_TILE_SHIFT));
+	    n[1] = min(TOPO_TILE_SIZE,gmax[1] - (ty << TOPO_TILE_SHIFT));
+	    n[2] = min(TOPO_TILE_SIZE,gmax[2] - (tz << TOPO_TILE_SHIFT));
+	    c = tile->comps[0];
+	    uniform = YES;
+	    for (k = 0; k < n[2] && uniform; ++k)
+	    for (j = 0; j < n[1] && uniform; ++j)
+	    for (i = 0; i < n[0]; ++i)
+	    {
+		if (tile->comps[Topo_index_in_tile3d(i,j,k)] != c)
+		{
+		    uniform = NO;
+		    break;
+		}
+	    }
+	    if (uniform)
+	    {
+		free(tile->comps);
+		tile->comps = NULL;
+		tile->comp = c;
+	    }
+	}
+}		/*end compress_topo_tiles3d*/
+
+/*
+*	Returns the compact id of block (ix,iy,iz) in the tri list table,
+*	numbering a new tri page for its tile on first use.
+*/
+
+LOCAL	int	tri_block_id3d(
+	struct Table	*T,
+	int		ix,
+	int		iy,
+	int		iz)
+{
+	TOPO_TILE	*tile = &Topo_tile3d(T,ix,iy,iz);
+
+	if (tile->page < 0)
+	{
+	    tile->page = T->num_tri_pages++;
+	    T->tri_page_tiles[tile->page] = (int)(tile - T->topo_tiles);
+	}
+	return Topo_block_id3d(T,ix,iy,iz);
+}		/*end tri_block_id3d*/
+
+/*
+*	Inverse of Topo_block_id3d():  returns in ic the icoords of the
+*	block with compact id in the tri list table.
+*/
+
+EXPORT	void	topo_block_icoords3d(
+	struct Table	*T,
+	int		id,
+	int		*ic)
+{
+	int		*tgmax = T->topo_tile_gmax;
+	int		it, ib;
+
+	it = T->tri_page_tiles[id/TOPO_TILE_VOLUME];
+	ib = id%TOPO_TILE_VOLUME;
+	ic[0] = ((it%tgmax[0]) << TOPO_TILE_SHIFT) + (ib & TOPO_TILE_MASK);
+	it /= tgmax[0];
+	ib >>= TOPO_TILE_SHIFT;
+	ic[1] = ((it%tgmax[1]) << TOPO_TILE_SHIFT) + (ib & TOPO_TILE_MASK);
+	it /= tgmax[1];
+	ib >>= TOPO_TILE_SHIFT;
+	ic[2] = (it << TOPO_TILE_SHIFT) + ib;
+}		/*end topo_block_icoords3d*/
+
 LIB_LOCAL boolean make_tri_lists(
 	INTERFACE	*intfc)
 {
-	COMPONENT    **compiz, **compizL, **compizU;
-	COMPONENT    *compiziy, *compiziyL, *compiziyU;
 	RECT_GRID    *top_grid;
 	SURFACE	     **s;
 	TRI	     *t;
@@ -2323,36 +2577,7 @@ LIB_LOCAL boolean make_tri_lists(
 
 	/* Free old storage */
 
-	if (T->num_of_tris != NULL)
-	{
-	    free(T->num_of_tris);
-	    T->num_of_tris = NULL;
-	}
-	if (T->tristore != NULL)
-	{
-	    free(T->tristore);
-	    T->tristore = NULL;
-	}
-	if (T->surfacestore != NULL)
-	{
-	    free(T->surfacestore);
-	    T->surfacestore = NULL;
-	}
-	if (T->compon3d != NULL)
-	{
-	    free(T->compon3d);
-	    T->compon3d = NULL;
-	}
-	if (T->tris != NULL)
-	{
-	    free(T->tris);
-	    T->tris = NULL;
-	}
-	if (T->surfaces != NULL)
-	{
-	    free(T->surfaces);
-	    T->surfaces = NULL;
-	}
+	free_topo_tiles3d(T);
 	if (T->surf_blocks != NULL)
 	{
 	    for (i = 0; i < T->num_surf_blocks; ++i)
@@ -2378,25 +2603,13 @@ LIB_LOCAL boolean make_tri_lists(
 
 	set_tri_list_tolerance(top_grid);
 
-	/* Allocate New num_of_tris[][][], compon3d[][][]: */
+	/* Allocate the tile directory, all blocks start as NO_COMP */
 
 	xmax = top_grid->gmax[0];
 	ymax = top_grid->gmax[1];
 	zmax = top_grid->gmax[2];
 
-	tri_array(&T->num_of_tris,zmax,ymax,xmax,INT);
-	if (T->num_of_tris == NULL)
-	{
-	    stop_clock("make_tri_lists");
-	    DEBUG_LEAVE(make_tri_lists)
-	    return NO;
-	}
-	/* NOTE: 
-	 * tri_array returns data initialized to 0, so
-	 * T->num_of_tris[k][j][i] = 0 for all i, j, k initially
-	 */
-	tri_array(&T->compon3d,zmax,ymax,xmax,sizeof(COMPONENT));
-	if (T->compon3d == NULL)
+	if (!alloc_topo_tiles3d(T,top_grid->gmax))
 	{
 	    stop_clock("make_tri_lists");
 	    DEBUG_LEAVE(make_tri_lists)
@@ -2426,42 +2639,27 @@ LIB_LOCAL boolean make_tri_lists(
 	    }
 	}
 
-	/* Initialize all blocks to NO_COMP */
-
-	for (iz = 0; iz < zmax; ++iz)
-	    for (compiz = T->compon3d[iz], iy = 0; iy < ymax; ++iy)
-	    	for (compiziy = compiz[iy], ix = 0; ix < xmax; ++ix)
-	    	    compiziy[ix] = NO_COMP;
-
 	/* Set rect boundary edge values */
 
-	compizL = T->compon3d[0];
-	compizU = T->compon3d[zmax-1];
 	for (iy = 0; iy < ymax; ++iy)
 	{
-	    compiziyL = compizL[iy];
-	    compiziyU = compizU[iy];
 	    for (ix = 0; ix < xmax; ++ix)
 	    {
-	    	compiziyL[ix] = ON_RECT_BOUNDARY;
-	    	compiziyU[ix] = ON_RECT_BOUNDARY;
+	    	set_comp_of_block3d(T,ix,iy,0,ON_RECT_BOUNDARY);
+	    	set_comp_of_block3d(T,ix,iy,zmax-1,ON_RECT_BOUNDARY);
 	    }
 	}
 	for (iz = 1; iz < zmax-1; ++iz)
 	{
-	    compiz = T->compon3d[iz];
-	    compiziyL = compiz[0];
-	    compiziyU = compiz[ymax-1];
 	    for (ix = 0; ix < xmax; ++ix)
 	    {
-	    	compiziyL[ix] = ON_RECT_BOUNDARY;
-	    	compiziyU[ix] = ON_RECT_BOUNDARY;
+	    	set_comp_of_block3d(T,ix,0,iz,ON_RECT_BOUNDARY);
+	    	set_comp_of_block3d(T,ix,ymax-1,iz,ON_RECT_BOUNDARY);
 	    }
 	    for (iy = 1; iy < ymax-1; ++iy)
 	    {
-	    	compiziy = compiz[iy];
-	    	compiziy[0] = ON_RECT_BOUNDARY;
-	    	compiziy[xmax-1] = ON_RECT_BOUNDARY;
+	    	set_comp_of_block3d(T,0,iy,iz,ON_RECT_BOUNDARY);
+	    	set_comp_of_block3d(T,xmax-1,iy,iz,ON_RECT_BOUNDARY);
 	    }
 	}
 
@@ -2496,7 +2694,7 @@ LIB_LOCAL boolean make_tri_lists(
 	    	    size *= 2 + (int)( (max3(a, b, c) - min3(a, b, c) + 
 		    		      4.0*hmintol)/h[i]);
 	        }
-	        max_size += 3 * size + 1;
+	        max_size += size + 1;
 	    }
 	}
 
@@ -2514,7 +2712,7 @@ LIB_LOCAL boolean make_tri_lists(
 	    tri_blocks_size = max_size;
 	    tri_blocks_top = 0;
 
-	    /* Fill the num_of_tris[][][] and Tri_square arrays: */
+	    /* Fill the block tri counts and Tri_square arrays: */
 
 	    /* Find and record all blocks on each tri: */
 
@@ -2525,41 +2723,31 @@ LIB_LOCAL boolean make_tri_lists(
 	    	for (t = first_tri(*s); !at_end_of_tri_list(t,*s); 
 				t = t->next)
 		{
-	            blocks_on_tri(t,T->num_of_tris,T->compon3d,top_grid,intfc);
+	            blocks_on_tri(t,T,top_grid,intfc);
 		}
 	    }
 	
-	    /* Assign tris[][][] and surfaces[][][]: */
+	    /* Assign the block TRI and SURFACE lists: */
 	    if (total_num_of_tri_blocks > 0 &&
-		(status = set_tri_and_surface_list_pointers(T,xmax,ymax,zmax)))
+		(status = set_tri_and_surface_list_pointers(T)))
 	    {
 
 	    	/* Copy in the grid blocks from Tri_blocks: */
 
-	    	fill_tri_and_surface_lists(T->num_of_tris,T->tris,T->surfaces,
-	    			       intfc);
+	    	fill_tri_and_surface_lists(T,intfc);
 		set_sort_tol(top_grid);
 		sort_tris_on_blocks(intfc);
-	    	/* Set the compon3d[][] array: */
+	    	/* Set the block components: */
 
 	    	set_off_front_comp3d(intfc);
+		compress_topo_tiles3d(T,0,T->topo_tile_gmax[2]);
 	    }
 	    free(Tri_blocks);
 	}
 
 	if (max_size == out_cnt || total_num_of_tri_blocks == 0)
 	{
-	    for (iz = 0; iz < zmax; ++iz)
-	    {
-	    	for (iy = 0; iy < ymax; ++iy)
-		{
-	    	    for (ix = 0; ix < xmax; ++ix)
-		    {
-	    	    	T->num_of_tris[iz][iy][ix] = 0;
-	    	    	T->compon3d[iz][iy][ix] = intfc->default_comp;
-		    }
-		}
-	    }
+	    reset_topo_tiles3d(T,intfc->default_comp);
 	    status = YES;
 	}
 
@@ -2594,45 +2782,92 @@ EXPORT  void assign_tri_icoords(
 }     /* end assign_tri_icoords */
 
 
+enum { NUM_SCAN_CHUNKS = 64, MIN_PARALLEL_TRI_BLOCKS = 65536 };
+
+/*
+*			exclusive_scan_tri_offsets():
+*
+*	Converts the block tri counts stored in offsets[1..n] into the row
+*	offsets of the tri list table,  offsets[0] = 0 and offsets[k] =
+*	the total count of blocks 0..k-1.  The scan is done in fixed chunks
+*	so that the chunk sums and the final pass may be shared by threads.
+*/
+
+LOCAL	void	exclusive_scan_tri_offsets(
+	int		*offsets,
+	int		n)
+{
+	int		chunk_sum[NUM_SCAN_CHUNKS+1];
+	int		nchunks, chunk, c;
+
+	offsets[0] = 0;
+	if (n <= 0)
+	    return;
+	chunk = (n + NUM_SCAN_CHUNKS - 1)/NUM_SCAN_CHUNKS;
+	nchunks = (n + chunk - 1)/chunk;
+
+#pragma omp parallel for if (n > MIN_PARALLEL_TRI_BLOCKS)
+	for (c = 0; c < nchunks; ++c)
+	{
+	    int k, kmax = min(n,(c+1)*chunk);
+	    for (k = c*chunk + 2; k <= kmax; ++k)
+		offsets[k] += offsets[k-1];
+	}
+	chunk_sum[0] = 0;
+	for (c = 0; c < nchunks; ++c)
+	    chunk_sum[c+1] = chunk_sum[c] + offsets[min(n,(c+1)*chunk)];
+
+#pragma omp parallel for if (n > MIN_PARALLEL_TRI_BLOCKS)
+	for (c = 1; c < nchunks; ++c)
+	{
+	    int k, kmax = min(n,(c+1)*chunk);
+	    for (k = c*chunk + 1; k <= kmax; ++k)
+		offsets[k] += chunk_sum[c];
+	}
+}		/*end exclusive_scan_tri_offsets*/
+
 /*
 *			set_tri_and_surface_list_pointers():
 *
 *	Does what its name implies! Read documentation above for the
-*	function make_tri_list().
+*	function make_tri_list().  The block tri counts are accumulated
+*	from Tri_blocks and scanned into the row offsets tri_offsets[].
 *	Returns 1 if successful, or 0 if unable to allocate enough
 *	space.
 */
 
 LOCAL boolean set_tri_and_surface_list_pointers(
-	struct Table	*T,
-	int		xmax,
-	int		ymax,
-	int		zmax)
+	struct Table	*T)
 {
-	int		ix, iy, iz;
-	int		***num_tris, **num_tris_iz, *num_tris_iziy;
-	TRI		**last_t;
-	TRI		*****tris, ****tris_iz, ***tris_iziy;
-	SURFACE		**last_s;
-	SURFACE		*****surfs, ****surfs_iz, ***surfs_iziy;
+	int		*offsets;
+	int		i, n, nblocks;
 
 	DEBUG_ENTER(set_tri_and_surface_list_pointers)
 
-	/* Allocate tris and surfaces arrays: */
-
-	tri_array(&T->tris,zmax,ymax,xmax,sizeof(TRI **));
-	if (T->tris == NULL)
+	nblocks = T->num_tri_pages*TOPO_TILE_VOLUME;
+	uni_array(&T->tri_offsets,nblocks+1,INT);
+	if (T->tri_offsets == NULL)
 	{ 
 	    DEBUG_LEAVE(set_tri_and_surface_list_pointers)
-	    return NO; 
+	    return NO;
 	}
+	offsets = T->tri_offsets;
+	for (i = 0; i <= nblocks; ++i)
+	    offsets[i] = 0;
 
-	tri_array(&T->surfaces, zmax, ymax, xmax, sizeof(SURFACE **));
-	if (T->surfaces == NULL)
-	{ 
-	    DEBUG_LEAVE(set_tri_and_surface_list_pointers)
-	    return NO;
+	/* Count the tris of each block into offsets[id+1] */
+
+	n = (int)(tri_blocks - Tri_blocks);
+#pragma omp parallel for if (n > MIN_PARALLEL_TRI_BLOCKS)
+	for (i = 0; i < n; ++i)
+	{
+	    int id = Tri_blocks[i];
+	    if (end_tri(id))
+		continue;
+#pragma omp atomic
+	    ++offsets[id+1];
 	}
+	exclusive_scan_tri_offsets(offsets,nblocks);
 
 	/* Allocate tristore, surfacestore arrays: */
 
@@ -2650,44 +2885,6 @@ LOCAL boolean set_tri_and_surface_list_pointers(
 	    return NO;
 	}
 
-	last_t = T->tristore;
-	last_s = T->surfacestore;
-	tris = T->tris;
-	surfs = T->surfaces;
-	num_tris = T->num_of_tris;
-	/*
-	for (iz = 0; iz < zmax; ++iz)
-	{
-	    num_tris_iz = num_tris[iz];
-	    tris_iz = tris[iz];
-	    surfs_iz = surfs[iz];
-	    for (iy = 0; iy < ymax; ++iy)
-	    {
-	    	num_tris_iziy = num_tris_iz[iy];
-	    	tris_iziy = tris_iz[iy];
-	    	surfs_iziy = surfs_iz[iy];
-	    	for (ix = 0; ix < xmax; ++ix)
-	    	{
-	    	    tris_iziy[ix] = last_t;
-	    	    surfs_iziy[ix] = last_s;
-	    	    last_t += num_tris_iziy[ix];
-	    	    last_s += num_tris_iziy[ix];
-	    	    num_tris_iziy[ix] = 0;
-	    	}
-	    }
-	}
-	*/
-	for (iz = 0; iz < zmax; ++iz)
-	for (iy = 0; iy < ymax; ++iy)
-	for (ix = 0; ix < xmax; ++ix)
-	{
-	    tris[iz][iy][ix] = last_t;
-	    surfs[iz][iy][ix] = last_s;
-	    last_t += num_tris[iz][iy][ix];
-	    last_s += num_tris[iz][iy][ix];
-	    num_tris[iz][iy][ix] = 0;
-	}
-
 	DEBUG_LEAVE(set_tri_and_surface_list_pointers)
 	return YES;
 }		/*end set_tri_and_surface_list_pointers*/
@@ -2729,34 +2926,25 @@ void	sort_tris_on_blocks(INTERFACE	*);
 /*procs will have the same tris. */
 void	sort_tris_on_blocks(INTERFACE	*intfc)
 {
-	RECT_GRID	*top_grid = &topological_grid(intfc);
 	struct Table	*T;
-	TRI		**tris;
-	SURFACE		**surfs;
-	int		ix, iy, iz, i, nt, xmax, ymax, zmax;
+	int		id, nblocks;
 	
 	T = table_of_interface(intfc);
-	xmax = top_grid->gmax[0];
-	ymax = top_grid->gmax[1];
-	zmax = top_grid->gmax[2];
+	nblocks = T->num_tri_pages*TOPO_TILE_VOLUME;
 
-	for(iz = 0; iz < zmax; ++iz)
+#pragma omp parallel for schedule(dynamic,TOPO_TILE_VOLUME) \
+		if (nblocks > MIN_PARALLEL_TRI_BLOCKS)
+	for(id = 0; id < nblocks; ++id)
 	{
-	    for(iy = 0; iy < ymax; ++iy)
-	    {
-		for(ix = 0; ix < xmax; ++ix)
-		{
-		    nt = T->num_of_tris[iz][iy][ix];
-		    if(nt == 0)
-			continue;
-		    tris = T->tris[iz][iy][ix];
-		    surfs = T->surfaces[iz][iy][ix];
+	    TRI		**tris = T->tristore + T->tri_offsets[id];
+	    SURFACE	**surfs = T->surfacestore + T->tri_offsets[id];
+	    int		i, nt = T->tri_offsets[id+1] - T->tri_offsets[id];
 
-		    qsort((POINTER)tris, nt, sizeof(TRI*), compare_tris);
-		    for(i=0; i<nt; i++)
-			surfs[i] = tris[i]->surf;
-		}
-	    }
+	    if(nt < 2)
+		continue;
+	    qsort((POINTER)tris, nt, sizeof(TRI*), compare_tris);
+	    for(i=0; i<nt; i++)
+		surfs[i] = tris[i]->surf;
 	}
 }
 
@@ -2768,16 +2956,15 @@ void	sort_tris_on_blocks(INTERFACE	*intfc)
 */
 
 LOCAL void fill_tri_and_surface_lists(
-	int		***num_of_tris,
-	TRI		*****tris,
-	SURFACE		*****surfaces,
+	struct Table	*T,
 	INTERFACE	*intfc)
 {
 	int		i,ix,iy,iz;
 	TRI		*t;
 	SURFACE		**s;
+	int		*offsets = T->tri_offsets;
+	int		id, pos, nblocks, ic[3];
 	int		isurf;
-	struct	Table	*T = table_of_interface(intfc);
 	BLOCK	*surf_blocks = T->surf_blocks;
 
 	DEBUG_ENTER(fill_tri_and_surface_lists)
@@ -2793,13 +2980,12 @@ LOCAL void fill_tri_and_surface_lists(
 	    {
 	    	while(!end_tri(*tri_blocks))
 	    	{
-	    	    int num_tris;
-	    	    ix = *(tri_blocks++);
-	    	    iy = *(tri_blocks++);
-	    	    iz = *(tri_blocks++);
-	    	    num_tris = num_of_tris[iz][iy][ix]++;
-	    	    tris[iz][iy][ix][num_tris] = t;
-	    	    surfaces[iz][iy][ix][num_tris] = *s;
+	    	    id = *(tri_blocks++);
+		    pos = offsets[id]++;
+	    	    T->tristore[pos] = t;
+	    	    T->surfacestore[pos] = *s;
+		    topo_block_icoords3d(T,id,ic);
+		    ix = ic[0];	iy = ic[1];	iz = ic[2];
 		    if (surf_blocks[isurf].bmin[0] > ix)
 			surf_blocks[isurf].bmin[0] = ix;
 		    if (surf_blocks[isurf].bmax[0] < ix)
@@ -2817,6 +3003,14 @@ LOCAL void fill_tri_and_surface_lists(
 	    }
 	    ++isurf;
 	}
+
+	/* Each offset now marks the end of its row,  shift them back */
+
+	nblocks = T->num_tri_pages*TOPO_TILE_VOLUME;
+	for (id = nblocks; id > 0; --id)
+	    offsets[id] = offsets[id-1];
+	offsets[0] = 0;
+
 	for (i = 0; i < isurf; ++i)
 	{
 	    int *bmin = surf_blocks[i].bmin;
@@ -2826,7 +3020,7 @@ LOCAL void fill_tri_and_surface_lists(
 	    for (iy = bmin[1]; iy <= bmax[1]; ++iy)
 	    for (iz = bmin[2]; iz <= bmax[2]; ++iz)
 	    {
-		if (num_of_tris[iz][iy][ix] != 0)
+		if (Num_tris_in_block3d(T,ix,iy,iz) != 0)
 		    num_on_blocks++;
 	    }
 	    surf_blocks[i].num_on_blocks = num_on_blocks;
@@ -2836,7 +3030,7 @@ LOCAL void fill_tri_and_surface_lists(
 	    for (iy = bmin[1]; iy <= bmax[1]; ++iy)
 	    for (iz = bmin[2]; iz <= bmax[2]; ++iz)
 	    {
-		if (num_of_tris[iz][iy][ix] != 0)
+		if (Num_tris_in_block3d(T,ix,iy,iz) != 0)
 		{
 		    surf_blocks[i].blocks[num_on_blocks][0] = ix;
 		    surf_blocks[i].blocks[num_on_blocks][1] = iy;
@@ -2853,28 +3047,19 @@ LOCAL void fill_tri_and_surface_lists(
 /*
 *				Store_tri():
 *
-*	Adds a new icoords block entry to the tri_blocks array.
-*	Also increments num_of_tris[iz][iy][ix] and sets compon3d[iz][iy][ix]
-*	to ONFRONT.
-*
-*	Pass tri_blocks, total_num_of_tri_blocks, and comp as macro arguments.
+*	Adds the compact id of the icoords block to the tri_blocks array
+*	and sets the component of the block to ONFRONT.  The block tri
+*	counts are accumulated later from tri_blocks.
 *
-*	NOTE:
-*	The line (num_of_tris)[iz][iy][ix]++; here seems to be redundant,
-*	as this end is accomplished in fill_tri_and_surface_lists.
-*	This may be TRUE only for the context I studied: I tried to
-*	eliminate this line but the run crashed; needs more study. --pinezich
+*	Pass tri_blocks, total_num_of_tri_blocks, and T as macro arguments.
 */
 
-#define Store_tri(ic,tri_blocks,total_num_of_tri_blocks,comp)		\
+#define Store_tri(ic,tri_blocks,total_num_of_tri_blocks,T)		\
 {									\
 	int ix = (ic)[0], iy = (ic)[1], iz = (ic)[2];			\
-	*((tri_blocks)++) = ix;						\
-	*((tri_blocks)++) = iy;						\
-	*((tri_blocks)++) = iz;						\
+	*((tri_blocks)++) = tri_block_id3d(T,ix,iy,iz);			\
 	++(total_num_of_tri_blocks);					\
-	++(num_of_tris)[iz][iy][ix];					\
-	(comp)[iz][iy][ix] = ONFRONT;					\
+	set_comp_of_block3d(T,ix,iy,iz,ONFRONT);			\
 }
 
 
@@ -2899,8 +3084,7 @@ LOCAL void fill_tri_and_surface_lists(
 
 LOCAL void blocks_on_tri(
 	TRI	  *t,
-	int	  ***num_of_tris,
-	COMPONENT ***comp,
+	struct Table *T,
 	RECT_GRID *grid,
 	INTERFACE *intfc)
 {
@@ -2963,7 +3147,7 @@ LOCAL void blocks_on_tri(
 	}
 
 	/*check if the array tri_blocks is out of range. */
-	tri_blocks_top += 3*i_diff[0]*i_diff[1]*i_diff[2] + 1;
+	tri_blocks_top += i_diff[0]*i_diff[1]*i_diff[2] + 1;
 	if(tri_blocks_top > tri_blocks_size)
 	{
 	    print_tri(t,intfc);
@@ -2984,7 +3168,7 @@ LOCAL void blocks_on_tri(
 		    if (ib[0] < 0 || ib[0] >= gmax[0]) continue;
 		    if (ib[1] < 0 || ib[1] >= gmax[1]) continue;
 		    if (ib[2] < 0 || ib[2] >= gmax[2]) continue;
-	    	    Store_tri(ib,tri_blocks,total_num_of_tri_blocks,comp);
+	    	    Store_tri(ib,tri_blocks,total_num_of_tri_blocks,T);
 	    	}
 	    }
 	}
@@ -2993,8 +3177,7 @@ LOCAL void blocks_on_tri(
 
 LOCAL void blocks_on_grid_based_tri(
 	TRI		*t,
-	int		***num_of_tris,
-	COMPONENT	***comp,
+	struct Table	*T,
 	RECT_GRID	*grid,
 	INTERFACE	*intfc)
 {
@@ -3031,7 +3214,7 @@ LOCAL void blocks_on_grid_based_tri(
             	return;
 	    }
 	}
-    	Store_tri(ib,tri_blocks,total_num_of_tri_blocks,comp);
+    	Store_tri(ib,tri_blocks,total_num_of_tri_blocks,T);
 	blocks = add_to_bls_list(blocks,ib,&num_bls,&MAX_BLS);
 	for (i = 0; i < 3; ++i)
 	{
@@ -3043,7 +3226,7 @@ LOCAL void blocks_on_grid_based_tri(
 		    /*if (ib[i] < -grid->lbuf[i])*/
 		    if (ib[i] < 0)
 			continue;
-    		    Store_tri(ib,tri_blocks,total_num_of_tri_blocks,comp);
+    		    Store_tri(ib,tri_blocks,total_num_of_tri_blocks,T);
 		    blocks = add_to_bls_list(blocks,ib,&num_bls,&MAX_BLS);
 		}
 		else if (fabs(p1[i] - (L[i] + (ib[i] + 1)*h[i])) < ctol)
@@ -3052,7 +3235,7 @@ LOCAL void blocks_on_grid_based_tri(
 		    /*if (ib[i] >= grid->gmax[i] + grid->ubuf[i])*/
 		    if (ib[i] >= grid->gmax[i])
 			continue;
-    		    Store_tri(ib,tri_blocks,total_num_of_tri_blocks,comp);
+    		    Store_tri(ib,tri_blocks,total_num_of_tri_blocks,T);
 		    blocks = add_to_bls_list(blocks,ib,&num_bls,&MAX_BLS);
 		}
 	    }
@@ -3230,10 +3413,7 @@ LOCAL void set_off_front_comp3d(
 	register int	ixmax, iymax, izmax;
 	register int	ixmin, iymin, izmin;
 	COMPONENT	c;
-	COMPONENT	**compon_iz;
-	COMPONENT	*compon_iziy;
-	COMPONENT	***compon = intfc->table->compon3d;
-	COMPONENT       **compk, *compj;
+	struct Table	*T = intfc->table;
 	RECT_GRID	*grid = &topological_grid(intfc);
 	double           p[MAXD];
 	int             ip[MAXD];
@@ -3273,13 +3453,12 @@ LOCAL void set_off_front_comp3d(
 	/* Set remaining interior cells */
 	for (iz = izmin; iz <= izmax; ++iz)
 	{
-	    compon_iz = compon[iz];
 	    for (iy = iymin; iy <= iymax; ++iy)
 	    {
-	    	compon_iziy = compon_iz[iy];
 	    	for (ix = ixmin; ix <= ixmax; ++ix)
 	    	{
-	    	    switch (compon_iziy[ix])
+		    c = Comp_of_block3d(T,ix,iy,iz);
+	    	    switch (c)
 	    	    {
 	    	    case ONFRONT:
 		    case ON_RECT_BOUNDARY:
@@ -3290,13 +3469,13 @@ LOCAL void set_off_front_comp3d(
 	    	        p[0] = cell_center(ix,0,grid);
 	    	        p[1] = cell_center(iy,1,grid);
 	    	        p[2] = cell_center(iz,2,grid);
-	    		compon_iziy[ix] = component_wrt_icoords3d(p,ip,intfc);
+	    		c = component_wrt_icoords3d(p,ip,intfc);
+			set_comp_of_block3d(T,ix,iy,iz,c);
 	        	break;
 	            }
 	            default:
 	            	break;
 	            }
-	            c = compon_iziy[ix];
 		    kmin = iz;
 		    kmax = min(izmax,iz+1);
 		    jmin = iy;
@@ -3305,102 +3484,62 @@ LOCAL void set_off_front_comp3d(
 		    imax = min(ixmax,ix+1);
 
 		    for (k = kmin; k <= kmax; ++k)
+		    for (j = jmin; j <= jmax; ++j)
+		    for (i = imin; i <= imax; ++i)
 		    {
-		      compk = compon[k];
-		      for (j = jmin; j <= jmax; ++j)
-		      {
-	    	        compj = compk[j];
-		        for (i = imin; i <= imax; ++i)
-		        {
-		          if (compj[i] == NO_COMP)
-		          {
-			    compj[i] = c;
-		          }
-		        }
-		      }
+		        if (Comp_of_block3d(T,i,j,k) == NO_COMP)
+			    set_comp_of_block3d(T,i,j,k,c);
 		    }
-
 		}
 	    }
+
+	    /* Tile layers behind the sweep are final, release their pages */
+	    if (((iz + 1) & TOPO_TILE_MASK) == 0)
+		compress_topo_tiles3d(T,iz >> TOPO_TILE_SHIFT,
+				      (iz >> TOPO_TILE_SHIFT) + 1);
 	}
 
 	if(!bdry_flag[2][0])
 	{
-	    compon_iz = compon[0];
 	    for (iy = 0; iy < ymax; ++iy)
-	    {
-	    	compon_iziy = compon_iz[iy];
-	        for (ix = 0; ix < xmax; ++ix)
-	        {
-	    	    if (compon_iziy[ix] == ON_RECT_BOUNDARY)
-			compon_iziy[ix] = ONFRONT;
-	        }
-	    }
+	    for (ix = 0; ix < xmax; ++ix)
+	    	if (Comp_of_block3d(T,ix,iy,0) == ON_RECT_BOUNDARY)
+		    set_comp_of_block3d(T,ix,iy,0,ONFRONT);
 	}
 	if(!bdry_flag[2][1])
 	{
-	    compon_iz = compon[zmax-1];
 	    for (iy = 0; iy < ymax; ++iy)
-	    {
-	    	compon_iziy = compon_iz[iy];
-	        for (ix = 0; ix < xmax; ++ix)
-	        {
-	    	    if (compon_iziy[ix] == ON_RECT_BOUNDARY)
-			compon_iziy[ix] = ONFRONT;
-	        }
-	    }
+	    for (ix = 0; ix < xmax; ++ix)
+	    	if (Comp_of_block3d(T,ix,iy,zmax-1) == ON_RECT_BOUNDARY)
+		    set_comp_of_block3d(T,ix,iy,zmax-1,ONFRONT);
 	}
 	if(!bdry_flag[1][0])
 	{
 	    for (iz = 0; iz < zmax; ++iz)
-	    {
-	        compon_iz = compon[iz];
-	    	compon_iziy = compon_iz[0];
-	        for (ix = 0; ix < xmax; ++ix)
-	        {
-	    	    if (compon_iziy[ix] == ON_RECT_BOUNDARY)
-			compon_iziy[ix] = ONFRONT;
-	        }
-	    }
+	    for (ix = 0; ix < xmax; ++ix)
+	    	if (Comp_of_block3d(T,ix,0,iz) == ON_RECT_BOUNDARY)
+		    set_comp_of_block3d(T,ix,0,iz,ONFRONT);
 	}
 	if(!bdry_flag[1][1])
 	{
 	    for (iz = 0; iz < zmax; ++iz)
-	    {
-	        compon_iz = compon[iz];
-	    	compon_iziy = compon_iz[ymax-1];
-	        for (ix = 0; ix < xmax; ++ix)
-	        {
-	    	    if (compon_iziy[ix] == ON_RECT_BOUNDARY)
-			compon_iziy[ix] = ONFRONT;
-	        }
-	    }
+	    for (ix = 0; ix < xmax; ++ix)
+	    	if (Comp_of_block3d(T,ix,ymax-1,iz) == ON_RECT_BOUNDARY)
+		    set_comp_of_block3d(T,ix,ymax-1,iz,ONFRONT);
 	}
 	if(!bdry_flag[0][0])
 	{
 	    for (iz = 0; iz < zmax; ++iz)
-	    {
-	        compon_iz = compon[iz];
-	        for (iy = 0; iy < ymax; ++iy)
-		{
-	    	    compon_iziy = compon_iz[iy];
-	    	    if (compon_iziy[0] == ON_RECT_BOUNDARY)
-			compon_iziy[0] = ONFRONT;
-		}
-	    }
+	    for (iy = 0; iy < ymax; ++iy)
+	    	if (Comp_of_block3d(T,0,iy,iz) == ON_RECT_BOUNDARY)
+		    set_comp_of_block3d(T,0,iy,iz,ONFRONT);
 	}
 	if(!bdry_flag[0][1])
 	{
 	    for (iz = 0; iz < zmax; ++iz)
-	    {
-	        compon_iz = compon[iz];
-	        for (iy = 0; iy < ymax; ++iy)
-		{
-	    	    compon_iziy = compon_iz[iy];
-	    	    if (compon_iziy[xmax-1] == ON_RECT_BOUNDARY)
-			compon_iziy[xmax-1] = ONFRONT;
-		}
-	    }
+	    for (iy = 0; iy < ymax; ++iy)
+	    	if (Comp_of_block3d(T,xmax-1,iy,iz) == ON_RECT_BOUNDARY)
+		    set_comp_of_block3d(T,xmax-1,iy,iz,ONFRONT);
 	}
 
 	if(bdry_flag[0][0])
@@ -3440,9 +3579,7 @@ LOCAL	void	set_x_face_comps(
 {
 	register int iymax, izmax;
 	COMPONENT    c;
-	COMPONENT    **compon_iz, **compon_izp1;
-	COMPONENT    *compon_iziy;
-	COMPONENT    ***compon = intfc->table->compon3d;
+	struct Table *T = intfc->table;
 	RECT_GRID    *grid = &topological_grid(intfc);
 	int	     iy, iz;
 	int          ip[MAXD];
@@ -3451,12 +3588,10 @@ LOCAL	void	set_x_face_comps(
 
 	for (iz = 0; iz <=  izmax; ++iz)
 	{
-	    compon_iz = compon[iz];
-	    compon_izp1 = (iz < izmax) ? compon[iz + 1] : NULL;
 	    for (iy = 0; iy <= iymax; ++iy)
 	    {
-	        compon_iziy = compon_iz[iy];
-	        switch (compon_iziy[ix])
+	        c = Comp_of_block3d(T,ix,iy,iz);
+	        switch (c)
 	        {
 	        case ONFRONT:
 	            continue;
@@ -3464,21 +3599,20 @@ LOCAL	void	set_x_face_comps(
 		case ON_RECT_BOUNDARY:
 	            ip[0] = ix; ip[1] = iy; ip[2] = iz;
 	            c = set_comp_on_block(ip,intfc);
-	            compon_iziy[ix] = c;
+	            set_comp_of_block3d(T,ix,iy,iz,c);
 	            if (c == ONFRONT)
 			continue;
 	            break;
 	        default:
 	            break;
 	        }
-	        c = compon_iziy[ix];
-	        if (iz < izmax && (compon_izp1[iy][ix] == NO_COMP))
-    	            compon_izp1[iy][ix] = c;
-	        if (iy < iymax && (compon_iz[iy+1][ix] == NO_COMP))
-	            compon_iz[iy + 1][ix] = c;
+	        if (iz < izmax && (Comp_of_block3d(T,ix,iy,iz+1) == NO_COMP))
+    	            set_comp_of_block3d(T,ix,iy,iz+1,c);
+	        if (iy < iymax && (Comp_of_block3d(T,ix,iy+1,iz) == NO_COMP))
+	            set_comp_of_block3d(T,ix,iy+1,iz,c);
 	        if (iy < iymax && iz < izmax &&
-	                (compon_izp1[iy + 1][ix] == NO_COMP))
-	            compon_izp1[iy + 1][ix] = c;
+	                (Comp_of_block3d(T,ix,iy+1,iz+1) == NO_COMP))
+	            set_comp_of_block3d(T,ix,iy+1,iz+1,c);
 	    }
 	}
 }		/*end set_x_face_comps*/
@@ -3489,9 +3623,7 @@ LOCAL	void	set_y_face_comps(
 {
 	register int ixmax, izmax;
 	COMPONENT    c;
-	COMPONENT    **compon_iz, **compon_izp1;
-	COMPONENT    *compon_iziy;
-	COMPONENT    ***compon = intfc->table->compon3d;
+	struct Table *T = intfc->table;
 	RECT_GRID    *grid = &topological_grid(intfc);
 	int	    ix, iz;
 	int         ip[MAXD];
@@ -3500,12 +3632,10 @@ LOCAL	void	set_y_face_comps(
 
 	for (iz = 0; iz <=  izmax; ++iz)
 	{
-	    compon_iz = compon[iz];
-	    compon_izp1 = (iz < izmax) ? compon[iz + 1] : NULL;
-	    compon_iziy = compon_iz[iy];
 	    for (ix = 1; ix <= ixmax; ++ix)
 	    {
-	        switch (compon_iziy[ix])
+	        c = Comp_of_block3d(T,ix,iy,iz);
+	        switch (c)
 	        {
 	        case ONFRONT:
 	            continue;
@@ -3513,21 +3643,20 @@ LOCAL	void	set_y_face_comps(
 		case ON_RECT_BOUNDARY:
 	            ip[0] = ix; ip[1] = iy; ip[2] = iz;
 	            c = set_comp_on_block(ip,intfc);
-	            compon_iziy[ix] = c;
+	            set_comp_of_block3d(T,ix,iy,iz,c);
 	            if (c == ONFRONT)
 			continue;
 	            break;
 	        default:
 	            break;
 	        }
-	        c = compon_iziy[ix];
-	        if (iz < izmax && (compon_izp1[iy][ix] == NO_COMP))
-	            compon_izp1[iy][ix] = c;
-	        if (ix < ixmax && (compon_iziy[ix + 1] == NO_COMP))
-	            compon_iz[iy][ix + 1] = c;
+	        if (iz < izmax && (Comp_of_block3d(T,ix,iy,iz+1) == NO_COMP))
+	            set_comp_of_block3d(T,ix,iy,iz+1,c);
+	        if (ix < ixmax && (Comp_of_block3d(T,ix+1,iy,iz) == NO_COMP))
+	            set_comp_of_block3d(T,ix+1,iy,iz,c);
 	        if (iz < izmax && ix < ixmax &&
-	                (compon_izp1[iy][ix + 1] == NO_COMP))
-	            compon_izp1[iy][ix + 1] = c;
+	                (Comp_of_block3d(T,ix+1,iy,iz+1) == NO_COMP))
+	            set_comp_of_block3d(T,ix+1,iy,iz+1,c);
 	    }
 	}
 }		/*end set_y_face_comps*/
@@ -3538,22 +3667,19 @@ LOCAL	void	set_z_face_comps(
 {
 	register int ixmax, iymax;
 	COMPONENT    c;
-	COMPONENT    **compon_iz;
-	COMPONENT    *compon_iziy;
-	COMPONENT    ***compon = intfc->table->compon3d;
+	struct Table *T = intfc->table;
 	RECT_GRID    *grid = &topological_grid(intfc);
 	int	    ix, iy;
 	int         ip[MAXD];
 
 	ixmax = grid->gmax[0]-2;	iymax = grid->gmax[1]-2;
 
-	compon_iz = compon[iz];
 	for (iy = 1; iy <=  iymax; ++iy)
 	{
-	    compon_iziy = compon_iz[iy];
 	    for (ix = 1; ix <= ixmax; ++ix)
 	    {
-	        switch (compon_iziy[ix])
+	        c = Comp_of_block3d(T,ix,iy,iz);
+	        switch (c)
 	        {
 	        case ONFRONT:
 	            continue;
@@ -3561,21 +3687,20 @@ LOCAL	void	set_z_face_comps(
 		case ON_RECT_BOUNDARY:
 	            ip[0] = ix; ip[1] = iy; ip[2] = iz;
 	            c = set_comp_on_block(ip,intfc);
-	            compon_iziy[ix] = c;
+	            set_comp_of_block3d(T,ix,iy,iz,c);
 	            if (c == ONFRONT)
 			continue;
 	            break;
 	        default:
 	            break;
 	        }
-	        c = compon_iziy[ix];
-	        if (iy < iymax && (compon_iz[iy+1][ix] == NO_COMP))
-	            compon_iz[iy + 1][ix] = c;
-	        if (ix < ixmax && (compon_iziy[ix + 1] == NO_COMP))
-	            compon_iz[iy][ix + 1] = c;
+	        if (iy < iymax && (Comp_of_block3d(T,ix,iy+1,iz) == NO_COMP))
+	            set_comp_of_block3d(T,ix,iy+1,iz,c);
+	        if (ix < ixmax && (Comp_of_block3d(T,ix+1,iy,iz) == NO_COMP))
+	            set_comp_of_block3d(T,ix+1,iy,iz,c);
 	        if (ix < ixmax && iy < iymax &&
-	                (compon_iz[iy + 1][ix + 1] == NO_COMP))
-	            compon_iz[iy + 1][ix + 1] = c;
+	                (Comp_of_block3d(T,ix+1,iy+1,iz) == NO_COMP))
+	            set_comp_of_block3d(T,ix+1,iy+1,iz,c);
 	    }
 	}
 }		/*end set_z_face_comps*/
@@ -3599,7 +3724,7 @@ LOCAL COMPONENT set_comp_on_block(
 	INTERFACE	*intfc)
 {
 	COMPONENT	c, c_last;
-	COMPONENT	***compon;
+	struct Table	*T;
 	RECT_GRID	*grid;
 	double		pn[3];
 	int		xmax, ymax, zmax;
@@ -3607,7 +3732,7 @@ LOCAL COMPONENT set_comp_on_block(
 	int		ixmin, ixmax, iymin, iymax, izmin, izmax;
 	int		ipn[3];
 
-	compon = intfc->table->compon3d;
+	T = intfc->table;
 	grid = &topological_grid(intfc);
 	xmax = grid->gmax[0]; ymax = grid->gmax[1]; zmax = grid->gmax[2];
 	izmin = ip[2]-1;	izmin = max(0,izmin);
@@ -3630,7 +3755,8 @@ LOCAL COMPONENT set_comp_on_block(
 	        {
 	            ipn[0] = ix;
 	            pn[0] = cell_center(ix,0,grid);
-	            switch (compon[iz][iy][ix])
+	            c = Comp_of_block3d(T,ix,iy,iz);
+	            switch (c)
 	            {
 	            case ONFRONT:
 		    case ON_RECT_BOUNDARY:
@@ -3639,7 +3765,6 @@ LOCAL COMPONENT set_comp_on_block(
 	                c = component_wrt_icoords3d(pn,ipn,intfc);
 	                break;
 	            default:
-	                c = compon[iz][iy][ix];
 	                break;
 	            }
 	            if (c_last == NO_COMP)
@@ -3684,7 +3809,7 @@ LIB_LOCAL void show_COMP_3d(
 	        for (ix = 0; ix < ixmax; ++ix)
 		{
 		    
-		    comp = intfc->table->compon3d[iz][iy][ix];
+		    comp = Comp_of_block3d(intfc->table,ix,iy,iz);
 		    switch (comp)
 		    {
 		    case ONFRONT:
@@ -3731,7 +3856,7 @@ LOCAL void show_TRI_list(
 	    for (iy = iymax - 1; iy >= 0; --iy)
 	    {
 	        for (ix = 0; ix < ixmax; ++ix)
-	            (void) printf("%3d ",intfc->table->num_of_tris[iz][iy][ix]);
+	            (void) printf("%3d ",Num_tris_in_block3d(intfc->table,ix,iy,iz));
 	        (void) printf("\n");
 	    }
 	    (void) printf("\n\n");
@@ -4172,10 +4297,10 @@ LOCAL COMPONENT comp_from_line_tri(
 	    {
 	        for (ix = ixmin; ix <= ixmax; ++ix)
 		{
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 			continue;
-	            t = T->tris[iz][iy][ix];
-	            nt = T->num_of_tris[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            nt = Num_tris_in_block3d(T,ix,iy,iz);
 
 	            for (i = 0; i < nt; ++i)
 		    {
@@ -4189,7 +4314,7 @@ LOCAL COMPONENT comp_from_line_tri(
 			        dist = dist0;
 				ft_assign(crx, crx0, 3*FLOAT);
 				tri = t[i];
-				s = T->surfaces[iz][iy][ix][i];
+				s = Surfs_in_block3d(T,ix,iy,iz)[i];
 			    }
 		        }
 		    } /* for nt */
@@ -4251,10 +4376,10 @@ LOCAL COMPONENT component_wrt_icoords3d_vertex(
 	    {
 	        for (ix = ixmin; ix <= ixmax; ++ix)
 		{
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 			continue;
-	            t = T->tris[iz][iy][ix];
-	            nt = T->num_of_tris[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            nt = Num_tris_in_block3d(T,ix,iy,iz);
 
 	            for (i = 0; i < nt; ++i)
 			Tri_projection_computed(t[i]) = NO;
@@ -4269,12 +4394,12 @@ LOCAL COMPONENT component_wrt_icoords3d_vertex(
 	    {
 	        for (ix = ixmin; ix <= ixmax; ++ix)
 		{
-	            if (T->compon3d[iz][iy][ix] != ONFRONT)
+	            if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 			continue;
 
-	            t = T->tris[iz][iy][ix];
-	            nt = T->num_of_tris[iz][iy][ix];
-	            s = T->surfaces[iz][iy][ix];
+	            t = Tris_in_block3d(T,ix,iy,iz);
+	            nt = Num_tris_in_block3d(T,ix,iy,iz);
+	            s = Surfs_in_block3d(T,ix,iy,iz);
 
 	            for (i = 0; i < nt; ++i)
 	            {
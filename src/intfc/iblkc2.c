@@ -39,11 +39,15 @@ LOCAL	BBI_POINT *crx_in_idir(const BLK_CRX*,int,int);
 LOCAL	BBI_POINT *crx_in_jdir(const BLK_CRX*,int,int);
 LOCAL	BBI_POINT *crx_in_kdir(const BLK_CRX*,int,int);
 LOCAL	BBI_POINT *crxing_in_between(const int*,const int*,const BLK_CRX*);
-LOCAL   int compare_comp(COMPONENT***,COMPONENT****,int);
 LOCAL	void copy_blk_crx(const BLK_CRX*,BLK_CRX*);
+LOCAL	int comp2_blk_crxs(BLK_CRX*,BBI_POINT**);
+LOCAL	void comp2_triangle(BLK_TRI*,POINT*,POINT*,POINT*,SURFACE*);
+LOCAL	void stitch_comp2_blk(BLK_TRI*,int);
 LOCAL	void remove_null_pair_of_surface(BLK_TRI*,BLK_TRI*,int,int,int);
 LOCAL	void set_prime_components(COMPONENT****);
 LOCAL   void rot24(BLK_CRX*, int);
+LOCAL	void make_comp2_case_table(COMPONENT****,BLK_CRX*);
+LOCAL	int find_comp2_case(BLK_CRX*);
 LOCAL   void x_rotation(BLK_CRX*);
 LOCAL   void y_rotation(BLK_CRX*);
 LOCAL   void z_rotation(BLK_CRX*);
@@ -144,6 +148,59 @@ LOCAL	double volume_hexagon_p6_case14(BLK_CRX*,double*,double*,double*,double*,
 					double*); 
 
 
+/*
+*	The case of a block is looked up by the signature of its corner
+*	components as set by copy_blk_crx(), bit 4*i+2*j+k for corner
+*	[i][j][k].  The entry is case + BLK_CASE_ROT*n, where n is the
+*	number of rot24() steps that bring the block to the prime case, or
+*	-1.  It is made once from the prime cases and replaces the search
+*	over the rotations for every block.  comp2_rot_perm[n][c] is the
+*	corner moved to corner c by the first n steps.
+*/
+
+enum {
+	NUM_COMP2_SIG	= 256,
+	BLK_CASE_ROT	= 64
+};
+
+LOCAL	int	comp2_case[NUM_COMP2_SIG];
+LOCAL	int	comp2_rot_perm[25][8];
+
+LOCAL	COMPONENT	****prime_comp = NULL;
+LOCAL	BLK_CRX		*bc_rot = NULL;
+LOCAL	void	(*blk_intfc_comp2[14])(BLK_CRX*,BLK_TRI*) =
+{
+	blk_case01_comp2,
+	blk_case02_comp2,
+	blk_case03_comp2,
+	blk_case04_comp2,
+	blk_case05_comp2,
+	blk_case06_comp2,
+	blk_case07_comp2,
+	blk_case08_comp2,
+	blk_case09_comp2,
+	blk_case10_comp2,
+	blk_case11_comp2,
+	blk_case12_comp2,
+	blk_case13_comp2,
+	blk_case14_comp2,
+};
+
+/*
+*	Makes the case table.  It is called by construct_comp2_blk(), and
+*	must be called before record_comp2_blk() is used by several threads.
+*/
+
+EXPORT	void init_comp2_blk_cases(void)
+{
+	if (prime_comp != NULL)
+	    return;
+	quad_array(&prime_comp,14,2,2,2,sizeof(COMPONENT));
+	set_prime_components(prime_comp);
+	bc_rot = alloc_blk_crx(NO);
+	make_comp2_case_table(prime_comp,bc_rot);
+}	/* end init_comp2_blk_cases */
+
 EXPORT	int construct_comp2_blk(
 	BLK_CRX *blk_crx,
 	BLK_TRI *blk_mem)
@@ -152,82 +209,15 @@ EXPORT	int construct_comp2_blk(
 	COMPONENT ***comp = blk_crx->comp;
 	int       num_crx, case_found;
 	BBI_POINT *crxs[12];
-	static COMPONENT ****prime_comp;
-	static BLK_CRX *bc_rot;
-	void (*blk_intfc_comp2[14])(BLK_CRX*, BLK_TRI*) =
-	{
-	    blk_case01_comp2,
-	    blk_case02_comp2,
-	    blk_case03_comp2,
-	    blk_case04_comp2,
-	    blk_case05_comp2,
-	    blk_case06_comp2,
-	    blk_case07_comp2,
-	    blk_case08_comp2,
-	    blk_case09_comp2,
-	    blk_case10_comp2,
-	    blk_case11_comp2,
-	    blk_case12_comp2,
-	    blk_case13_comp2,
-	    blk_case14_comp2,
-	};
-
-	if (prime_comp == NULL)
-	{
-	    quad_array(&prime_comp,14,2,2,2,sizeof(COMPONENT));
-	    set_prime_components(prime_comp);
-	}
+
+	init_comp2_blk_cases();
 
 	blk_mem->num_surfaces = 1;
 	blk_mem->num_curves = 0;
-	num_crx = 0;
-	for (j = 0; j < 2; ++j)
-	{
-	    for (k = 0; k < 2; ++k)
-	    {
-	        if (comp[0][j][k] != comp[1][j][k])
-	        {
-	            crxs[num_crx] = crx_in_idir(blk_crx,j,k);
-	            if (crxs[num_crx] == NULL)
-		    {
-	                return FUNCTION_FAILED;
-		    }
-	            ++num_crx;
-	        }
-	    }
-	}
-
-	for (k = 0; k < 2; ++k)
-	{
-	    for (i = 0; i < 2; ++i)
-	    {
-	        if (comp[i][0][k] != comp[i][1][k])
-	        {
-	            crxs[num_crx] = crx_in_jdir(blk_crx,k,i);
-	            if (crxs[num_crx] == NULL)
-		    {
-	                return FUNCTION_FAILED;
-		    }
-	            ++num_crx;
-	        }
-	    }
-	}
-
-	for (i = 0; i < 2; ++i)
-	{
-	    for (j = 0; j < 2; ++j)
-	    {
-	        if (comp[i][j][0] != comp[i][j][1])
-	        {
-	            crxs[num_crx] = crx_in_kdir(blk_crx,i,j);
-	            if (crxs[num_crx] == NULL)
-		    {
-	                return FUNCTION_FAILED;
-		    }
-	            ++num_crx;
-	        }
-	    }
-	}
+	blk_mem->record_tris = NO;
+	num_crx = comp2_blk_crxs(blk_crx,crxs);
+	if (num_crx < 0)
+	    return FUNCTION_FAILED;
 	if (num_crx == 0)
 	{
 	    /* No interface, but ONFRONT, this happens */
@@ -273,25 +263,13 @@ EXPORT	int construct_comp2_blk(
 	blk_mem->first[is] = NULL;
 	blk_mem->num_tris[is] = 0;
 	blk_mem->surfs[is] = crxs[0]->s;
-	if (bc_rot == NULL) bc_rot = alloc_blk_crx(NO);
 	copy_blk_crx(blk_crx, bc_rot);
 
-	/* begin 24-rotation */
-	
 	case_found = NO;
-	for (j = 0; j <= 24; j++)
+	if ((i = find_comp2_case(bc_rot)) >= 0)
 	{
-	    for (i = 0; i < 14; i++)
-	    {
-	        if (compare_comp(bc_rot->comp, prime_comp, i)) 
-	        { 
-	            blk_intfc_comp2[i](bc_rot, blk_mem);
-		    case_found = YES;
-	            break;
-	        }
-	    }
-	    if (case_found == YES) break;
-	    rot24(bc_rot, j);
+	    blk_intfc_comp2[i](bc_rot, blk_mem);
+	    case_found = YES;
 	}
 
 	if (case_found == NO)
@@ -306,6 +284,160 @@ EXPORT	int construct_comp2_blk(
 	    }
 	}
 
+	stitch_comp2_blk(blk_mem,is);
+	return FUNCTION_SUCCEEDED;
+}	/* end reconstruct_blk_intfc */
+
+/*
+*	The first half of construct_comp2_blk() for a block loop run by
+*	several threads: finds the case of the block with the scratch
+*	bc_rot of the calling thread, sets the area and volume fraction,
+*	and records the triangles in blk_mem instead of making them.  It
+*	changes nothing outside blk_mem.  emit_comp2_blk() makes and
+*	stitches the triangles in the order of the serial loop.  Returns
+*	NO, with nothing recorded, for a block that construct_comp2_blk()
+*	must handle: missing crossings, several surfaces or no case.
+*/
+
+EXPORT	boolean record_comp2_blk(
+	BLK_CRX *blk_crx,
+	BLK_TRI *blk_mem,
+	BLK_CRX *bc_rot)
+{
+	int       i,is;
+	int       num_crx;
+	BBI_POINT *crxs[12];
+
+	blk_mem->num_surfaces = 1;
+	blk_mem->num_curves = 0;
+	blk_mem->record_tris = NO;
+	num_crx = comp2_blk_crxs(blk_crx,crxs);
+	if (num_crx <= 0)
+	    return NO;
+	for (i = 1; i < num_crx; ++i)
+	    if (crxs[i]->s != crxs[0]->s)
+		return NO;
+	if (blk_crx->nv[0] > 4)
+	    return NO;
+
+	copy_blk_crx(blk_crx,bc_rot);
+	if ((i = find_comp2_case(bc_rot)) < 0)
+	    return NO;
+	is = is_surface(blk_crx,crxs[0]->s);
+	blk_mem->first[is] = NULL;
+	blk_mem->num_tris[is] = 0;
+	blk_mem->surfs[is] = crxs[0]->s;
+	blk_mem->record_tris = YES;
+	blk_mem->num_rec_tris = 0;
+	blk_intfc_comp2[i](bc_rot,blk_mem);
+	blk_mem->record_tris = NO;
+	return (blk_mem->num_rec_tris <= MAX_BLK_REC_TRIS) ? YES : NO;
+}	/* end record_comp2_blk */
+
+EXPORT	void emit_comp2_blk(
+	BLK_TRI *blk_mem)
+{
+	int	i;
+
+	for (i = 0; i < blk_mem->num_rec_tris; ++i)
+	    create_triangle(blk_mem,blk_mem->rec_tris[i][0],
+			    blk_mem->rec_tris[i][1],blk_mem->rec_tris[i][2],
+			    blk_mem->rec_surfs[i]);
+	/* The case routines set is[0] to the surface of the block */
+	stitch_comp2_blk(blk_mem,blk_mem->is[0]);
+}	/* end emit_comp2_blk */
+
+LOCAL	void comp2_triangle(
+	BLK_TRI *blk_mem,
+	POINT   *p1,
+	POINT   *p2,
+	POINT   *p3,
+	SURFACE *s)
+{
+	int	n = blk_mem->num_rec_tris;
+
+	if (!blk_mem->record_tris)
+	{
+	    create_triangle(blk_mem,p1,p2,p3,s);
+	    return;
+	}
+	if (n < MAX_BLK_REC_TRIS)
+	{
+	    blk_mem->rec_tris[n][0] = p1;
+	    blk_mem->rec_tris[n][1] = p2;
+	    blk_mem->rec_tris[n][2] = p3;
+	    blk_mem->rec_surfs[n] = s;
+	}
+	blk_mem->num_rec_tris = n + 1;
+}	/* end comp2_triangle */
+
+/*
+*	Collects the crossings of the block edges, returns their number,
+*	or -1 if one is missing.
+*/
+
+LOCAL	int comp2_blk_crxs(
+	BLK_CRX   *blk_crx,
+	BBI_POINT **crxs)
+{
+	int       i,j,k;
+	COMPONENT ***comp = blk_crx->comp;
+	int       num_crx = 0;
+
+	for (j = 0; j < 2; ++j)
+	{
+	    for (k = 0; k < 2; ++k)
+	    {
+	        if (comp[0][j][k] != comp[1][j][k])
+	        {
+	            crxs[num_crx] = crx_in_idir(blk_crx,j,k);
+	            if (crxs[num_crx] == NULL)
+		    {
+	                return -1;
+		    }
+	            ++num_crx;
+	        }
+	    }
+	}
+
+	for (k = 0; k < 2; ++k)
+	{
+	    for (i = 0; i < 2; ++i)
+	    {
+	        if (comp[i][0][k] != comp[i][1][k])
+	        {
+	            crxs[num_crx] = crx_in_jdir(blk_crx,k,i);
+	            if (crxs[num_crx] == NULL)
+		    {
+	                return -1;
+		    }
+	            ++num_crx;
+	        }
+	    }
+	}
+
+	for (i = 0; i < 2; ++i)
+	{
+	    for (j = 0; j < 2; ++j)
+	    {
+	        if (comp[i][j][0] != comp[i][j][1])
+	        {
+	            crxs[num_crx] = crx_in_kdir(blk_crx,i,j);
+	            if (crxs[num_crx] == NULL)
+		    {
+	                return -1;
+		    }
+	            ++num_crx;
+	        }
+	    }
+	}
+	return num_crx;
+}	/* end comp2_blk_crxs */
+
+LOCAL	void stitch_comp2_blk(
+	BLK_TRI *blk_mem,
+	int	is)
+{
 	blk_mem->num_null_sides[is] = 3*blk_mem->num_tris[is];
 
 	if (debugging("print_blk_tri"))
@@ -323,9 +455,7 @@ EXPORT	int construct_comp2_blk(
 			  "printing blk_mem AFTER stitching inside.\n" );
 	    print_blk_tri(blk_mem);
 	}
-
-	return FUNCTION_SUCCEEDED;
-}	/* end reconstruct_blk_intfc */
+}	/* end stitch_comp2_blk */
 
 
 
@@ -988,23 +1118,6 @@ EXPORT	ORIENTATION curve_surface_orientation(
 	    return ORIENTATION_NOT_SET;
 }	/* end curve_surface_orientation */
 
-LOCAL   int compare_comp(
-	COMPONENT ***comp,
-	COMPONENT ****p_comp,
-	int ii)
-{
-	int i,j,k;
-        
-	for (i = 0; i < 2; i++)
-	for (j = 0; j < 2; j++)
-        for (k = 0; k < 2; k++) 
-	if (comp[i][j][k] != p_comp[ii][i][j][k])
-	{
-            return NO; 
-	}
-	return YES; 
-}       /* end compare_comp */
-
 LOCAL	void set_prime_components(
 	COMPONENT ****pcomp)
 {
@@ -1163,6 +1276,86 @@ LOCAL	void set_prime_components(
 	pcomp[13][1][1][1] = 1;
 }	/* end set_prime_components */
 
+/*
+*	Fills comp2_rot_perm[] by following the corners through rot24() on
+*	bc_rot, then comp2_case[] with the first case and the fewest steps
+*	matching each signature, the order of the former search.
+*/
+
+LOCAL	void make_comp2_case_table(
+	COMPONENT ****prime_comp,
+	BLK_CRX *bc_rot)
+{
+	int i,j,k,c,n,sig;
+
+	for (c = 0; c < 8; ++c)
+	    bc_rot->comp[c>>2][(c>>1)&1][c&1] = c;
+	for (n = 0; n <= 24; ++n)
+	{
+	    for (c = 0; c < 8; ++c)
+		comp2_rot_perm[n][c] = bc_rot->comp[c>>2][(c>>1)&1][c&1];
+	    rot24(bc_rot,n);
+	}
+
+	for (sig = 0; sig < NUM_COMP2_SIG; ++sig)
+	    comp2_case[sig] = -1;
+	for (n = 0; n <= 24; ++n)
+	for (k = 0; k < 14; ++k)
+	{
+	    sig = 0;
+	    for (c = 0; c < 8; ++c)
+	    {
+		i = c >> 2;
+		j = (c >> 1) & 1;
+		if (prime_comp[k][i][j][c&1])
+		    sig |= 1 << comp2_rot_perm[n][c];
+	    }
+	    if (comp2_case[sig] < 0)
+		comp2_case[sig] = k + BLK_CASE_ROT*n;
+	}
+}	/* end make_comp2_case_table */
+
+/*
+*	Rotates bc_rot to its prime case and returns the case, or -1.
+*/
+
+LOCAL	int find_comp2_case(
+	BLK_CRX *bc_rot)
+{
+	int ***ix = bc_rot->ix;
+	int ***iy = bc_rot->iy;
+	int ***iz = bc_rot->iz;
+	COMPONENT ***comp = bc_rot->comp;
+	COMPONENT comp_tmp[8];
+	int ix_tmp[8],iy_tmp[8],iz_tmp[8];
+	int c,m,icase,sig;
+	const int *perm;
+
+	sig = 0;
+	for (c = 0; c < 8; ++c)
+	    if (comp[c>>2][(c>>1)&1][c&1])
+		sig |= 1 << c;
+	if ((icase = comp2_case[sig]) < 0)
+	    return -1;
+	perm = comp2_rot_perm[icase/BLK_CASE_ROT];
+	for (c = 0; c < 8; ++c)
+	{
+	    comp_tmp[c] = comp[c>>2][(c>>1)&1][c&1];
+	    ix_tmp[c] = ix[c>>2][(c>>1)&1][c&1];
+	    iy_tmp[c] = iy[c>>2][(c>>1)&1][c&1];
+	    iz_tmp[c] = iz[c>>2][(c>>1)&1][c&1];
+	}
+	for (c = 0; c < 8; ++c)
+	{
+	    m = perm[c];
+	    comp[c>>2][(c>>1)&1][c&1] = comp_tmp[m];
+	    ix[c>>2][(c>>1)&1][c&1] = ix_tmp[m];
+	    iy[c>>2][(c>>1)&1][c&1] = iy_tmp[m];
+	    iz[c>>2][(c>>1)&1][c&1] = iz_tmp[m];
+	}
+	return icase%BLK_CASE_ROT;
+}	/* end find_comp2_case */
+
 EXPORT	void copy_blk_crx(
 	const BLK_CRX *blk_crx1,
 	BLK_CRX       *blk_crx2)
@@ -1355,13 +1548,13 @@ LOCAL void blk_case01_comp2(
 
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p2,p4,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p2,p4,p3,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p2,p3,p4,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p2,p3,p4,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -1440,13 +1633,13 @@ LOCAL void blk_case02_comp2(
 	p4 = crx_in_jdir(blk_crx,0,1)->p;
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p3,p2,p4,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p3,p2,p4,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p3,p4,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p3,p4,p2,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -1523,9 +1716,9 @@ LOCAL   void blk_case03_comp2(
         p2 = crx_in_jdir(blk_crx,1,1)->p; 
         p3 = crx_in_kdir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
 	else
@@ -1601,15 +1794,15 @@ LOCAL void blk_case04_comp2(
 	p5 = crx_in_idir(blk_crx,0,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p3,p2,p4,s);
-	    create_triangle(blk_mem,p2,p5,p4,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p3,p2,p4,s);
+	    comp2_triangle(blk_mem,p2,p5,p4,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p3,p4,p2,s);
-	    create_triangle(blk_mem,p2,p4,p5,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p3,p4,p2,s);
+	    comp2_triangle(blk_mem,p2,p4,p5,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -1693,17 +1886,17 @@ LOCAL void blk_case05_comp2(
 	p6 = crx_in_jdir(blk_crx,1,0)->p;
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p1,p4,p2,s);
-	    create_triangle(blk_mem,p4,p5,p2,s);
-	    create_triangle(blk_mem,p4,p6,p5,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p4,p2,s);
+	    comp2_triangle(blk_mem,p4,p5,p2,s);
+	    comp2_triangle(blk_mem,p4,p6,p5,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p1,p2,p4,s);
-	    create_triangle(blk_mem,p4,p2,p5,s);
-	    create_triangle(blk_mem,p4,p5,p6,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p2,p4,s);
+	    comp2_triangle(blk_mem,p4,p2,p5,s);
+	    comp2_triangle(blk_mem,p4,p5,p6,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -1787,9 +1980,9 @@ LOCAL void blk_case06_comp2(
         p2 = crx_in_kdir(blk_crx,1,1)->p; 
         p3 = crx_in_jdir(blk_crx,0,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/*  the second corner_tri  */
         
@@ -1797,9 +1990,9 @@ LOCAL void blk_case06_comp2(
         p2 = crx_in_idir(blk_crx,0,1)->p; 
         p3 = crx_in_kdir(blk_crx,1,0)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
 	else
@@ -1869,17 +2062,17 @@ LOCAL void blk_case07_comp2(
 	p6 = crx_in_idir(blk_crx,0,0)->p;
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p3,p2,p4,s);
-	    create_triangle(blk_mem,p3,p4,p5,s);
-	    create_triangle(blk_mem,p5,p4,p6,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p3,p2,p4,s);
+	    comp2_triangle(blk_mem,p3,p4,p5,s);
+	    comp2_triangle(blk_mem,p5,p4,p6,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p3,p4,p2,s);
-	    create_triangle(blk_mem,p3,p5,p4,s);
-	    create_triangle(blk_mem,p5,p6,p4,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p3,p4,p2,s);
+	    comp2_triangle(blk_mem,p3,p5,p4,s);
+	    comp2_triangle(blk_mem,p5,p6,p4,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -1945,9 +2138,9 @@ LOCAL void blk_case08_comp2(
         p2 = crx_in_kdir(blk_crx,1,0)->p; 
         p3 = crx_in_idir(blk_crx,0,0)->p;
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/* one float_tri */
 
@@ -1957,13 +2150,13 @@ LOCAL void blk_case08_comp2(
 	p4 = crx_in_jdir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p3,p2,p4,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p3,p2,p4,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p3,p4,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p3,p4,p2,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -2030,9 +2223,9 @@ LOCAL void blk_case09_comp2(
         p2 = crx_in_kdir(blk_crx,1,0)->p;
         p3 = crx_in_idir(blk_crx,0,0)->p;
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/* the second corner_tri */
 
@@ -2040,9 +2233,9 @@ LOCAL void blk_case09_comp2(
         p2 = crx_in_jdir(blk_crx,1,0)->p; 
         p3 = crx_in_idir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
 	else
@@ -2112,17 +2305,17 @@ LOCAL void blk_case10_comp2(
 	p6 = crx_in_jdir(blk_crx,1,0)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p1,p4,p2,s);
-	    create_triangle(blk_mem,p1,p5,p4,s);
-	    create_triangle(blk_mem,p5,p6,p4,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p4,p2,s);
+	    comp2_triangle(blk_mem,p1,p5,p4,s);
+	    comp2_triangle(blk_mem,p5,p6,p4,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p1,p2,p4,s);
-	    create_triangle(blk_mem,p1,p4,p5,s);
-	    create_triangle(blk_mem,p5,p4,p6,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p2,p4,s);
+	    comp2_triangle(blk_mem,p1,p4,p5,s);
+	    comp2_triangle(blk_mem,p5,p4,p6,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -2191,13 +2384,13 @@ LOCAL void blk_case11_comp2(
 	p4 = crx_in_idir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p4,p1,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p4,p1,p3,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p4,p3,p1,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p4,p3,p1,s);
 	}
 
 	/* the second float_tri */
@@ -2208,13 +2401,13 @@ LOCAL void blk_case11_comp2(
 	p4 = crx_in_jdir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p1,p4,p2,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p4,p2,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p1,p2,p4,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p2,p4,s);
 	}
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
@@ -2293,9 +2486,9 @@ LOCAL void blk_case12_comp2(
         p2 = crx_in_kdir(blk_crx,1,1)->p; 
         p3 = crx_in_jdir(blk_crx,0,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/* the second corner_tri */
 
@@ -2303,9 +2496,9 @@ LOCAL void blk_case12_comp2(
         p2 = crx_in_jdir(blk_crx,1,0)->p; 
         p3 = crx_in_idir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/* the third corner_tri */
 	
@@ -2313,9 +2506,9 @@ LOCAL void blk_case12_comp2(
         p2 = crx_in_idir(blk_crx,0,1)->p; 
         p3 = crx_in_kdir(blk_crx,1,0)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
 	else
@@ -2396,15 +2589,15 @@ LOCAL void blk_case13_comp2(
 	p5 = crx_in_idir(blk_crx,0,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
 	{
-	    create_triangle(blk_mem,p1,p2,p3,s);
-	    create_triangle(blk_mem,p2,p4,p3,s);
-	    create_triangle(blk_mem,p4,p5,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p2,p4,p3,s);
+	    comp2_triangle(blk_mem,p4,p5,p3,s);
 	}
 	else
 	{
-	    create_triangle(blk_mem,p1,p3,p2,s);
-	    create_triangle(blk_mem,p2,p3,p4,s);
-	    create_triangle(blk_mem,p4,p3,p5,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p2,p3,p4,s);
+	    comp2_triangle(blk_mem,p4,p3,p5,s);
 	}
 
 	/* one corner_tri */
@@ -2413,9 +2606,9 @@ LOCAL void blk_case13_comp2(
         p2 = crx_in_jdir(blk_crx,1,0)->p; 
         p3 = crx_in_idir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
 	else
@@ -2495,9 +2688,9 @@ LOCAL void blk_case14_comp2(
         p2 = crx_in_jdir(blk_crx,0,0)->p; 
         p3 = crx_in_kdir(blk_crx,0,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/* the second corner_tri */
 
@@ -2505,9 +2698,9 @@ LOCAL void blk_case14_comp2(
         p2 = crx_in_idir(blk_crx,1,1)->p; 
         p3 = crx_in_jdir(blk_crx,1,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/* the third corner_tri */
 
@@ -2515,9 +2708,9 @@ LOCAL void blk_case14_comp2(
         p2 = crx_in_kdir(blk_crx,1,0)->p; 
         p3 = crx_in_idir(blk_crx,0,0)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 
 	/* the fourth corner_tri */
 
@@ -2525,9 +2718,9 @@ LOCAL void blk_case14_comp2(
         p2 = crx_in_kdir(blk_crx,0,0)->p; 
         p3 = crx_in_idir(blk_crx,0,1)->p; 
 	if (blk_crx->comps[0] != positive_component(s))
-	    create_triangle(blk_mem,p1,p2,p3,s);
+	    comp2_triangle(blk_mem,p1,p2,p3,s);
 	else
-	    create_triangle(blk_mem,p1,p3,p2,s);
+	    comp2_triangle(blk_mem,p1,p3,p2,s);
 	if (!blk_crx->blk_info->do_volume_frac) 
 	    return;
 	else
@@ -44,11 +44,12 @@ LOCAL   BBI_POINT *curve_crx_in_jdir(const BLK_CRX*,int);
 LOCAL   BBI_POINT *curve_crx_in_kdir(const BLK_CRX*,int);
 LOCAL   BBI_POINT *curve_crxing_in_between(const int*,const int*,const int*,const BLK_CRX*);
 LOCAL   void copy_blk_crx(const BLK_CRX*,BLK_CRX*);
-LOCAL   int compare_comp(COMPONENT***,COMPONENT****,int);
 LOCAL	void set_prime_components(COMPONENT****);
 LOCAL	int count_side_comp(COMPONENT,COMPONENT,COMPONENT,COMPONENT);
 LOCAL	int check_consistence_of_crx(BLK_CRX*,boolean);
 LOCAL   void rot24(BLK_CRX*,int);
+LOCAL	void make_comp3_case_table(COMPONENT****,BLK_CRX*);
+LOCAL	int find_comp3_case(BLK_CRX*);
 LOCAL   void x_rotation(BLK_CRX*);
 LOCAL   void y_rotation(BLK_CRX*);
 LOCAL   void z_rotation(BLK_CRX*);
@@ -118,6 +119,25 @@ EXPORT  void  set_debug_name(const char *s)
 	blk_name = s;
 }
 
+/*
+*	The case of a block is looked up by the signature of its corner
+*	components as set by copy_blk_crx(), sum of comp[i][j][k]*3^c over
+*	the corners c = 4*i+2*j+k.  The entry is case + BLK_CASE_ROT*n,
+*	where n is the number of rot24() steps that bring the block to the
+*	prime case, or -1.  It is made once from the prime cases and
+*	replaces the search over the rotations for every block.
+*	comp3_rot_perm[n][c] is the corner moved to corner c by the first
+*	n steps.
+*/
+
+enum {
+	NUM_COMP3_SIG	= 6561,
+	BLK_CASE_ROT	= 64
+};
+
+LOCAL	int	comp3_case[NUM_COMP3_SIG];
+LOCAL	int	comp3_rot_perm[25][8];
+
 EXPORT	int construct_comp3_blk(
 	BLK_CRX *blk_crx,
 	BLK_TRI *blk_mem)
@@ -192,6 +212,8 @@ EXPORT	int construct_comp3_blk(
 	{
 	    quad_array(&prime_comp,57,2,2,2,sizeof(COMPONENT));
 	    set_prime_components(prime_comp);
+	    bc_rot = alloc_blk_crx(NO);
+	    make_comp3_case_table(prime_comp,bc_rot);
 	}
 	
 	num_crx = check_consistence_of_crx(blk_crx,YES);
@@ -214,64 +236,52 @@ EXPORT	int construct_comp3_blk(
 	    blk_mem->num_tris[i] = 0;
 	}
 
-	if (bc_rot == NULL) bc_rot = alloc_blk_crx(NO);
 	copy_blk_crx(blk_crx, bc_rot);
 
-	/* begin 24-rotation */
 	case_found = NO;
-	for (j = 0; j <= 24; j++)
+	if ((i = find_comp3_case(bc_rot)) >= 0)
 	{
-	    for (i = 0; i < 57; i++)
+	    if(debugging("print_blk"))
 	    {
-	        if (compare_comp(bc_rot->comp, prime_comp, i)) 
-	        { 
-		    if(debugging("print_blk"))
-		    {
-		        printf("construct_comp3_blk(bc_rot) exame i=%d, j %d\n", i, j); 	    
-		        /*print_blk_crx(blk_crx); */
-		        print_blk_crx(bc_rot);
-		    }
-		    blk_intfc_comp3[i](bc_rot, blk_mem);
-		    case_found = YES;
+	        printf("construct_comp3_blk(bc_rot) exame i=%d\n", i);
+	        print_blk_crx(bc_rot);
+	    }
+	    blk_intfc_comp3[i](bc_rot, blk_mem);
+	    case_found = YES;
 
-		    if(debugging("print_blk") || debugging("case_num"))
-		    {
-		        printf("construct_comp3_blk found case %d\n", i+1); 	    
-		        if(i+1 == 17)
-			{
-			    printf("#new db tst\n");
-			    blk_crx->debug_flag = YES;
-			    set_debug_name("bonddb");
-			}
-		    }
-		    if (debugging("BLK_check"))
-		    {
-	                static int ib, ic;
-		        
-			ic = blk_mem->ic[0];
-			printf("0 case=%d, num_surfaces=%d, num_curves=%d\n", 
-			      i+1, blk_mem->num_surfaces, blk_mem->num_curves);
-			printf("ic=%d, curve=%p, bond=%p\n", 
-			      ic, (void*)blk_mem->curves[ic], 
-			          (void*)blk_mem->bonds[ic]);
-			
-			if ((blk_mem->bonds[0] != NULL) && (i==30))
-		        {
-		            ib++;
-			    printf("case-%d finding bonds[%d]\n",i+1,ib);
-			    printf("%f %f %f\n",Coords(blk_mem->bonds[0]->start)[0],
-			        Coords(blk_mem->bonds[0]->start)[1],
-			        Coords(blk_mem->bonds[0]->start)[2]);
-			     printf("%f %f %f\n",Coords(blk_mem->bonds[0]->end)[0],
-			        Coords(blk_mem->bonds[0]->end)[1],
-			        Coords(blk_mem->bonds[0]->end)[2]);
-		        }
-		    }
-	            break;
+	    if(debugging("print_blk") || debugging("case_num"))
+	    {
+	        printf("construct_comp3_blk found case %d\n", i+1);
+	        if(i+1 == 17)
+		{
+		    printf("#new db tst\n");
+		    blk_crx->debug_flag = YES;
+		    set_debug_name("bonddb");
+		}
+	    }
+	    if (debugging("BLK_check"))
+	    {
+	        static int ib, ic;
+
+		ic = blk_mem->ic[0];
+		printf("0 case=%d, num_surfaces=%d, num_curves=%d\n", 
+		      i+1, blk_mem->num_surfaces, blk_mem->num_curves);
+		printf("ic=%d, curve=%p, bond=%p\n", 
+		      ic, (void*)blk_mem->curves[ic], 
+		          (void*)blk_mem->bonds[ic]);
+
+		if ((blk_mem->bonds[0] != NULL) && (i==30))
+	        {
+	            ib++;
+		    printf("case-%d finding bonds[%d]\n",i+1,ib);
+		    printf("%f %f %f\n",Coords(blk_mem->bonds[0]->start)[0],
+		        Coords(blk_mem->bonds[0]->start)[1],
+		        Coords(blk_mem->bonds[0]->start)[2]);
+		     printf("%f %f %f\n",Coords(blk_mem->bonds[0]->end)[0],
+		        Coords(blk_mem->bonds[0]->end)[1],
+		        Coords(blk_mem->bonds[0]->end)[2]);
 	        }
 	    }
-	    if (case_found == YES) break;
-	    rot24(bc_rot, j);
 	}
 	
 	if (case_found == NO)
@@ -290,49 +300,40 @@ EXPORT	int construct_comp3_blk(
 		blk_crx->comps[2] = c_tmp; 
 	    }   
 	    copy_blk_crx(blk_crx, bc_rot);
-	    for (j = 0; j <= 24; j++)
+	    if ((i = find_comp3_case(bc_rot)) >= 0)
 	    {
-	        for (i = 0; i < 57; i++)
-	        { 
-	            if (compare_comp(bc_rot->comp, prime_comp, i)) 
-	            { 
-			(void)printf("WARNING: Special case is found\n");
-	                blk_intfc_comp3[i](bc_rot, blk_mem);
-			case_found = YES;
-			
-			if(debugging("print_blk") || debugging("case_num"))
-		            printf("construct_comp3_blk found case %d\n", i+1); 	    
-
-		        if (debugging("BLK_check"))
-		        {
-			    static int ib, ic;
-		            
-			    ic = blk_mem->ic[0];
-			    printf("1 case=%d, num_surfaces=%d, num_curves=%d\n", i+1, 
-				  blk_mem->num_surfaces, 
-				  blk_mem->num_curves);
-			    printf("ic=%d, curve=%p, bond=%p\n", 
-			          ic, (void*)blk_mem->curves[ic], 
-				      (void*)blk_mem->bonds[ic]);
-
-			    printf("case=%d, bond=%p \n", i+1, (void*)blk_mem->bonds[0]);
-			    if ((blk_mem->bonds[0] != NULL) && (i == 30))
-		            {
-		                ib++;
-			        printf("case-%d finding bonds[%d]\n",i+1,ib);
-			        printf("%f %f %f\n",Coords(blk_mem->bonds[0]->start)[0],
-			            Coords(blk_mem->bonds[0]->start)[1],
-			            Coords(blk_mem->bonds[0]->start)[2]);
-			         printf("%f %f %f\n",Coords(blk_mem->bonds[0]->end)[0],
-			            Coords(blk_mem->bonds[0]->end)[1],
-			            Coords(blk_mem->bonds[0]->end)[2]);
-		            }
-		        }
-	                break;
+		(void)printf("WARNING: Special case is found\n");
+	        blk_intfc_comp3[i](bc_rot, blk_mem);
+		case_found = YES;
+
+		if(debugging("print_blk") || debugging("case_num"))
+	            printf("construct_comp3_blk found case %d\n", i+1);
+
+	        if (debugging("BLK_check"))
+	        {
+		    static int ib, ic;
+
+		    ic = blk_mem->ic[0];
+		    printf("1 case=%d, num_surfaces=%d, num_curves=%d\n", i+1, 
+			  blk_mem->num_surfaces, 
+			  blk_mem->num_curves);
+		    printf("ic=%d, curve=%p, bond=%p\n", 
+		          ic, (void*)blk_mem->curves[ic], 
+			      (void*)blk_mem->bonds[ic]);
+
+		    printf("case=%d, bond=%p \n", i+1, (void*)blk_mem->bonds[0]);
+		    if ((blk_mem->bonds[0] != NULL) && (i == 30))
+	            {
+	                ib++;
+		        printf("case-%d finding bonds[%d]\n",i+1,ib);
+		        printf("%f %f %f\n",Coords(blk_mem->bonds[0]->start)[0],
+		            Coords(blk_mem->bonds[0]->start)[1],
+		            Coords(blk_mem->bonds[0]->start)[2]);
+		         printf("%f %f %f\n",Coords(blk_mem->bonds[0]->end)[0],
+		            Coords(blk_mem->bonds[0]->end)[1],
+		            Coords(blk_mem->bonds[0]->end)[2]);
 	            }
 	        }
-	        if (case_found == YES) break;
-	        rot24(bc_rot, j);
 	    }
 	    if (case_found == NO)
 	    { 
@@ -779,23 +780,6 @@ LOCAL   void copy_blk_crx(
 	    blk_crx2->comps[i] = blk_crx1->comps[i];
 }      /*end copy_blk_crx*/
 
-LOCAL   int compare_comp(
-	COMPONENT ***comp,
-	COMPONENT ****p_comp,
-	int ii)
-{
-	int i,j,k;
-        
-	for (i = 0; i < 2; i++)
-	for (j = 0; j < 2; j++)
-        for (k = 0; k < 2; k++) 
-	if (comp[i][j][k] != p_comp[ii][i][j][k])
-	{
-            return NO; 
-	}
-	return YES; 
-}       /* end compare_comp */
-
 LOCAL	void set_prime_components(
 	COMPONENT ****pcomp)
 {
@@ -1428,6 +1412,84 @@ LOCAL	void set_prime_components(
 
 }	/* end set_prime_components */
 
+/*
+*	Fills comp3_rot_perm[] by following the corners through rot24() on
+*	bc_rot, then comp3_case[] with the first case and the fewest steps
+*	matching each signature, the order of the former search.
+*/
+
+LOCAL	void make_comp3_case_table(
+	COMPONENT ****prime_comp,
+	BLK_CRX *bc_rot)
+{
+	int c,k,n,sig,pow3[8];
+
+	for (c = 0; c < 8; ++c)
+	{
+	    pow3[c] = (c == 0) ? 1 : 3*pow3[c-1];
+	    bc_rot->comp[c>>2][(c>>1)&1][c&1] = c;
+	}
+	for (n = 0; n <= 24; ++n)
+	{
+	    for (c = 0; c < 8; ++c)
+		comp3_rot_perm[n][c] = bc_rot->comp[c>>2][(c>>1)&1][c&1];
+	    rot24(bc_rot,n);
+	}
+
+	for (sig = 0; sig < NUM_COMP3_SIG; ++sig)
+	    comp3_case[sig] = -1;
+	for (n = 0; n <= 24; ++n)
+	for (k = 0; k < 57; ++k)
+	{
+	    sig = 0;
+	    for (c = 0; c < 8; ++c)
+		sig += prime_comp[k][c>>2][(c>>1)&1][c&1]*
+				pow3[comp3_rot_perm[n][c]];
+	    if (comp3_case[sig] < 0)
+		comp3_case[sig] = k + BLK_CASE_ROT*n;
+	}
+}	/* end make_comp3_case_table */
+
+/*
+*	Rotates bc_rot to its prime case and returns the case, or -1.
+*/
+
+LOCAL	int find_comp3_case(
+	BLK_CRX *bc_rot)
+{
+	int ***ix = bc_rot->ix;
+	int ***iy = bc_rot->iy;
+	int ***iz = bc_rot->iz;
+	COMPONENT ***comp = bc_rot->comp;
+	COMPONENT comp_tmp[8];
+	int ix_tmp[8],iy_tmp[8],iz_tmp[8];
+	int c,m,icase,sig;
+	const int *perm;
+
+	sig = 0;
+	for (c = 7; c >= 0; --c)
+	    sig = 3*sig + comp[c>>2][(c>>1)&1][c&1];
+	if ((icase = comp3_case[sig]) < 0)
+	    return -1;
+	perm = comp3_rot_perm[icase/BLK_CASE_ROT];
+	for (c = 0; c < 8; ++c)
+	{
+	    comp_tmp[c] = comp[c>>2][(c>>1)&1][c&1];
+	    ix_tmp[c] = ix[c>>2][(c>>1)&1][c&1];
+	    iy_tmp[c] = iy[c>>2][(c>>1)&1][c&1];
+	    iz_tmp[c] = iz[c>>2][(c>>1)&1][c&1];
+	}
+	for (c = 0; c < 8; ++c)
+	{
+	    m = perm[c];
+	    comp[c>>2][(c>>1)&1][c&1] = comp_tmp[m];
+	    ix[c>>2][(c>>1)&1][c&1] = ix_tmp[m];
+	    iy[c>>2][(c>>1)&1][c&1] = iy_tmp[m];
+	    iz[c>>2][(c>>1)&1][c&1] = iz_tmp[m];
+	}
+	return icase%BLK_CASE_ROT;
+}	/* end find_comp3_case */
+
 EXPORT	int is_surface(
 	BLK_CRX *blk_crx,
 	SURFACE *s)
@@ -0,0 +1,806 @@
+/***************************************************************
+FronTier is a set of libraries that implements different types of
+Front Traking algorithms. Front Tracking is a numerical method for
+the solution of partial differential equations whose solutions have
+discontinuities.
+
+Copyright (C) 1999 by The University at Stony Brook.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+****************************************************************/
+
+/*
+*				ibvh.c:
+*
+*	Bounding volume hierarchy over the elements of an interface, the
+*	BONDS in 2D and the TRIS in 3D.  It answers the nearest point and
+*	ray queries that are not confined to a few topological grid blocks
+*	in O(log n) rather than by a scan of the whole interface.
+*
+*	The hierarchy is a linear BVH.  The element centroids are ordered
+*	along a Morton curve and the internal nodes are those of the binary
+*	radix tree of the sorted codes (T. Karras, High Performance Graphics
+*	2012).  Each internal node is found independently of the others and
+*	the boxes are merged bottom up, so all but the sort runs in
+*	parallel.  The internal nodes are 0,...,n-2 with the root at 0,
+*	and leaf k, the k-th element in Morton order, is node n-1+k.
+*
+*	The hierarchy of an interface is built at its first query.  When
+*	the interface has been modified, or was copied from an interface
+*	with a hierarchy, the next query only refits the boxes to the
+*	moved elements if the number of elements is unchanged.  The tree is
+*	rebuilt when the number of elements changes or after BVH_MAX_REFITS
+*	refits, since the boxes of a refitted tree overlap more and more
+*	as the interface moves.
+*/
+
+#include <iloc.h>
+
+enum {
+	BVH_MAX_REFITS = 16,
+	BVH_STACK_SIZE = 128
+};
+
+	/* Relative slack of the pruning, for the tie breaking of equidistant
+	 * elements by the visit functions */
+#define	BVH_D2_TOL	1.0e-10
+
+struct _INTFC_BVH {
+	int		dim;
+	int		num_elems;	/* Number n of elements and leaves */
+	int		num_refits;	/* Refits since the last build */
+	boolean		stale;		/* Elements changed since last use */
+	BVH_ELEM	*elems;		/* Elements in interface order */
+	int		*leaf_elem;	/* Element of each leaf */
+	int		*child;		/* Children of the internal nodes */
+	int		*parent;	/* Parent of each node, -1 at root */
+	int		*visits;	/* Counters of the bottom up merge */
+	double		*L, *U;		/* Box of each node, MAXD per node */
+};
+
+LOCAL	boolean	collect_bvh_elems(INTERFACE*,INTFC_BVH*);
+LOCAL	boolean	ray_crosses_box(const double*,const double*,const double*,
+				const double*,int,double,double*);
+LOCAL	double	box_dist2(const double*,const double*,const double*,int);
+LOCAL	double	ray_crosses_elem(BVH_ELEM*,int,const double*,const double*);
+LOCAL	int	bvh_delta(const unsigned long long*,int,int,int);
+LOCAL	int	compare_bvh_keys(const void*,const void*);
+LOCAL	int	count_leading_zeros(unsigned long long);
+LOCAL	unsigned long long morton_code(const double*,int);
+LOCAL	void	alloc_bvh_tree(INTFC_BVH*);
+LOCAL	void	build_bvh(INTFC_BVH*);
+LOCAL	void	elem_box(BVH_ELEM*,int,double*,double*);
+LOCAL	void	free_bvh_tree(INTFC_BVH*);
+LOCAL	void	refit_bvh(INTFC_BVH*);
+
+
+/*
+*			interface_bvh():
+*
+*	Returns the hierarchy of the BONDS or TRIS of intfc, building or
+*	refitting it first if the interface changed since its last use.
+*/
+
+EXPORT	INTFC_BVH *interface_bvh(
+	INTERFACE	*intfc)
+{
+	struct Table	*T = intfc->table;
+	INTFC_BVH	*bvh = T->bvh;
+
+	if ((bvh != NULL) && !bvh->stale && !intfc->modified)
+	    return bvh;
+
+#pragma omp critical (intfc_bvh)
+	{
+	    bvh = T->bvh;
+	    if (bvh == NULL)
+	    {
+	    	scalar(&bvh,sizeof(INTFC_BVH));
+	    	zero_scalar(bvh,sizeof(INTFC_BVH));
+	    	bvh->dim = intfc->dim;
+	    	bvh->stale = YES;
+	    }
+	    if (bvh->stale || intfc->modified)
+	    {
+	    	if (collect_bvh_elems(intfc,bvh) == YES &&
+	    	    bvh->num_refits < BVH_MAX_REFITS)
+	    	{
+	    	    refit_bvh(bvh);
+	    	    if (bvh->stale)
+	    	    	++bvh->num_refits;
+	    	}
+	    	else
+	    	    build_bvh(bvh);
+	    	bvh->stale = NO;
+	    }
+	    T->bvh = bvh;
+	}
+	if (debugging("bvh"))
+	    (void) printf("interface_bvh(): %d elements, %d refits\n",
+	    		  bvh->num_elems,bvh->num_refits);
+	return bvh;
+}		/*end interface_bvh*/
+
+/*
+*	Marks the hierarchy of intfc for a refit at the next query, called
+*	when the topological lists of the interface are reconstructed.
+*/
+
+EXPORT	void	reset_interface_bvh(
+	INTERFACE	*intfc)
+{
+	if (intfc->table->bvh != NULL)
+	    intfc->table->bvh->stale = YES;
+}		/*end reset_interface_bvh*/
+
+/*
+*	Gives new_intfc, a copy of intfc, the tree of the hierarchy of
+*	intfc.  The elements of a copy are in the same order, so the first
+*	query of new_intfc refits the tree instead of building a new one.
+*/
+
+EXPORT	void	copy_interface_bvh(
+	INTERFACE	*new_intfc,
+	INTERFACE	*intfc)
+{
+	INTFC_BVH	*bvh = intfc->table->bvh;
+	INTFC_BVH	*new_bvh;
+	int		n;
+
+	if ((bvh == NULL) || (bvh->leaf_elem == NULL) ||
+	    (new_intfc->table->bvh != NULL))
+	    return;
+	n = bvh->num_elems;
+	scalar(&new_bvh,sizeof(INTFC_BVH));
+	zero_scalar(new_bvh,sizeof(INTFC_BVH));
+	new_bvh->dim = bvh->dim;
+	new_bvh->num_elems = n;
+	new_bvh->num_refits = bvh->num_refits + 1;
+	new_bvh->stale = YES;
+	uni_array(&new_bvh->elems,n,sizeof(BVH_ELEM));
+	alloc_bvh_tree(new_bvh);
+	ft_assign(new_bvh->leaf_elem,bvh->leaf_elem,n*INT);
+	ft_assign(new_bvh->child,bvh->child,2*max(n-1,1)*INT);
+	ft_assign(new_bvh->parent,bvh->parent,(2*n-1)*INT);
+	new_intfc->table->bvh = new_bvh;
+}		/*end copy_interface_bvh*/
+
+EXPORT	void	free_interface_bvh(
+	INTERFACE	*intfc)
+{
+	INTFC_BVH	*bvh = intfc->table->bvh;
+
+	if (bvh == NULL)
+	    return;
+	free_bvh_tree(bvh);
+	if (bvh->elems != NULL)
+	    free(bvh->elems);
+	free(bvh);
+	intfc->table->bvh = NULL;
+}		/*end free_interface_bvh*/
+
+
+/*
+*			bvh_nearest_search():
+*
+*	Branch and bound search for the element nearest to pt.  The nodes
+*	are visited nearest box first, and visit(elem,arg) is called for
+*	each element whose box may hold a point closer than the current
+*	best.  The visit function selects the elements, keeps the closest
+*	one in arg, and returns the square distance to it, or HUGE_VAL if
+*	none has been selected yet.  Returns the final square distance.
+*/
+
+LIB_LOCAL	double	bvh_nearest_search(
+	INTFC_BVH	*bvh,
+	const double	*pt,
+	double		(*visit)(BVH_ELEM*,POINTER),
+	POINTER		arg)
+{
+	int	stack[BVH_STACK_SIZE];
+	double	dstack[BVH_STACK_SIZE];
+	int	nstack = 0;
+	int	n = bvh->num_elems;
+	int	dim = bvh->dim;
+	int	node,c0,c1,ctmp;
+	double	best = HUGE_VAL;
+	double	d0,d1,dtmp;
+
+	if (n == 0)
+	    return best;
+
+	node = 0;
+	for (;;)
+	{
+	    if (node >= n - 1)
+	    	best = (*visit)(bvh->elems + bvh->leaf_elem[node-n+1],arg);
+	    else
+	    {
+	    	c0 = bvh->child[2*node];
+	    	c1 = bvh->child[2*node+1];
+	    	d0 = box_dist2(pt,bvh->L+MAXD*c0,bvh->U+MAXD*c0,dim);
+	    	d1 = box_dist2(pt,bvh->L+MAXD*c1,bvh->U+MAXD*c1,dim);
+	    	if (d1 < d0)
+	    	{
+	    	    ctmp = c0;	c0 = c1;	c1 = ctmp;
+	    	    dtmp = d0;	d0 = d1;	d1 = dtmp;
+	    	}
+	    	if (d1 <= best + BVH_D2_TOL*best)
+	    	{
+	    	    if (nstack == BVH_STACK_SIZE)
+	    	    {
+	    	    	screen("ERROR in bvh_nearest_search(), "
+	    	    	       "stack overflow\n");
+	    	    	clean_up(ERROR);
+	    	    }
+	    	    stack[nstack] = c1;
+	    	    dstack[nstack++] = d1;
+	    	}
+	    	if (d0 <= best + BVH_D2_TOL*best)
+	    	{
+	    	    node = c0;
+	    	    continue;
+	    	}
+	    }
+	    do
+	    {
+	    	if (nstack == 0)
+	    	    return best;
+	    	node = stack[--nstack];
+	    } while (dstack[nstack] > best + BVH_D2_TOL*best);
+	}
+}		/*end bvh_nearest_search*/
+
+
+/*
+*			interface_ray_crossing():
+*
+*	Finds the first crossing of the ray start + t*dir, 0 <= t <= tmax,
+*	with the BONDS (2D) or TRIS (3D) of intfc, or of the hypersurface
+*	hs only if hs is not NULL.  Returns YES with the parameter t of the
+*	crossing and the element and hypersurface crossed, or NO if the
+*	ray does not cross the interface.
+*/
+
+EXPORT	boolean	interface_ray_crossing(
+	INTERFACE	   *intfc,
+	HYPER_SURF	   *hs,
+	const double	   *start,
+	const double	   *dir,
+	double		   tmax,
+	double		   *t,
+	HYPER_SURF_ELEMENT **phse,
+	HYPER_SURF	   **phs)
+{
+	INTFC_BVH	*bvh = interface_bvh(intfc);
+	int		stack[BVH_STACK_SIZE];
+	double		tstack[BVH_STACK_SIZE];
+	int		nstack = 0;
+	int		n = bvh->num_elems;
+	int		dim = bvh->dim;
+	int		i,node,c0,c1,ctmp;
+	double		inv_dir[MAXD];
+	double		t0,t1,ttmp,tbest = tmax;
+	boolean		h0,h1;
+	BVH_ELEM	*closest = NULL;
+
+	if (n == 0)
+	    return NO;
+	for (i = 0; i < dim; ++i)
+	    inv_dir[i] = (dir[i] != 0.0) ? 1.0/dir[i] : HUGE_VAL;
+
+	node = 0;
+	if (!ray_crosses_box(start,inv_dir,bvh->L,bvh->U,dim,tbest,&t0))
+	    return NO;
+	for (;;)
+	{
+	    if (node >= n - 1)
+	    {
+	    	BVH_ELEM *e = bvh->elems + bvh->leaf_elem[node-n+1];
+	    	if (hs == NULL || e->hs == hs)
+	    	{
+	    	    double te = ray_crosses_elem(e,dim,start,dir);
+	    	    if (te >= 0.0 && te <= tbest)
+	    	    {
+	    	    	tbest = te;
+	    	    	closest = e;
+	    	    }
+	    	}
+	    }
+	    else
+	    {
+	    	c0 = bvh->child[2*node];
+	    	c1 = bvh->child[2*node+1];
+	    	h0 = ray_crosses_box(start,inv_dir,bvh->L+MAXD*c0,
+	    			     bvh->U+MAXD*c0,dim,tbest,&t0);
+	    	h1 = ray_crosses_box(start,inv_dir,bvh->L+MAXD*c1,
+	    			     bvh->U+MAXD*c1,dim,tbest,&t1);
+	    	if (h0 && h1)
+	    	{
+	    	    if (t1 < t0)
+	    	    {
+	    	    	ctmp = c0;	c0 = c1;	c1 = ctmp;
+	    	    	ttmp = t0;	t0 = t1;	t1 = ttmp;
+	    	    }
+	    	    if (nstack == BVH_STACK_SIZE)
+	    	    {
+	    	    	screen("ERROR in interface_ray_crossing(), "
+	    	    	       "stack overflow\n");
+	    	    	clean_up(ERROR);
+	    	    }
+	    	    stack[nstack] = c1;
+	    	    tstack[nstack++] = t1;
+	    	    node = c0;
+	    	    continue;
+	    	}
+	    	else if (h0 || h1)
+	    	{
+	    	    node = (h0) ? c0 : c1;
+	    	    continue;
+	    	}
+	    }
+	    do
+	    {
+	    	if (nstack == 0)
+	    	{
+	    	    if (closest == NULL)
+	    	    	return NO;
+	    	    *t = tbest;
+	    	    *phse = closest->hse;
+	    	    *phs = closest->hs;
+	    	    return YES;
+	    	}
+	    	node = stack[--nstack];
+	    } while (tstack[nstack] > tbest);
+	}
+}		/*end interface_ray_crossing*/
+
+
+/*
+*	Lists the elements of intfc in bvh->elems.  Returns YES if their
+*	number is that of the existing tree, which can then be refitted.
+*/
+
+LOCAL	boolean	collect_bvh_elems(
+	INTERFACE	*intfc,
+	INTFC_BVH	*bvh)
+{
+	CURVE		**c;
+	SURFACE		**s;
+	BOND		*b;
+	TRI		*tri;
+	int		n = 0;
+	boolean		same;
+
+	if (bvh->dim == 2)
+	{
+	    for (c = intfc->curves; c && *c; ++c)
+	    	for (b = (*c)->first; b != NULL; b = b->next)
+	    	    ++n;
+	}
+	else if (bvh->dim == 3)
+	{
+	    for (s = intfc->surfaces; s && *s; ++s)
+	    	for (tri = first_tri(*s); !at_end_of_tri_list(tri,*s);
+	    	     tri = tri->next)
+	    	    ++n;
+	}
+
+	same = ((bvh->leaf_elem != NULL) && (n == bvh->num_elems)) ? YES : NO;
+	if (!same)
+	{
+	    free_bvh_tree(bvh);
+	    if (bvh->elems != NULL)
+	    	free(bvh->elems);
+	    bvh->elems = NULL;
+	    bvh->num_elems = n;
+	    if (n != 0)
+	    	uni_array(&bvh->elems,n,sizeof(BVH_ELEM));
+	}
+
+	n = 0;
+	if (bvh->dim == 2)
+	{
+	    for (c = intfc->curves; c && *c; ++c)
+	    	for (b = (*c)->first; b != NULL; b = b->next, ++n)
+	    	{
+	    	    bvh->elems[n].hse = Hyper_surf_element(b);
+	    	    bvh->elems[n].hs = Hyper_surf(*c);
+	    	}
+	}
+	else if (bvh->dim == 3)
+	{
+	    for (s = intfc->surfaces; s && *s; ++s)
+	    	for (tri = first_tri(*s); !at_end_of_tri_list(tri,*s);
+	    	     tri = tri->next, ++n)
+	    	{
+	    	    bvh->elems[n].hse = Hyper_surf_element(tri);
+	    	    bvh->elems[n].hs = Hyper_surf(*s);
+	    	}
+	}
+	return same;
+}		/*end collect_bvh_elems*/
+
+LOCAL	void	alloc_bvh_tree(
+	INTFC_BVH	*bvh)
+{
+	int	n = bvh->num_elems;
+
+	uni_array(&bvh->leaf_elem,n,INT);
+	uni_array(&bvh->child,2*max(n-1,1),INT);
+	uni_array(&bvh->parent,2*n-1,INT);
+	uni_array(&bvh->visits,max(n-1,1),INT);
+	uni_array(&bvh->L,MAXD*(2*n-1),FLOAT);
+	uni_array(&bvh->U,MAXD*(2*n-1),FLOAT);
+}		/*end alloc_bvh_tree*/
+
+LOCAL	void	free_bvh_tree(
+	INTFC_BVH	*bvh)
+{
+	if (bvh->leaf_elem == NULL)
+	    return;
+	free_these(6,bvh->leaf_elem,bvh->child,bvh->parent,bvh->visits,
+		   bvh->L,bvh->U);
+	bvh->leaf_elem = NULL;
+	bvh->child = bvh->parent = bvh->visits = NULL;
+	bvh->L = bvh->U = NULL;
+	bvh->num_refits = 0;
+}		/*end free_bvh_tree*/
+
+/*
+*	Builds the tree of the listed elements: Morton codes of the element
+*	centroids, sorted with the element index in the low 32 bits so that
+*	all keys differ, then one internal node per adjacent pair of keys.
+*/
+
+LOCAL	void	build_bvh(
+	INTFC_BVH	*bvh)
+{
+	unsigned long long *keys;
+	double		*cen;
+	double		cL[MAXD],cU[MAXD];
+	int		n = bvh->num_elems;
+	int		dim = bvh->dim;
+	int		i,k;
+
+	free_bvh_tree(bvh);
+	if (n == 0)
+	    return;
+	alloc_bvh_tree(bvh);
+	uni_array(&keys,n,sizeof(unsigned long long));
+	uni_array(&cen,MAXD*n,FLOAT);
+
+#pragma omp parallel for private(k)
+	for (i = 0; i < n; ++i)
+	{
+	    double L[MAXD],U[MAXD];
+	    elem_box(bvh->elems+i,dim,L,U);
+	    for (k = 0; k < dim; ++k)
+	    	cen[MAXD*i+k] = 0.5*(L[k] + U[k]);
+	}
+	for (k = 0; k < dim; ++k)
+	{
+	    cL[k] = HUGE_VAL;
+	    cU[k] = -HUGE_VAL;
+	}
+	for (i = 0; i < n; ++i)
+	    for (k = 0; k < dim; ++k)
+	    {
+	    	cL[k] = min(cL[k],cen[MAXD*i+k]);
+	    	cU[k] = max(cU[k],cen[MAXD*i+k]);
+	    }
+
+#pragma omp parallel for private(k)
+	for (i = 0; i < n; ++i)
+	{
+	    double x[MAXD];
+	    for (k = 0; k < dim; ++k)
+	    	x[k] = (cU[k] > cL[k]) ?
+	    		(cen[MAXD*i+k] - cL[k])/(cU[k] - cL[k]) : 0.5;
+	    keys[i] = (morton_code(x,dim) << 32) | (unsigned long long) i;
+	}
+	qsort((POINTER)keys,n,sizeof(unsigned long long),compare_bvh_keys);
+
+	bvh->parent[0] = -1;
+#pragma omp parallel for
+	for (i = 0; i < n; ++i)
+	    bvh->leaf_elem[i] = (int)(keys[i] & 0xffffffffULL);
+
+	/* Internal node i covers the keys i..j, split after gamma */
+#pragma omp parallel for
+	for (i = 0; i < n - 1; ++i)
+	{
+	    int d,dmin,dnode,l,lmax,s,t,j,gamma,left,right;
+
+	    d = (bvh_delta(keys,n,i,i+1) > bvh_delta(keys,n,i,i-1)) ? 1 : -1;
+	    dmin = bvh_delta(keys,n,i,i-d);
+	    for (lmax = 2; bvh_delta(keys,n,i,i+lmax*d) > dmin; lmax *= 2);
+	    l = 0;
+	    for (t = lmax/2; t >= 1; t /= 2)
+	    	if (bvh_delta(keys,n,i,i+(l+t)*d) > dmin)
+	    	    l += t;
+	    j = i + l*d;
+	    dnode = bvh_delta(keys,n,i,j);
+	    s = 0;
+	    t = l;
+	    do
+	    {
+	    	t = (t + 1)/2;
+	    	if (bvh_delta(keys,n,i,i+(s+t)*d) > dnode)
+	    	    s += t;
+	    } while (t > 1);
+	    gamma = i + s*d + min(d,0);
+	    left = (min(i,j) == gamma) ? n - 1 + gamma : gamma;
+	    right = (max(i,j) == gamma + 1) ? n + gamma : gamma + 1;
+	    bvh->child[2*i] = left;
+	    bvh->child[2*i+1] = right;
+	    bvh->parent[left] = i;
+	    bvh->parent[right] = i;
+	}
+	free_these(2,keys,cen);
+
+	bvh->num_refits = 0;
+	refit_bvh(bvh);
+}		/*end build_bvh*/
+
+/*
+*	Recomputes the boxes of all nodes.  Each leaf walks up the tree and
+*	the second child to reach an internal node merges the boxes of both.
+*/
+
+LOCAL	void	refit_bvh(
+	INTFC_BVH	*bvh)
+{
+	int	n = bvh->num_elems;
+	int	dim = bvh->dim;
+	int	i;
+
+	if (n == 0)
+	    return;
+	for (i = 0; i < n - 1; ++i)
+	    bvh->visits[i] = 0;
+
+#pragma omp parallel for
+	for (i = 0; i < n; ++i)
+	{
+	    int node = n - 1 + i;
+	    int p,k,old,c0,c1;
+
+	    elem_box(bvh->elems+bvh->leaf_elem[i],dim,bvh->L+MAXD*node,
+	    	     bvh->U+MAXD*node);
+	    for (p = bvh->parent[node]; p >= 0; p = bvh->parent[p])
+	    {
+#pragma omp flush
+#pragma omp atomic capture
+	    	old = bvh->visits[p]++;
+	    	if (old == 0)
+	    	    break;
+#pragma omp flush
+	    	c0 = bvh->child[2*p];
+	    	c1 = bvh->child[2*p+1];
+	    	for (k = 0; k < dim; ++k)
+	    	{
+	    	    bvh->L[MAXD*p+k] = min(bvh->L[MAXD*c0+k],bvh->L[MAXD*c1+k]);
+	    	    bvh->U[MAXD*p+k] = max(bvh->U[MAXD*c0+k],bvh->U[MAXD*c1+k]);
+	    	}
+	    }
+	}
+}		/*end refit_bvh*/
+
+LOCAL	void	elem_box(
+	BVH_ELEM	*e,
+	int		dim,
+	double		*L,
+	double		*U)
+{
+	POINT	*p[3];
+	int	i,k,np;
+
+	if (dim == 2)
+	{
+	    p[0] = Bond_of_hse(e->hse)->start;
+	    p[1] = Bond_of_hse(e->hse)->end;
+	    np = 2;
+	}
+	else
+	{
+	    for (i = 0; i < 3; ++i)
+	    	p[i] = Point_of_tri(Tri_of_hse(e->hse))[i];
+	    np = 3;
+	}
+	for (k = 0; k < dim; ++k)
+	{
+	    L[k] = U[k] = Coords(p[0])[k];
+	    for (i = 1; i < np; ++i)
+	    {
+	    	L[k] = min(L[k],Coords(p[i])[k]);
+	    	U[k] = max(U[k],Coords(p[i])[k]);
+	    }
+	}
+}		/*end elem_box*/
+
+/* Length of the common prefix of keys i and j, -1 if j is out of range */
+LOCAL	int	bvh_delta(
+	const unsigned long long *keys,
+	int	n,
+	int	i,
+	int	j)
+{
+	if (j < 0 || j >= n)
+	    return -1;
+	return count_leading_zeros(keys[i] ^ keys[j]);
+}		/*end bvh_delta*/
+
+LOCAL	int	count_leading_zeros(
+	unsigned long long x)
+{
+#if defined(__GNUC__)
+	return (x == 0) ? 64 : __builtin_clzll(x);
+#else /* defined(__GNUC__) */
+	int	n = 0;
+
+	if (x == 0)
+	    return 64;
+	while (!(x & (1ULL << 63)))
+	{
+	    x <<= 1;
+	    ++n;
+	}
+	return n;
+#endif /* defined(__GNUC__) */
+}		/*end count_leading_zeros*/
+
+/* 30 bit Morton code of x in [0,1]^dim, 15 bits per axis in 2D, 10 in 3D */
+LOCAL	unsigned long long morton_code(
+	const double	*x,
+	int		dim)
+{
+	unsigned long long code = 0;
+	unsigned long long q[MAXD];
+	int	bits = 30/dim;
+	int	b,k;
+
+	for (k = 0; k < dim; ++k)
+	{
+	    double s = x[k]*(double)(1 << bits);
+	    q[k] = (unsigned long long) min(max(s,0.0),(double)((1<<bits)-1));
+	}
+	for (b = bits - 1; b >= 0; --b)
+	    for (k = 0; k < dim; ++k)
+	    	code = (code << 1) | ((q[k] >> b) & 1ULL);
+	return code;
+}		/*end morton_code*/
+
+LOCAL	int	compare_bvh_keys(
+	const void	*a,
+	const void	*b)
+{
+	unsigned long long ka = *(const unsigned long long*)a;
+	unsigned long long kb = *(const unsigned long long*)b;
+
+	return (ka < kb) ? -1 : (ka > kb) ? 1 : 0;
+}		/*end compare_bvh_keys*/
+
+LOCAL	double	box_dist2(
+	const double	*pt,
+	const double	*L,
+	const double	*U,
+	int		dim)
+{
+	double	d2 = 0.0, d;
+	int	k;
+
+	for (k = 0; k < dim; ++k)
+	{
+	    if (pt[k] < L[k])
+	    	d = L[k] - pt[k];
+	    else if (pt[k] > U[k])
+	    	d = pt[k] - U[k];
+	    else
+	    	continue;
+	    d2 += d*d;
+	}
+	return d2;
+}		/*end box_dist2*/
+
+/* Slab test, the entry parameter of the ray into the box is in *tin */
+LOCAL	boolean	ray_crosses_box(
+	const double	*start,
+	const double	*inv_dir,
+	const double	*L,
+	const double	*U,
+	int		dim,
+	double		tmax,
+	double		*tin)
+{
+	double	t0 = 0.0, t1 = tmax;
+	double	ta,tb,tmp;
+	int	k;
+
+	for (k = 0; k < dim; ++k)
+	{
+	    ta = (L[k] - start[k])*inv_dir[k];
+	    tb = (U[k] - start[k])*inv_dir[k];
+	    if (ta > tb)
+	    {
+	    	tmp = ta;	ta = tb;	tb = tmp;
+	    }
+	    /* NaN from 0*inf when start is on a slab of a parallel ray */
+	    if (ta == ta && ta > t0) t0 = ta;
+	    if (tb == tb && tb < t1) t1 = tb;
+	    if (t0 > t1)
+	    	return NO;
+	}
+	*tin = t0;
+	return YES;
+}		/*end ray_crosses_box*/
+
+/*
+*	Parameter t of the crossing of start + t*dir with a BOND or TRI,
+*	or -1 if they do not cross.  Rays along the element do not cross.
+*/
+
+LOCAL	double	ray_crosses_elem(
+	BVH_ELEM	*e,
+	int		dim,
+	const double	*start,
+	const double	*dir)
+{
+	const double eps = 10.0*MACH_EPS;
+	double	det,s,t,u,v;
+	int	k;
+
+	if (dim == 2)
+	{
+	    BOND   *b = Bond_of_hse(e->hse);
+	    double *p0 = Coords(b->start), *p1 = Coords(b->end);
+	    double e0 = p1[0] - p0[0], e1 = p1[1] - p0[1];
+	    double w0 = p0[0] - start[0], w1 = p0[1] - start[1];
+
+	    det = dir[0]*e1 - dir[1]*e0;
+	    if (fabs(det) <= eps*(fabs(dir[0]*e1) + fabs(dir[1]*e0)))
+	    	return -1.0;
+	    t = (w0*e1 - w1*e0)/det;
+	    s = (w0*dir[1] - w1*dir[0])/det;
+	    return (s >= -eps && s <= 1.0 + eps) ? t : -1.0;
+	}
+	else
+	{
+	    TRI    *tri = Tri_of_hse(e->hse);
+	    double *p0 = Coords(Point_of_tri(tri)[0]);
+	    double *p1 = Coords(Point_of_tri(tri)[1]);
+	    double *p2 = Coords(Point_of_tri(tri)[2]);
+	    double e1[3],e2[3],pv[3],tv[3],qv[3];
+
+	    for (k = 0; k < 3; ++k)
+	    {
+	    	e1[k] = p1[k] - p0[k];
+	    	e2[k] = p2[k] - p0[k];
+	    	tv[k] = start[k] - p0[k];
+	    }
+	    Cross3d(dir,e2,pv);
+	    det = Dot3d(e1,pv);
+	    if (fabs(det) <= eps*Mag3d(e1)*Mag3d(pv))
+	    	return -1.0;
+	    u = Dot3d(tv,pv)/det;
+	    if (u < -eps || u > 1.0 + eps)
+	    	return -1.0;
+	    Cross3d(tv,e1,qv);
+	    v = Dot3d(dir,qv)/det;
+	    if (v < -eps || u + v > 1.0 + eps)
+	    	return -1.0;
+	    return Dot3d(e2,qv)/det;
+	}
+}		/*end ray_crosses_elem*/
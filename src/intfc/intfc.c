@@ -384,9 +384,25 @@ LOCAL	void	split_tris_at_split_bond(POINT*,BOND*,CURVE*);
 LOCAL struct Table *FirstIT = NULL;	/* The Interface Table List */
 LOCAL struct Table *LastIT = NULL;
 	  
-LOCAL struct Table *cur_IT = NULL;	/* The current interface table */
+/*
+*	The current interface and its table.  A thread works in the process
+*	wide shared_context until it is given one of its own by
+*	set_thread_interface(), or for one call by enter_interface_context().
+*	The table list and the free lists of tables and chunks are shared
+*	by all threads and are only changed in the critical section
+*	intfc_table_list, which also covers the vmalloc calls made here.
+*/
+
+LOCAL INTFC_CONTEXT shared_context = {NULL, NULL};
+LOCAL FT_THREAD_LOCAL INTFC_CONTEXT *thread_context = NULL;
+LOCAL FT_THREAD_LOCAL INTFC_CONTEXT thread_own_context = {NULL, NULL};
 
-LOCAL INTERFACE *cur_intfc = NULL;	/* The current interface */
+#define	cur_context							\
+	((thread_context != NULL) ? thread_context : &shared_context)
+#define	cur_IT		(cur_context->IT)	/* The current interface table */
+#define	cur_intfc	(cur_context->intfc)	/* The current interface */
+
+LOCAL	POINTER	table_store(struct Table*,INTERFACE*,size_t);
 
 
 /*
@@ -432,6 +448,71 @@ EXPORT INTERFACE *current_interface(void)
 }		/*end current_interface*/
 
 
+/*
+*				set_thread_interface():
+*
+*	Gives the calling thread its own current interface, which is then
+*	used by set_current_interface(), current_interface(), store() and
+*	the constructors called from this thread.  With intfc == NULL the
+*	thread returns to the process wide current interface.  Returns the
+*	previous own interface of the thread, or NULL.
+*/
+
+EXPORT INTERFACE *set_thread_interface(
+	INTERFACE	*intfc)
+{
+	INTERFACE	*prev_intfc = thread_own_context.intfc;
+	struct Table	*T;
+
+	if (intfc == NULL)
+	{
+	    thread_own_context.IT = NULL;
+	    thread_own_context.intfc = NULL;
+	    thread_context = NULL;
+	    return prev_intfc;
+	}
+	if ((T = table_of_interface(intfc)) == NULL)
+	{
+	    screen("ERROR in set_thread_interface(), "
+	           "Interface doesn't exist\n");
+	    clean_up(ERROR);
+	}
+	thread_own_context.IT = T;
+	thread_own_context.intfc = intfc;
+	thread_context = &thread_own_context;
+	return prev_intfc;
+}		/*end set_thread_interface*/
+
+
+/*
+*			enter_interface_context():
+*			leave_interface_context():
+*
+*	Make intfc current for the calling thread only, using the caller's
+*	storage ctx, until the matching leave_interface_context() which
+*	restores the context returned by enter_interface_context().  Used
+*	by the explicit interface variants of the constructors.
+*/
+
+EXPORT INTFC_CONTEXT *enter_interface_context(
+	INTERFACE	*intfc,
+	INTFC_CONTEXT	*ctx)
+{
+	INTFC_CONTEXT	*prev_ctx = thread_context;
+
+	ctx->IT = intfc->table;
+	ctx->intfc = intfc;
+	thread_context = ctx;
+	return prev_ctx;
+}		/*end enter_interface_context*/
+
+EXPORT void leave_interface_context(
+	INTFC_CONTEXT	*prev_ctx)
+{
+	thread_context = prev_ctx;
+}		/*end leave_interface_context*/
+
+
 
 /*
 *				make_interface():
@@ -574,11 +655,42 @@ EXPORT INTERFACE *i_copy_interface(
 	new_intfc->normal_unset = YES;
 	new_intfc->curvature_unset = YES;
 	new_intfc->modified = intfc->modified;
+	copy_interface_bvh(new_intfc,intfc);
 	debug_print("copy_interface","Left i_copy_interface()\n");
 	return new_intfc;
 }		/*end i_copy_interface*/
 
 
+/*
+*				compact_interface():
+*
+*	Brings an interface that was modified in place, as by the grid
+*	based reconstruction, into the state that copy_interface() would
+*	give its copy, without copying it.  Renumbers the points, resets
+*	the node positions of closed curves, marks the normals, curvature
+*	and topological lists for recomputation and sets intfc current.
+*	The storage of elements deleted from intfc stays in its table
+*	until the next copy or delete of intfc returns it to the free
+*	chunk list.
+*/
+
+EXPORT void compact_interface(
+	INTERFACE	*intfc)
+{
+	debug_print("copy_interface","Entered compact_interface(%llu)\n",
+	      interface_number(intfc));
+	reset_intfc_num_points(intfc);
+	if (intfc->dim == 3)
+	    reset_nodes_posn(intfc);
+	intfc->normal_unset = YES;
+	intfc->curvature_unset = YES;
+	intfc->modified = YES;
+	reset_interface_bvh(intfc);
+	set_current_interface(intfc);
+	debug_print("copy_interface","Left compact_interface()\n");
+}		/*end compact_interface*/
+
+
 /*
 *				read_interface():
 *
@@ -1604,12 +1716,19 @@ EXPORT int i_delete_interface(
 	    cur_IT = NULL; 
 	    cur_intfc = NULL; 
 	}
+	if (intfc==shared_context.intfc)
+	{ 
+	    shared_context.IT = NULL; 
+	    shared_context.intfc = NULL; 
+	}
 
 	        /* Free the Chunks: */
+#pragma omp critical (intfc_table_list)
 	ReturnChunksToFreeList(T->first_chunk,T->last_chunk);
 	T->first_chunk = T->last_chunk = NULL;
 
 		/* Free the big chunks */
+#pragma omp critical (intfc_table_list)
 	while (T->big_chunks != NULL)
 	{
 	    struct Chunk *chunk = T->big_chunks;
@@ -1636,18 +1755,8 @@ EXPORT int i_delete_interface(
 	    free(T->curves);
 	if (T->curvestore)
 	    free(T->curvestore);
-	if (T->compon3d)
-	    free(T->compon3d);
-	if (T->num_of_tris)
-	    free(T->num_of_tris);
-	if (T->tris)
-	    free(T->tris);
-	if (T->tristore)
-	    free(T->tristore);
-	if (T->surfaces)
-	    free(T->surfaces);
-	if (T->surfacestore)
-	    free(T->surfacestore);
+	free_topo_tiles3d(T);
+	free_interface_bvh(intfc);
 	if (T->surf_blocks)
 	{
 	    int i;
@@ -1676,30 +1785,33 @@ EXPORT int i_delete_interface(
 	}
 
 	        /* Unlink and Free the Table: */
-	if (T->prev != NULL)
-	    T->prev->next = T->next;
-	else
+#pragma omp critical (intfc_table_list)
 	{
-	    FirstIT = T->next;
-	    if (FirstIT != NULL)
-	        FirstIT->prev = NULL;
-	}
-	if (T->next != NULL)
-	    T->next->prev = T->prev;
-	else
-	{
-	    LastIT = T->prev;
-	    if (LastIT != NULL)
-	        LastIT->next = NULL;
-	}
+	    if (T->prev != NULL)
+	        T->prev->next = T->next;
+	    else
+	    {
+	        FirstIT = T->next;
+	        if (FirstIT != NULL)
+	            FirstIT->prev = NULL;
+	    }
+	    if (T->next != NULL)
+	        T->next->prev = T->prev;
+	    else
+	    {
+	        LastIT = T->prev;
+	        if (LastIT != NULL)
+	            LastIT->next = NULL;
+	    }
 
-	ReturnTableToFreeList(T);
+	    ReturnTableToFreeList(T);
 
-	if (cur_intfc == NULL)
-	{
-	    cur_IT = LastIT; 
-	    if (cur_IT != NULL)
-	        cur_intfc = cur_IT->interface; 
+	    if (cur_intfc == NULL)
+	    {
+	        cur_IT = LastIT; 
+	        if (cur_IT != NULL)
+	            cur_intfc = cur_IT->interface; 
+	    }
 	}
 	if (DEBUG)
 	    (void) printf("Left i_delete_interface()\n\n");
@@ -5789,18 +5901,24 @@ LOCAL struct Table *new_table(
 	I_USER_INTERFACE *uh = i_user_hook(dim);
 	struct Table	 *next_IT;
 
-	if ((next_IT = GetNextFreeTable()) == NULL)
-	    return NULL;
-	if (LastIT == NULL)
-	{
-	    FirstIT = LastIT = next_IT;
-	}
-	else
+#pragma omp critical (intfc_table_list)
 	{
-	    LastIT->next = next_IT;
-	    next_IT->prev = LastIT;
-	    LastIT = next_IT;
+	    if ((next_IT = GetNextFreeTable()) != NULL)
+	    {
+	        if (LastIT == NULL)
+	        {
+	            FirstIT = LastIT = next_IT;
+	        }
+	        else
+	        {
+	            LastIT->next = next_IT;
+	            next_IT->prev = LastIT;
+	            LastIT = next_IT;
+	        }
+	    }
 	}
+	if (next_IT == NULL)
+	    return NULL;
 
 	cur_IT = next_IT;
 	cur_IT->next = NULL;
@@ -5907,12 +6025,7 @@ LIB_LOCAL void print_table(struct Table *T)
 EXPORT boolean  exists_interface(
 	INTERFACE	*intfc)
 {
-	struct Table	*T;
-
-	for (T=FirstIT; T!=NULL; T=T->next)
-	    if (intfc == T->interface)
-		return YES;
-	return NO;
+	return (table_of_interface(intfc) != NULL) ? YES : NO;
 }		/*end exists_interface*/
 
 
@@ -5928,10 +6041,11 @@ EXPORT struct Table *table_of_interface(
 {
 	struct Table	*T;
 
+#pragma omp critical (intfc_table_list)
 	for (T=FirstIT; T!=NULL; T=T->next)
 	    if (intfc == T->interface)
-	    	return T;
-	return NULL;
+	    	break;
+	return T;
 }		/*end table_of_interface*/
 
 
@@ -5950,6 +6064,30 @@ EXPORT  struct Table *interface_table_list(void)
 
 EXPORT  POINTER store(
 	size_t	size)
+{
+	INTFC_CONTEXT	*ctx = cur_context;
+
+	return table_store(ctx->IT,ctx->intfc,size);
+}		/*end store*/
+
+/*
+*			store_in_interface():
+*
+*	Same as store() but in the storage of the given interface rather
+*	than in that of the current interface.
+*/
+
+EXPORT	POINTER	store_in_interface(
+	INTERFACE	*intfc,
+	size_t		size)
+{
+	return table_store(intfc->table,intfc,size);
+}		/*end store_in_interface*/
+
+LOCAL	POINTER	table_store(
+	struct Table	*T,
+	INTERFACE	*intfc,
+	size_t		size)
 {
 	static ALIGN empty;		/* Empty Storage Request */
 	size_t       naligns;
@@ -5959,40 +6097,41 @@ EXPORT  POINTER store(
 	if (naligns  == 0)
 	    return (POINTER)&empty;
 
-	if (size > cur_IT->_ChunkSize)
+	if (size > T->_ChunkSize)
 	{
 	    struct Chunk *chunk;
 	    size_t csize;
 	    csize = naligns*sizeof(ALIGN)+sizeof(struct Chunk)-sizeof(ALIGN);
+#pragma omp critical (intfc_table_list)
 	    scalar(&chunk,csize);
 	    if (chunk == NULL)
 	        return NULL;
 	    zero_scalar(chunk,csize);
-	    chunk->prev = cur_IT->big_chunks;
-	    if (cur_IT->big_chunks != NULL)
-		cur_IT->big_chunks->next = chunk;
-	    cur_IT->big_chunks = chunk;
+	    chunk->prev = T->big_chunks;
+	    if (T->big_chunks != NULL)
+		T->big_chunks->next = chunk;
+	    T->big_chunks = chunk;
 	    return (POINTER) ChunkTop(chunk);
 	}
 
-	    	/* Allocate more storage in Current Interface Table: */
+	    	/* Allocate more storage in the Interface Table: */
 
-	if (cur_IT->remainder < naligns)
-	    if (new_chunk(cur_IT) == NULL)
+	if (T->remainder < naligns)
+	    if (new_chunk(T) == NULL)
 	    	return NULL;
 
-	cur_IT->remainder -= naligns ;
-	oldtop = (POINTER)(cur_IT->top);
-	cur_IT->top += naligns;
-	if (cur_intfc != NULL)
+	T->remainder -= naligns ;
+	oldtop = (POINTER)(T->top);
+	T->top += naligns;
+	if (intfc != NULL)
 	{
-	    cur_intfc->modified = YES;
+	    intfc->modified = YES;
 	}
 
 	/*Ensure storage is initialized to zero*/
 	zero_scalar(oldtop,size);
 	return oldtop;
-}		/*end store*/
+}		/*end table_store*/
 
 /*
 *			init_table_Store():
@@ -6045,7 +6184,9 @@ LIB_LOCAL  struct Chunk *new_chunk(
 
 	    	/* Find Storage Location for Next Chunk: */
 
-	if ((last_chunk = GetNextFreeChunk(table)) == NULL)
+#pragma omp critical (intfc_table_list)
+	last_chunk = GetNextFreeChunk(table);
+	if (last_chunk == NULL)
 	    return NULL;
 	if (table->last_chunk == NULL)
 	{
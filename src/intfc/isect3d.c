@@ -134,16 +134,15 @@ LIB_LOCAL  boolean  i_intersections3d(
 	C_BOND	  *cbond;
 	C_CURVE	  **c;
 	C_CURVE	  **c_curves = NULL;
-	COMPONENT ***comps;
 	CROSS	  *cr, Cr;
 	NODE	  **n;
-	SURFACE	  *****surfs, **s, **s0, **s1;
+	SURFACE	  **s, **s0, **s1;
 	SURFACE	  *cs0, *cs1;
 	TRI	  **t, *tri, *ct0, *ct1;
-	TRI	  *****tris, **t0, **t1;
+	TRI	  **t0, **t1;
 	int	  ix, iy, iz;
 	int	  i, j, xmax, ymax, zmax, nt;
-	int	  ***num_tris;
+	struct Table *T;
 	boolean	  status;
 
 	if (intfc->surfaces == NULL) 
@@ -202,10 +201,7 @@ LIB_LOCAL  boolean  i_intersections3d(
 *	the surface elements (TRI's) into grid cubes determined by the
 *	topological grid.
 */
-	tris = intfc->table->tris;
-	surfs = intfc->table->surfaces;
-	num_tris = intfc->table->num_of_tris;
-	comps = intfc->table->compon3d;
+	T = intfc->table;
 
 /*
 *	The following code sets up a loop over all of the "bins" (i.e. grid
@@ -216,14 +212,22 @@ LIB_LOCAL  boolean  i_intersections3d(
 	for (iy = 0; iy < ymax; ++iy)
 	for (ix = 0; ix < xmax; ++ix)
 	{
+	    /* Skip the rest of a tile row that carries no TRI lists */
+
+	    if (Topo_tile3d(T,ix,iy,iz).page < 0)
+	    {
+		ix |= TOPO_TILE_MASK;
+		continue;
+	    }
+
 	    /* This grid cube must be passed through by the front...  */
 
-	    if (comps[iz][iy][ix] != ONFRONT)
+	    if (Comp_of_block3d(T,ix,iy,iz) != ONFRONT)
 		continue;
 
 	    /* and it must contain 2 or more TRI's.     */
 	    
-	    nt = num_tris[iz][iy][ix];
+	    nt = Num_tris_in_block3d(T,ix,iy,iz);
 	    if (nt < 2)
 		continue;
 
@@ -232,8 +236,8 @@ LIB_LOCAL  boolean  i_intersections3d(
 	    *    list of SURFACE's for this grid cube.
 	    */
 	    
-	    t = tris[iz][iy][ix];
-	    s = surfs[iz][iy][ix];
+	    t = Tris_in_block3d(T,ix,iy,iz);
+	    s = Surfs_in_block3d(T,ix,iy,iz);
 	    
 	        /* Loop over all pairs of Tris: */
 	    for (i = 0, t0 = t, s0 = s; i < nt - 1; ++i, ++t0, ++s0)
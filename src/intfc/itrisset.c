@@ -784,7 +784,7 @@ EXPORT	int	count_tris_in_box(
 	for(k=kmin[2]; k<kmax[2]; k++)
 	    for(j=kmin[1]; j<kmax[1]; j++)
 		for(i=kmin[0]; i<kmax[0]; i++)
-		    total_nt += T->num_of_tris[k][j][i];
+		    total_nt += Num_tris_in_block3d(T,i,j,k);
 	
 	return total_nt;
 }
@@ -808,8 +808,8 @@ EXPORT	int	set_tris_set_in_box(
 	    {
 		for (i = kmin[0]; i < kmax[0]; ++i)
 		{
-		    tris = T->tris[k][j][i];
-		    nt = T->num_of_tris[k][j][i];
+		    tris = Tris_in_block3d(T,i,j,k);
+		    nt = Num_tris_in_block3d(T,i,j,k);
 		    for (l = 0; l < nt; ++l)
 		    {
 		  	if (!tri_recorded(tris[l], test_tris, ntris))
@@ -3273,11 +3273,11 @@ EXPORT	boolean	check_valid_intfc(
 	    iy = ip[1];
 	    iz = ip[2];
 
-	    nt = T->num_of_tris[iz][iy][ix];
+	    nt = Num_tris_in_block3d(T,ix,iy,iz);
 	    if(nt == 0)
 		continue;
 
-	    tris = T->tris[iz][iy][ix];
+	    tris = Tris_in_block3d(T,ix,iy,iz);
 
 	    if(!check_valid_point(p, Tri_of_hse(hse), tris, nt, intfc))
 	    {
@@ -276,6 +276,27 @@ EXPORT	NODE *make_node(
 	return (*i_user_interface(current_interface())._make_node)(p);
 }		/*end make_node*/
 
+/*
+*	The *_in_interface() constructors build the object in the given
+*	interface without changing the current interface of the process.
+*	Several threads may build in different interfaces at once.
+*/
+
+EXPORT	NODE *make_node_in_interface(
+	INTERFACE	*intfc,
+	POINT		*p)
+{
+	INTFC_CONTEXT	ctx,*prev_ctx;
+	NODE		*newnod;
+
+	if (intfc == NULL)
+	    return NULL;
+	prev_ctx = enter_interface_context(intfc,&ctx);
+	newnod = (*i_user_interface(intfc)._make_node)(p);
+	leave_interface_context(prev_ctx);
+	return newnod;
+}		/*end make_node_in_interface*/
+
 EXPORT	NODE *copy_node(
 	NODE		*n)
 {
@@ -448,6 +469,25 @@ EXPORT	CURVE *make_curve(
 	return (*i_user_interface(intfc)._make_curve)(left_c,right_c,start,end);
 }		/*end make_curve*/
 
+EXPORT	CURVE *make_curve_in_interface(
+	INTERFACE	*intfc,
+	COMPONENT	left_c,
+	COMPONENT	right_c,
+	NODE		*start,
+	NODE		*end)
+{
+	INTFC_CONTEXT	ctx,*prev_ctx;
+	CURVE		*curve;
+
+	if (intfc == NULL)
+	    return NULL;
+	prev_ctx = enter_interface_context(intfc,&ctx);
+	curve = (*i_user_interface(intfc)._make_curve)(left_c,right_c,
+						       start,end);
+	leave_interface_context(prev_ctx);
+	return curve;
+}		/*end make_curve_in_interface*/
+
 EXPORT	CURVE *copy_curve(
 	CURVE		*c,
 	NODE		*start,
@@ -555,6 +595,22 @@ EXPORT	BOND *Bond(
 	return (*i_user_interface(intfc)._Bond)(start,end);
 }		/*end Bond*/
 
+EXPORT	BOND *Bond_in_interface(
+	INTERFACE	*intfc,
+	POINT		*start,
+	POINT		*end)
+{
+	INTFC_CONTEXT	ctx,*prev_ctx;
+	BOND		*b;
+
+	if (intfc == NULL)
+	    return NULL;
+	prev_ctx = enter_interface_context(intfc,&ctx);
+	b = (*i_user_interface(intfc)._Bond)(start,end);
+	leave_interface_context(prev_ctx);
+	return b;
+}		/*end Bond_in_interface*/
+
 EXPORT	BOND_TRI *link_tri_to_bond(
 	BOND_TRI *btri,
 	TRI	 *tri,
@@ -630,6 +686,21 @@ EXPORT	POINT *Point(
 	return (*i_user_interface(intfc)._Point)(crds);
 }		/*end Point*/
 
+EXPORT	POINT *Point_in_interface(
+	INTERFACE	*intfc,
+	double		*crds)
+{
+	INTFC_CONTEXT	ctx,*prev_ctx;
+	POINT		*p;
+
+	if (intfc == NULL)
+	    return NULL;
+	prev_ctx = enter_interface_context(intfc,&ctx);
+	p = (*i_user_interface(intfc)._Point)(crds);
+	leave_interface_context(prev_ctx);
+	return p;
+}		/*end Point_in_interface*/
+
 EXPORT	POINT *Static_point(
 	INTERFACE	*intfc)
 {
@@ -561,6 +561,7 @@ LOCAL	void	terminate_run(
 	    pp_abort(error,dump_core);
 #endif /* !defined(SIG_PP_TRAP) */
 
+	pp_thread_finalize();
 	(void) pp_finalize();
 
 #if defined(_CRAYMPP)
@@ -140,13 +140,22 @@ EXPORT	int	pp_init(
 
 	if (first == YES)
 	{
-	    int flag;
+	    int flag,provided;
 
 	    first = NO;
 	    status = MPI_Initialized(&flag);
+	    /* Threads of ppthread.c leave MPI to the master thread */
 	    if (!flag)
+	    	status = MPI_Init_thread(argc,argv,MPI_THREAD_FUNNELED,
+					&provided);
+	    else
+		(void) MPI_Query_thread(&provided);
+	    if (status == MPI_SUCCESS && provided < MPI_THREAD_FUNNELED)
 	    {
-	    	status = MPI_Init(argc,argv);
+		(void) printf("WARNING in pp_init(), MPI thread level %d "
+			      "is below MPI_THREAD_FUNNELED, "
+			      "running with one thread\n",provided);
+		pp_thread_limit(1);
 	    }
 	    FronTier_COMM = MPI_COMM_WORLD;
 	}
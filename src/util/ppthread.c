@@ -0,0 +1,220 @@
+/***************************************************************
+FronTier is a set of libraries that implements different types of
+Front Traking algorithms. Front Tracking is a numerical method for
+the solution of partial differential equations whose solutions have
+discontinuities.
+
+Copyright (C) 1999 by The University at Stony Brook.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+****************************************************************/
+
+/*
+*				ppthread.c
+*
+*	Thread runtime shared by the libraries and the solvers.
+*
+*	It sits on the OpenMP runtime that the threaded front and solver
+*	kernels already use, so all of them run on one persistent thread
+*	team whose size is set here once.  MPI communication stays on the
+*	master thread (MPI_THREAD_FUNNELED, see pp_init()).
+*
+*	pp_thread_init():	set the number of threads, start the team
+*	pp_thread_limit():	cap the number of threads
+*	pp_thread_finalize():	release the per thread scratch storage
+*	pp_num_threads():	number of threads of a parallel region
+*	pp_thread_num():	index of the calling thread
+*	pp_parallel_for():	dynamically scheduled loop over [0,n)
+*	pp_thread_scratch():	per thread scratch storage
+*
+*	The thread count is the argument of pp_thread_init() if positive,
+*	otherwise the environment variable FT_NUM_THREADS, otherwise the
+*	OpenMP default (OMP_NUM_THREADS or the number of cores), and at
+*	most the cap of pp_thread_limit().
+*/
+
+#include <cdecs.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif /* defined(_OPENMP) */
+
+struct _PP_SCRATCH {
+	POINTER	buf;
+	size_t	size;
+	char	pad[64 - sizeof(POINTER) - sizeof(size_t)];
+};
+typedef struct _PP_SCRATCH PP_SCRATCH;
+
+LOCAL	PP_SCRATCH	*scratch = NULL;
+LOCAL	int		num_scratch = 0;	/* threads with scratch */
+LOCAL	int		num_threads = 1;
+LOCAL	int		thread_limit = 0;	/* 0: no cap */
+
+/*
+*	Caps the number of threads of the runtime, e.g. to one when the
+*	MPI library does not support threads.  Applies to the OpenMP
+*	default at once and to later calls of pp_thread_init().  The
+*	scratch of the threads above the cap stays allocated until
+*	pp_thread_finalize().
+*/
+
+EXPORT	void	pp_thread_limit(
+	int	nthreads)
+{
+	thread_limit = nthreads;
+#if defined(_OPENMP)
+	if (thread_limit > 0 && omp_get_max_threads() > thread_limit)
+	    omp_set_num_threads(thread_limit);
+#endif /* defined(_OPENMP) */
+	if (thread_limit > 0 && num_threads > thread_limit)
+	    num_threads = thread_limit;
+}		/*end pp_thread_limit*/
+
+EXPORT	void	pp_thread_init(
+	int	nthreads)
+{
+	const char *env;
+	int	i;
+
+	pp_thread_finalize();
+	if (nthreads <= 0 && (env = getenv("FT_NUM_THREADS")) != NULL)
+	    nthreads = atoi(env);
+#if defined(_OPENMP)
+	if (thread_limit > 0 && (nthreads <= 0 || nthreads > thread_limit))
+	    nthreads = min(thread_limit,omp_get_max_threads());
+	if (nthreads > 0)
+	    omp_set_num_threads(nthreads);
+	num_threads = omp_get_max_threads();
+#else /* defined(_OPENMP) */
+	num_threads = 1;
+#endif /* defined(_OPENMP) */
+
+	scratch = (PP_SCRATCH*) malloc(num_threads*sizeof(PP_SCRATCH));
+	if (scratch == NULL)
+	{
+	    screen("ERROR in pp_thread_init(), "
+	           "can't allocate scratch of %d threads\n",num_threads);
+	    clean_up(ERROR);
+	}
+	num_scratch = num_threads;
+	for (i = 0; i < num_scratch; ++i)
+	{
+	    scratch[i].buf = NULL;
+	    scratch[i].size = 0;
+	}
+
+	/* Start the team now rather than in the first kernel */
+#if defined(_OPENMP)
+#pragma omp parallel
+	{
+	}
+#endif /* defined(_OPENMP) */
+	if (debugging("pp_thread"))
+	    (void) printf("pp_thread_init(): %d threads\n",num_threads);
+}		/*end pp_thread_init*/
+
+EXPORT	void	pp_thread_finalize(void)
+{
+	int	i;
+
+	if (scratch == NULL)
+	    return;
+	for (i = 0; i < num_scratch; ++i)
+	    if (scratch[i].buf != NULL)
+		free(scratch[i].buf);
+	free(scratch);
+	scratch = NULL;
+	num_scratch = 0;
+}		/*end pp_thread_finalize*/
+
+EXPORT	int	pp_num_threads(void)
+{
+	return num_threads;
+}		/*end pp_num_threads*/
+
+EXPORT	int	pp_thread_num(void)
+{
+#if defined(_OPENMP)
+	return omp_get_thread_num();
+#else /* defined(_OPENMP) */
+	return 0;
+#endif /* defined(_OPENMP) */
+}		/*end pp_thread_num*/
+
+/*
+*	Calls body(lo,hi,arg) on chunks [lo,hi) of [0,n) of grain iterations
+*	each.  Idle threads take the next chunk, so the load balances when
+*	the cost of the iterations varies.  grain <= 0 selects about eight
+*	chunks per thread.  Runs serially for a single chunk or thread, or
+*	when called from inside a parallel region.
+*/
+
+EXPORT	void	pp_parallel_for(
+	long	n,
+	long	grain,
+	void	(*body)(long,long,POINTER),
+	POINTER	arg)
+{
+	long	c,nchunks;
+
+	if (n <= 0)
+	    return;
+	if (grain <= 0)
+	    grain = max(1,n/(8*num_threads));
+	nchunks = (n + grain - 1)/grain;
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic,1) \
+		if (nchunks > 1 && num_threads > 1 && !omp_in_parallel())
+#endif /* defined(_OPENMP) */
+	for (c = 0; c < nchunks; ++c)
+	    (*body)(c*grain,min(n,(c+1)*grain),arg);
+}		/*end pp_parallel_for*/
+
+/*
+*	Scratch storage of at least nbytes for the calling thread.  It is
+*	reused by the next call from the same thread, which may move it.
+*	Valid between pp_thread_init() and pp_thread_finalize(), in regions
+*	of at most pp_num_threads() threads.
+*/
+
+EXPORT	POINTER	pp_thread_scratch(
+	size_t	nbytes)
+{
+	PP_SCRATCH *s;
+	int	tid = pp_thread_num();
+
+	if (scratch == NULL || tid >= num_scratch)
+	{
+	    screen("ERROR in pp_thread_scratch(), thread %d of %d, "
+	           "runtime not initialized\n",tid,num_scratch);
+	    clean_up(ERROR);
+	}
+	s = scratch + tid;
+	if (s->size < nbytes)
+	{
+	    if (s->buf != NULL)
+		free(s->buf);
+	    s->size = max(nbytes,2*s->size);
+	    s->buf = (POINTER) malloc(s->size);
+	    if (s->buf == NULL)
+	    {
+		screen("ERROR in pp_thread_scratch(), "
+		       "can't allocate %lu bytes\n",(unsigned long)s->size);
+		clean_up(ERROR);
+	    }
+	}
+	return s->buf;
+}		/*end pp_thread_scratch*/
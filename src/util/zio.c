@@ -0,0 +1,601 @@
+/***************************************************************
+FronTier is a set of libraries that implements different types of
+Front Traking algorithms. Front Tracking is a numerical method for
+the solution of partial differential equations whose solutions have
+discontinuities.
+
+Copyright (C) 1999 by The University at Stony Brook.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+****************************************************************/
+
+/*
+*				zio.c
+*
+*	Compressed arrays and files for the checkpoints.
+*
+*	An array is written as a block of independently compressed chunks:
+*
+*		magic "FTZC", shuffle flag, element size,
+*		number of elements, elements per chunk, number of chunks,
+*		compressed size of each chunk,
+*		the chunks.
+*
+*	Each chunk is byte shuffled (the k-th bytes of all its elements
+*	are stored together, so the slowly varying high bytes of a smooth
+*	field form long runs) and deflated with zlib.  A chunk that does
+*	not shrink, or any chunk when the library is built without zlib,
+*	is stored as is.  The chunks are compressed and expanded in
+*	parallel by the thread runtime of ppthread.c, and the index lets
+*	fread_compressed_array_range() read only the chunks that cover a
+*	range of elements.  The block is in the byte order of the writer.
+*
+*	set_compressed_output():	turn compressed checkpoints on/off
+*	fwrite_compressed_array():	write an array as a block
+*	fread_compressed_array():	read a block
+*	fread_compressed_array_range():	read elements [first,first+n)
+*	fcompress_and_close():		store a scratch stream compressed
+*	fopen_uncompressed():		open a plain or compressed file
+*/
+
+#include <cdecs.h>
+#include <stdint.h>
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif /* defined(HAVE_ZLIB) */
+
+enum {
+	ZIO_CHUNK_BYTES = 1 << 20,
+	ZIO_MAGIC_LEN = 4
+};
+
+LOCAL	const char zio_magic[ZIO_MAGIC_LEN] = {'F','T','Z','C'};
+
+struct _ZIO_HEADER {
+	uint32_t shuffle;
+	uint32_t elem_size;
+	uint64_t num_elems;
+	uint64_t chunk_elems;
+	uint64_t num_chunks;
+};
+typedef struct _ZIO_HEADER ZIO_HEADER;
+
+struct _ZIO_CHUNKS {
+	const ZIO_HEADER *h;
+	uint64_t	first_chunk;
+	unsigned char	*raw;		/* elements of the first chunk on */
+	unsigned char	**cbuf;		/* compressed chunks */
+	uint64_t	*csize;
+	unsigned char	*failed;	/* chunks the threads could not do */
+};
+typedef struct _ZIO_CHUNKS ZIO_CHUNKS;
+
+LOCAL	POINTER	zio_alloc(size_t);
+LOCAL	boolean	read_zio_header(FILE*,ZIO_HEADER*);
+LOCAL	long	first_failed_chunk(const ZIO_CHUNKS*,long);
+LOCAL	size_t	chunk_bytes(const ZIO_HEADER*,uint64_t);
+LOCAL	void	compress_chunks(long,long,POINTER);
+LOCAL	void	expand_chunks(long,long,POINTER);
+LOCAL	void	shuffle_bytes(unsigned char*,const unsigned char*,size_t,
+			      size_t);
+LOCAL	void	unshuffle_bytes(unsigned char*,const unsigned char*,size_t,
+			        size_t);
+
+LOCAL boolean compressed_output = NO;
+
+EXPORT void set_compressed_output(
+	boolean		yes_no)
+{
+	compressed_output = yes_no;
+}		/*end set_compressed_output*/
+
+EXPORT boolean is_compressed_output(void)
+{
+	return compressed_output;
+}		/*end is_compressed_output*/
+
+EXPORT	void	fwrite_compressed_array(
+	FILE		*file,
+	const void	*array,
+	size_t		elem_size,
+	size_t		num_elems)
+{
+	ZIO_HEADER	h;
+	ZIO_CHUNKS	c;
+	uint64_t	i;
+
+	h.shuffle = (elem_size > 1) ? 1 : 0;
+	h.elem_size = (uint32_t) elem_size;
+	h.num_elems = num_elems;
+	h.chunk_elems = max(1,ZIO_CHUNK_BYTES/elem_size);
+	h.num_chunks = (num_elems + h.chunk_elems - 1)/h.chunk_elems;
+
+	c.h = &h;
+	c.first_chunk = 0;
+	c.raw = (unsigned char*) array;
+	c.cbuf = NULL;
+	c.csize = NULL;
+	c.failed = NULL;
+	if (h.num_chunks > 0)
+	{
+	    c.cbuf = (unsigned char**) zio_alloc(h.num_chunks*
+						  sizeof(unsigned char*));
+	    c.csize = (uint64_t*) zio_alloc(h.num_chunks*sizeof(uint64_t));
+	    c.failed = (unsigned char*) zio_alloc(h.num_chunks);
+	    memset(c.failed,0,h.num_chunks);
+	    pp_parallel_for((long)h.num_chunks,1,compress_chunks,
+	    		    (POINTER)&c);
+	    if ((i = first_failed_chunk(&c,(long)h.num_chunks)) <
+	    		h.num_chunks)
+	    {
+	    	screen("ERROR in fwrite_compressed_array(), "
+		       "can't allocate chunk %lu\n",(unsigned long)i);
+	    	clean_up(ERROR);
+	    }
+	}
+
+	if (fwrite(zio_magic,1,ZIO_MAGIC_LEN,file) != ZIO_MAGIC_LEN ||
+	    fwrite(&h.shuffle,sizeof(uint32_t),1,file) != 1 ||
+	    fwrite(&h.elem_size,sizeof(uint32_t),1,file) != 1 ||
+	    fwrite(&h.num_elems,sizeof(uint64_t),1,file) != 1 ||
+	    fwrite(&h.chunk_elems,sizeof(uint64_t),1,file) != 1 ||
+	    fwrite(&h.num_chunks,sizeof(uint64_t),1,file) != 1 ||
+	    fwrite(c.csize,sizeof(uint64_t),h.num_chunks,file) != h.num_chunks)
+	{
+	    screen("ERROR in fwrite_compressed_array(), "
+	           "can't write block header\n");
+	    clean_up(ERROR);
+	}
+	for (i = 0; i < h.num_chunks; ++i)
+	{
+	    if (fwrite(c.cbuf[i],1,c.csize[i],file) != c.csize[i])
+	    {
+	    	screen("ERROR in fwrite_compressed_array(), "
+		       "can't write chunk %lu\n",(unsigned long)i);
+	    	clean_up(ERROR);
+	    }
+	    free(c.cbuf[i]);
+	}
+	if (h.num_chunks > 0)
+	{
+	    free(c.cbuf);
+	    free(c.csize);
+	    free(c.failed);
+	}
+}		/*end fwrite_compressed_array*/
+
+/*
+*	Reads a block written by fwrite_compressed_array() into array,
+*	which holds at most max_elems elements of elem_size bytes.  Returns
+*	the number of elements read and leaves the file after the block.
+*/
+
+EXPORT	size_t	fread_compressed_array(
+	FILE		*file,
+	void		*array,
+	size_t		elem_size,
+	size_t		max_elems)
+{
+	long		start = ftell(file);
+	ZIO_HEADER	h;
+
+	if (!read_zio_header(file,&h))
+	{
+	    screen("ERROR in fread_compressed_array(), "
+	           "no compressed block at offset %ld\n",start);
+	    clean_up(ERROR);
+	}
+	if (h.num_elems > max_elems)
+	{
+	    screen("ERROR in fread_compressed_array(), "
+	           "block of %lu elements, room for %lu\n",
+		   (unsigned long)h.num_elems,(unsigned long)max_elems);
+	    clean_up(ERROR);
+	}
+	(void) fseek(file,start,SEEK_SET);
+	return fread_compressed_array_range(file,array,elem_size,0,
+					    (size_t)h.num_elems);
+}		/*end fread_compressed_array*/
+
+/*
+*	Reads elements [first,first+n) of a block into array, reading and
+*	expanding only the chunks that cover them.  Returns the number of
+*	elements read, which is less than n if the block ends earlier, and
+*	leaves the file after the block.
+*/
+
+EXPORT	size_t	fread_compressed_array_range(
+	FILE		*file,
+	void		*array,
+	size_t		elem_size,
+	size_t		first,
+	size_t		n)
+{
+	long		start = ftell(file);
+	long		data,offset;
+	ZIO_HEADER	h;
+	ZIO_CHUNKS	c;
+	uint64_t	*csize;
+	uint64_t	i,last,c0,c1;
+	size_t		nbytes;
+
+	if (!read_zio_header(file,&h))
+	{
+	    screen("ERROR in fread_compressed_array_range(), "
+	           "no compressed block at offset %ld\n",start);
+	    clean_up(ERROR);
+	}
+	if (h.elem_size != elem_size)
+	{
+	    screen("ERROR in fread_compressed_array_range(), "
+	           "block of %u byte elements read as %lu byte elements\n",
+		   h.elem_size,(unsigned long)elem_size);
+	    clean_up(ERROR);
+	}
+	csize = NULL;
+	if (h.num_chunks > 0)
+	{
+	    csize = (uint64_t*) zio_alloc(h.num_chunks*sizeof(uint64_t));
+	    if (fread(csize,sizeof(uint64_t),h.num_chunks,file) !=
+	    		h.num_chunks)
+	    {
+	    	screen("ERROR in fread_compressed_array_range(), "
+		       "truncated chunk index\n");
+	    	clean_up(ERROR);
+	    }
+	}
+	data = ftell(file);
+
+	last = min(first + n,h.num_elems);
+	n = (first < last) ? (size_t)(last - first) : 0;
+	if (n > 0)
+	{
+	    c0 = first/h.chunk_elems;
+	    c1 = (last - 1)/h.chunk_elems + 1;
+	    for (offset = data, i = 0; i < c0; ++i)
+	    	offset += (long)csize[i];
+	    (void) fseek(file,offset,SEEK_SET);
+
+	    c.h = &h;
+	    c.first_chunk = c0;
+	    c.csize = csize + c0;
+	    c.cbuf = (unsigned char**) zio_alloc((c1-c0)*
+						  sizeof(unsigned char*));
+	    for (i = c0; i < c1; ++i)
+	    {
+	    	c.cbuf[i-c0] = (unsigned char*) zio_alloc(max(1,csize[i]));
+	    	if (fread(c.cbuf[i-c0],1,csize[i],file) != csize[i])
+		{
+		    screen("ERROR in fread_compressed_array_range(), "
+		           "truncated chunk %lu\n",(unsigned long)i);
+		    clean_up(ERROR);
+		}
+	    }
+	    nbytes = (size_t)(c1*h.chunk_elems - c0*h.chunk_elems)*elem_size;
+	    c.raw = (unsigned char*) zio_alloc(nbytes);
+	    c.failed = (unsigned char*) zio_alloc(c1-c0);
+	    memset(c.failed,0,c1-c0);
+	    pp_parallel_for((long)(c1-c0),1,expand_chunks,(POINTER)&c);
+	    if ((i = first_failed_chunk(&c,(long)(c1-c0))) < c1-c0)
+	    {
+	    	screen("ERROR in fread_compressed_array_range(), "
+		       "can't expand chunk %lu\n",(unsigned long)(c0 + i));
+	    	clean_up(ERROR);
+	    }
+
+	    memcpy(array,c.raw + (first - c0*h.chunk_elems)*elem_size,
+	    	   n*elem_size);
+	    for (i = c0; i < c1; ++i)
+	    	free(c.cbuf[i-c0]);
+	    free(c.cbuf);
+	    free(c.raw);
+	    free(c.failed);
+	}
+
+	for (offset = data, i = 0; i < h.num_chunks; ++i)
+	    offset += (long)csize[i];
+	(void) fseek(file,offset,SEEK_SET);
+	if (csize != NULL)
+	    free(csize);
+	return n;
+}		/*end fread_compressed_array_range*/
+
+/*
+*	Stores everything written to the scratch stream tmp (from tmpfile())
+*	in fname as one compressed block of bytes, and closes tmp.
+*/
+
+EXPORT	void	fcompress_and_close(
+	FILE		*tmp,
+	const char	*fname)
+{
+	FILE		*file;
+	unsigned char	*buf = NULL;
+	long		size;
+
+	(void) fflush(tmp);
+	(void) fseek(tmp,0L,SEEK_END);
+	size = ftell(tmp);
+	rewind(tmp);
+	if (size > 0)
+	{
+	    buf = (unsigned char*) zio_alloc(size);
+	    if (fread(buf,1,size,tmp) != (size_t)size)
+	    {
+	    	screen("ERROR in fcompress_and_close(), "
+		       "can't read back scratch stream of %s\n",fname);
+	    	clean_up(ERROR);
+	    }
+	}
+	(void) fclose(tmp);
+
+	if ((file = fopen(fname,"w")) == NULL)
+	{
+	    screen("ERROR in fcompress_and_close(), can't open %s\n",fname);
+	    clean_up(ERROR);
+	}
+	fwrite_compressed_array(file,buf,1,(size_t)size);
+	(void) fclose(file);
+	if (buf != NULL)
+	    free(buf);
+}		/*end fcompress_and_close*/
+
+/*
+*	Opens fname for reading.  A file written by fcompress_and_close()
+*	is expanded into a scratch stream, which is returned instead, so
+*	the readers need not know how the file was stored.  Returns NULL
+*	if fname can't be opened.
+*/
+
+EXPORT	FILE	*fopen_uncompressed(
+	const char	*fname)
+{
+	FILE		*file,*tmp;
+	ZIO_HEADER	h;
+	unsigned char	*buf;
+
+	if ((file = fopen(fname,"r")) == NULL)
+	    return NULL;
+	if (!read_zio_header(file,&h) || h.elem_size != 1)
+	{
+	    rewind(file);
+	    return file;
+	}
+	rewind(file);
+
+	buf = NULL;
+	if (h.num_elems > 0)
+	    buf = (unsigned char*) zio_alloc(h.num_elems);
+	(void) fread_compressed_array(file,buf,1,(size_t)h.num_elems);
+	(void) fclose(file);
+
+	if ((tmp = tmpfile()) == NULL ||
+	    fwrite(buf,1,(size_t)h.num_elems,tmp) != h.num_elems)
+	{
+	    screen("ERROR in fopen_uncompressed(), "
+	           "can't expand %s into a scratch stream\n",fname);
+	    clean_up(ERROR);
+	}
+	rewind(tmp);
+	if (buf != NULL)
+	    free(buf);
+	return tmp;
+}		/*end fopen_uncompressed*/
+
+/*
+*	Storage of the blocks.  It comes from malloc() rather than the
+*	bookkeeping of vmalloc.h, as the threads allocate their chunks
+*	with malloc() too.
+*/
+
+LOCAL	POINTER	zio_alloc(
+	size_t		nbytes)
+{
+	POINTER		p = (POINTER) malloc((nbytes > 0) ? nbytes : 1);
+
+	if (p == NULL)
+	{
+	    screen("ERROR in zio_alloc(), can't allocate %lu bytes\n",
+	    	   (unsigned long)nbytes);
+	    clean_up(ERROR);
+	}
+	return p;
+}		/*end zio_alloc*/
+
+LOCAL	boolean	read_zio_header(
+	FILE		*file,
+	ZIO_HEADER	*h)
+{
+	char		magic[ZIO_MAGIC_LEN];
+
+	if (fread(magic,1,ZIO_MAGIC_LEN,file) != ZIO_MAGIC_LEN ||
+	    memcmp(magic,zio_magic,ZIO_MAGIC_LEN) != 0)
+	    return NO;
+	if (fread(&h->shuffle,sizeof(uint32_t),1,file) != 1 ||
+	    fread(&h->elem_size,sizeof(uint32_t),1,file) != 1 ||
+	    fread(&h->num_elems,sizeof(uint64_t),1,file) != 1 ||
+	    fread(&h->chunk_elems,sizeof(uint64_t),1,file) != 1 ||
+	    fread(&h->num_chunks,sizeof(uint64_t),1,file) != 1)
+	    return NO;
+	return (h->elem_size > 0 && h->chunk_elems > 0) ? YES : NO;
+}		/*end read_zio_header*/
+
+/*
+*	The threads of compress_chunks() and expand_chunks() can't report
+*	an error, so each marks its failed chunks in c->failed and the
+*	caller reports the first of them after the parallel loop.  Returns
+*	num_chunks if none failed.
+*/
+
+LOCAL	long	first_failed_chunk(
+	const ZIO_CHUNKS *c,
+	long		num_chunks)
+{
+	long		i;
+
+	for (i = 0; i < num_chunks; ++i)
+	    if (c->failed[i])
+	    	break;
+	return i;
+}		/*end first_failed_chunk*/
+
+/*
+*	Number of bytes of chunk i.
+*/
+
+LOCAL	size_t	chunk_bytes(
+	const ZIO_HEADER *h,
+	uint64_t	i)
+{
+	uint64_t	lo = i*h->chunk_elems;
+	uint64_t	hi = min(lo + h->chunk_elems,h->num_elems);
+
+	return (size_t)(hi - lo)*h->elem_size;
+}		/*end chunk_bytes*/
+
+/*
+*	pp_parallel_for() body: shuffles and deflates chunks [lo,hi),
+*	marking in c->failed those it has no storage for.
+*/
+
+LOCAL	void	compress_chunks(
+	long		lo,
+	long		hi,
+	POINTER		arg)
+{
+	ZIO_CHUNKS	*c = (ZIO_CHUNKS*)arg;
+	const ZIO_HEADER *h = c->h;
+	const unsigned char *src;
+	unsigned char	*tmp;
+	size_t		nbytes;
+	long		i;
+
+	for (i = lo; i < hi; ++i)
+	{
+	    src = c->raw + (size_t)i*h->chunk_elems*h->elem_size;
+	    nbytes = chunk_bytes(h,i);
+	    tmp = NULL;
+	    c->cbuf[i] = (unsigned char*) malloc(max(1,nbytes));
+	    c->csize[i] = nbytes;
+	    if (h->shuffle &&
+	        (tmp = (unsigned char*) malloc(max(1,nbytes))) == NULL)
+	    	c->failed[i] = 1;
+	    if (c->cbuf[i] == NULL)
+	    	c->failed[i] = 1;
+	    if (c->failed[i])
+	    {
+	    	if (tmp != NULL)
+		    free(tmp);
+	    	continue;
+	    }
+	    if (tmp != NULL)
+	    {
+	    	shuffle_bytes(tmp,src,nbytes/h->elem_size,h->elem_size);
+		src = tmp;
+	    }
+#if defined(HAVE_ZLIB)
+	    {
+	    	uLongf len = (uLongf) nbytes;
+
+	    	if (compress2(c->cbuf[i],&len,src,(uLong)nbytes,
+				Z_DEFAULT_COMPRESSION) == Z_OK && len < nbytes)
+		    c->csize[i] = len;
+	    }
+#endif /* defined(HAVE_ZLIB) */
+	    if (c->csize[i] == nbytes)
+	    	memcpy(c->cbuf[i],src,nbytes);
+	    if (tmp != NULL)
+	    	free(tmp);
+	}
+}		/*end compress_chunks*/
+
+/*
+*	pp_parallel_for() body: inflates and unshuffles chunks
+*	first_chunk + [lo,hi) into c->raw, marking in c->failed those
+*	that are corrupt or have no storage.
+*/
+
+LOCAL	void	expand_chunks(
+	long		lo,
+	long		hi,
+	POINTER		arg)
+{
+	ZIO_CHUNKS	*c = (ZIO_CHUNKS*)arg;
+	const ZIO_HEADER *h = c->h;
+	unsigned char	*dst,*tmp;
+	size_t		nbytes;
+	long		i;
+
+	for (i = lo; i < hi; ++i)
+	{
+	    dst = c->raw + (size_t)i*h->chunk_elems*h->elem_size;
+	    nbytes = chunk_bytes(h,c->first_chunk + i);
+	    tmp = NULL;
+	    if (h->shuffle &&
+	        (tmp = (unsigned char*) malloc(max(1,nbytes))) == NULL)
+	    {
+	    	c->failed[i] = 1;
+	    	continue;
+	    }
+	    if (c->csize[i] == nbytes)
+	    	memcpy((tmp != NULL) ? tmp : dst,c->cbuf[i],nbytes);
+	    else
+	    {
+#if defined(HAVE_ZLIB)
+	    	uLongf len = (uLongf) nbytes;
+
+	    	if (uncompress((tmp != NULL) ? tmp : dst,&len,c->cbuf[i],
+				(uLong)c->csize[i]) != Z_OK || len != nbytes)
+#endif /* defined(HAVE_ZLIB) */
+		{
+		    c->failed[i] = 1;
+		    if (tmp != NULL)
+		    	free(tmp);
+		    continue;
+		}
+	    }
+	    if (tmp != NULL)
+	    {
+	    	unshuffle_bytes(dst,tmp,nbytes/h->elem_size,h->elem_size);
+	    	free(tmp);
+	    }
+	}
+}		/*end expand_chunks*/
+
+LOCAL	void	shuffle_bytes(
+	unsigned char	*dst,
+	const unsigned char *src,
+	size_t		n,
+	size_t		elem_size)
+{
+	size_t		i,b;
+
+	for (b = 0; b < elem_size; ++b)
+	    for (i = 0; i < n; ++i)
+	    	dst[b*n + i] = src[i*elem_size + b];
+}		/*end shuffle_bytes*/
+
+LOCAL	void	unshuffle_bytes(
+	unsigned char	*dst,
+	const unsigned char *src,
+	size_t		n,
+	size_t		elem_size)
+{
+	size_t		i,b;
+
+	for (b = 0; b < elem_size; ++b)
+	    for (i = 0; i < n; ++i)
+	    	dst[i*elem_size + b] = src[b*n + i];
+}		/*end unshuffle_bytes*/
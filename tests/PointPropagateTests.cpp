@@ -0,0 +1,190 @@
+#include "FronTier.h"
+#include "gtest/gtest.h"
+
+#include <map>
+#include <vector>
+
+namespace {
+
+// A ball cut in two by a plane: three surfaces meeting at a circle.
+// The plane avoids the grid so no grid edge sees three components.
+int splitBallComp(POINTER, double *coords)
+{
+	double r2 = sqr(coords[0] - 0.488) + sqr(coords[1] - 0.51) +
+		    sqr(coords[2] - 0.49);
+	if (r2 >= sqr(0.28))
+	    return 3;
+	return (coords[0] < 0.498) ? 1 : 2;
+}
+
+std::map<POINT*,int> vfunc_calls;
+long batch_points;
+
+// Depends on the surface, so a curve point moves differently for each
+// surface next to it.
+int surfaceVelocity(POINTER, Front*, POINT *p, HYPER_SURF_ELEMENT*,
+	HYPER_SURF *hs, double *vel)
+{
+	double s = 0.1*(negative_component(hs) + 2*positive_component(hs));
+#pragma omp critical (surface_velocity)
+	++vfunc_calls[p];
+	vel[0] = s;
+	vel[1] = 0.5*s;
+	vel[2] = -0.3*s;
+	return YES;
+}
+
+// Depends on the normal, which a curve point takes from its surface.
+int normalVelocityBatch(POINTER, Front*, int n, double **coords,
+	double **nor, double*, double **vel)
+{
+#pragma omp atomic
+	batch_points += n;
+	for (int i = 0; i < 3; ++i)
+	    for (int k = 0; k < n; ++k)
+		vel[i][k] = 0.2*nor[i][k] + 0.01*coords[i][k];
+	return YES;
+}
+
+class PointPropagateTests : public ::testing::Test
+{
+    protected:
+	static void SetUpTestCase()
+	{
+	    static F_BASIC_DATA f_basic;
+	    static LEVEL_FUNC_PACK level_func_pack;
+	    char name[] = "PointPropagateTests", dflag[] = "-d", dim[] = "3";
+	    char *argv[] = {name,dflag,dim};
+	    SURFACE *s[10];
+	    CURVE *c[10];
+	    int i,ns,nc;
+
+	    FT_Init(3,argv,&f_basic);
+	    f_basic.dim = 3;
+	    for (i = 0; i < 3; ++i)
+	    {
+		f_basic.L[i] = 0.0;
+		f_basic.U[i] = 1.0;
+		f_basic.gmax[i] = 16;
+		f_basic.boundary[i][0] = f_basic.boundary[i][1] =
+				DIRICHLET_BOUNDARY;
+	    }
+	    f_basic.size_of_intfc_state = 0;
+	    FT_StartUp(&front,&f_basic);
+	    level_func_pack.pos_component = 3;
+	    FT_InitIntfc(&front,&level_func_pack);
+
+	    set_current_interface(front.interf);
+	    make_surfaces_from_comp(front.rect_grid,splitBallComp,NULL,
+				s,c,&ns,&nc);
+	    for (SURFACE **ps = front.interf->surfaces; ps && *ps; ++ps)
+		wave_type(*ps) = FIRST_PHYSICS_WAVE_TYPE;
+	    Tracking_algorithm(&front) = GRID_FREE_TRACKING;
+	    front.dt = 0.01;
+	    initial = copy_interface(front.interf);
+	}
+
+	// Coordinates of the new points, in next_point() order
+	static std::vector<double> propagate(
+		VELO_FUNC_PACK *vel_pack,
+		int nthreads)
+	{
+	    std::vector<double> x;
+	    HYPER_SURF_ELEMENT *hse;
+	    HYPER_SURF *hs;
+	    POINT *p;
+	    Front *newfront;
+	    double dt_frac;
+
+	    pp_thread_init(nthreads);
+	    FT_InitFrontVeloFunc(&front,vel_pack);
+	    vfunc_calls.clear();
+	    batch_points = 0;
+	    front.interf = copy_interface(initial);
+	    newfront = NULL;
+	    (void) FrontAdvance(front.dt,&dt_frac,&front,&newfront,NULL);
+	    EXPECT_TRUE(newfront != NULL);
+	    if (newfront == NULL)
+		return x;
+	    assign_interface_and_free_front(&front,newfront);
+	    (void) next_point(front.interf,NULL,NULL,NULL);
+	    while (next_point(front.interf,&p,&hse,&hs))
+		x.insert(x.end(),Coords(p),Coords(p) + 3);
+	    delete_interface(front.interf);
+	    front.interf = NULL;
+	    return x;
+	}
+
+	// Number of distinct points of the initial interface
+	static size_t numPoints()
+	{
+	    std::map<POINT*,int> points;
+	    HYPER_SURF_ELEMENT *hse;
+	    HYPER_SURF *hs;
+	    POINT *p;
+	    int n = 0;
+
+	    (void) next_point(initial,NULL,NULL,NULL);
+	    while (next_point(initial,&p,&hse,&hs))
+	    {
+		++points[p];
+		++n;
+	    }
+	    EXPECT_LT(points.size(),(size_t)n);	// curve points repeat
+	    return points.size();
+	}
+
+	static Front front;
+	static INTERFACE *initial;
+};
+
+Front PointPropagateTests::front;
+INTERFACE *PointPropagateTests::initial = NULL;
+
+VELO_FUNC_PACK pointPack(boolean reentrant)
+{
+	VELO_FUNC_PACK vel_pack;
+
+	zero_scalar(&vel_pack,sizeof(VELO_FUNC_PACK));
+	vel_pack.func = surfaceVelocity;
+	vel_pack.point_propagate = first_order_point_propagate;
+	vel_pack.reentrant = reentrant;
+	return vel_pack;
+}
+
+}	// namespace
+
+TEST_F(PointPropagateTests, EachPointPropagatedOnce)
+{
+	size_t n = numPoints();
+	VELO_FUNC_PACK vel_pack = pointPack(YES);
+
+	propagate(&vel_pack,4);
+	EXPECT_EQ(n,vfunc_calls.size());
+	for (std::map<POINT*,int>::iterator it = vfunc_calls.begin();
+	     it != vfunc_calls.end(); ++it)
+	    ASSERT_EQ(1,it->second);
+}
+
+TEST_F(PointPropagateTests, PointLoopIndependentOfThreads)
+{
+	VELO_FUNC_PACK serial = pointPack(NO);
+	VELO_FUNC_PACK threaded = pointPack(YES);
+
+	std::vector<double> x = propagate(&serial,1);
+	EXPECT_TRUE(x == propagate(&threaded,1));
+	EXPECT_TRUE(x == propagate(&threaded,4));
+}
+
+TEST_F(PointPropagateTests, BatchIndependentOfThreads)
+{
+	size_t n = numPoints();
+	VELO_FUNC_PACK vel_pack = pointPack(YES);
+
+	vel_pack.batch_func = normalVelocityBatch;
+	vel_pack.batch_needs = VELO_NEED_NORMAL;
+	std::vector<double> x = propagate(&vel_pack,1);
+	EXPECT_EQ((long)n,batch_points);
+	EXPECT_TRUE(x == propagate(&vel_pack,4));
+	EXPECT_EQ((long)n,batch_points);
+}
@@ -0,0 +1,174 @@
+#include "FronTier.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdint.h>
+#include <vector>
+
+namespace {
+
+const size_t chunk_bytes = 1 << 20;	// ZIO_CHUNK_BYTES of zio.c
+const long header_bytes = 4 + 4 + 4 + 8 + 8 + 8;
+
+class ZioTests : public ::testing::Test
+{
+    protected:
+	void SetUp()
+	{
+	    pp_thread_init(4);
+	    file = tmpfile();
+	    ASSERT_TRUE(file != NULL);
+	}
+	void TearDown()
+	{
+	    fclose(file);
+	    pp_thread_finalize();
+	}
+	long fileSize()
+	{
+	    fseek(file,0L,SEEK_END);
+	    return ftell(file);
+	}
+	FILE *file;
+};
+
+std::vector<double> smoothField(size_t n)
+{
+	std::vector<double> a(n);
+	for (size_t i = 0; i < n; ++i)
+	    a[i] = 1.0 + 0.25*sin(1.0e-4*i);
+	return a;
+}
+
+std::vector<unsigned char> randomBytes(size_t n)
+{
+	std::vector<unsigned char> a(n);
+	unsigned long x = 12345;
+	for (size_t i = 0; i < n; ++i)
+	{
+	    x = x*6364136223846793005UL + 1442695040888963407UL;
+	    a[i] = (unsigned char)(x >> 56);
+	}
+	return a;
+}
+
+}	// namespace
+
+TEST_F(ZioTests, DoublesRoundTrip)
+{
+	// Three chunks, the last one partial
+	const size_t n = 2*(chunk_bytes/sizeof(double)) + 1000;
+	std::vector<double> a = smoothField(n);
+	std::vector<double> b(n,0.0);
+
+	fwrite_compressed_array(file,&a[0],sizeof(double),n);
+	long end = ftell(file);
+#if defined(HAVE_ZLIB)
+	EXPECT_LT(end,(long)(n*sizeof(double)));
+#endif /* defined(HAVE_ZLIB) */
+
+	rewind(file);
+	EXPECT_EQ(n,fread_compressed_array(file,&b[0],sizeof(double),n));
+	EXPECT_EQ(end,ftell(file));
+	EXPECT_TRUE(a == b);
+}
+
+TEST_F(ZioTests, RangeSpanningChunks)
+{
+	const size_t chunk_elems = chunk_bytes/sizeof(double);
+	const size_t n = 3*chunk_elems + 17;
+	std::vector<double> a = smoothField(n);
+
+	fwrite_compressed_array(file,&a[0],sizeof(double),n);
+	long end = ftell(file);
+
+	// Starts and ends inside a chunk, across two chunk boundaries
+	size_t first = chunk_elems/2, m = 2*chunk_elems;
+	std::vector<double> b(m,0.0);
+	rewind(file);
+	EXPECT_EQ(m,fread_compressed_array_range(file,&b[0],sizeof(double),
+						  first,m));
+	EXPECT_EQ(end,ftell(file));
+	for (size_t i = 0; i < m; ++i)
+	    ASSERT_EQ(a[first+i],b[i]) << "element " << first+i;
+
+	// Inside the partial last chunk, cut off by the end of the block
+	first = 3*chunk_elems + 5;
+	rewind(file);
+	EXPECT_EQ(n-first,fread_compressed_array_range(file,&b[0],
+						       sizeof(double),first,m));
+	EXPECT_EQ(end,ftell(file));
+	for (size_t i = 0; i < n-first; ++i)
+	    ASSERT_EQ(a[first+i],b[i]) << "element " << first+i;
+
+	// Past the end of the block
+	rewind(file);
+	EXPECT_EQ(0u,fread_compressed_array_range(file,&b[0],sizeof(double),
+						  n,10));
+	EXPECT_EQ(end,ftell(file));
+}
+
+TEST_F(ZioTests, BytesRoundTrip)
+{
+	const size_t n = chunk_bytes + 3000;
+	std::vector<unsigned char> a(n);
+	for (size_t i = 0; i < n; ++i)
+	    a[i] = "FronTier checkpoint "[i%20];
+
+	fwrite_compressed_array(file,&a[0],1,n);
+#if defined(HAVE_ZLIB)
+	EXPECT_LT(ftell(file),(long)n);
+#endif /* defined(HAVE_ZLIB) */
+
+	std::vector<unsigned char> b(n,0);
+	rewind(file);
+	EXPECT_EQ(n,fread_compressed_array(file,&b[0],1,n));
+	EXPECT_TRUE(a == b);
+
+	const size_t first = chunk_bytes - 100, m = 2000;
+	rewind(file);
+	EXPECT_EQ(m,fread_compressed_array_range(file,&b[0],1,first,m));
+	EXPECT_TRUE(std::equal(a.begin()+first,a.begin()+first+m,b.begin()));
+}
+
+TEST_F(ZioTests, IncompressibleChunksStoredAsIs)
+{
+	const size_t n = chunk_bytes + 1000;
+	std::vector<unsigned char> a = randomBytes(n);
+
+	fwrite_compressed_array(file,&a[0],1,n);
+	EXPECT_EQ(header_bytes + 2*8 + (long)n,fileSize());
+
+	std::vector<unsigned char> b(n,0);
+	rewind(file);
+	EXPECT_EQ(n,fread_compressed_array(file,&b[0],1,n));
+	EXPECT_TRUE(a == b);
+}
+
+// Without zlib every chunk is stored as is and nothing can be corrupt
+#if defined(HAVE_ZLIB)
+TEST_F(ZioTests, CorruptChunkIsReported)
+{
+	const size_t n = 2*(chunk_bytes/sizeof(double));
+	std::vector<double> a = smoothField(n);
+	std::vector<double> b(n,0.0);
+
+	fwrite_compressed_array(file,&a[0],sizeof(double),n);
+
+	// Overwrite the start of the second chunk
+	uint64_t csize0;
+	fseek(file,header_bytes,SEEK_SET);
+	ASSERT_EQ(1u,fread(&csize0,sizeof(csize0),1,file));
+	fseek(file,header_bytes + 2*8 + (long)csize0,SEEK_SET);
+	const char junk[16] = "not a chunk";
+	fwrite(junk,1,sizeof(junk),file);
+	fflush(file);
+
+	::testing::FLAGS_gtest_death_test_style = "threadsafe";
+	rewind(file);
+	EXPECT_DEATH(fread_compressed_array(file,&b[0],sizeof(double),n),
+		     "can't expand chunk 1");
+}
+#endif /* defined(HAVE_ZLIB) */